@@ -2,22 +2,129 @@
 
 #include "BlueprintGraphEditor.h"
 #include "UnrealClaudeModule.h"
+#include "MCP/MCPClassResolver.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "K2Node_FunctionEntry.h"
 #include "K2Node_Event.h"
 #include "K2Node_CallFunction.h"
 #include "K2Node_IfThenElse.h"
+#include "K2Node_Variable.h"
 #include "K2Node_VariableGet.h"
 #include "K2Node_VariableSet.h"
 #include "K2Node_ExecutionSequence.h"
 #include "EdGraphSchema_K2.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Kismet/KismetMathLibrary.h"
-#include "HAL/PlatformAtomics.h"
+#include "UObject/ObjectKey.h"
 
-// Static member initialization
-volatile int32 FBlueprintGraphEditor::NodeIdCounter = 0;
-const FString FBlueprintGraphEditor::NodeIdPrefix = TEXT("MCP_ID:");
+namespace
+{
+	/** ID prefix older versions wrote into node comments */
+	const TCHAR* LegacyNodeIdPrefix = TEXT("MCP_ID:");
+
+	/** Node lookup for one graph, built on first use and patched as nodes are added or removed here */
+	struct FGraphNodeIndex
+	{
+		TMap<FGuid, TWeakObjectPtr<UEdGraphNode>> ByGuid;
+
+		/** IDs stored in node comments by older versions */
+		TMap<FString, TWeakObjectPtr<UEdGraphNode>> ByLegacyId;
+
+		/** Graph->Nodes.Num() when the index matched the graph; anything else forces a rebuild */
+		int32 SyncedNodeCount = INDEX_NONE;
+
+		TWeakObjectPtr<UEdGraph> Graph;
+	};
+
+	/** Game thread only */
+	TMap<FObjectKey, FGraphNodeIndex> GraphNodeIndices;
+
+	FString GetLegacyNodeId(const UEdGraphNode* Node)
+	{
+		return Node->NodeComment.StartsWith(LegacyNodeIdPrefix)
+			? Node->NodeComment.RightChop(FCString::Strlen(LegacyNodeIdPrefix))
+			: FString();
+	}
+
+	/** Readable part of a node ID: node type plus function, event or variable name */
+	FString GetNodeIdPrefix(const UEdGraphNode* Node)
+	{
+		FString Prefix = Node->GetClass()->GetName();
+		Prefix.RemoveFromStart(TEXT("K2Node_"));
+
+		FName Context;
+		if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+		{
+			Context = CallNode->FunctionReference.GetMemberName();
+		}
+		else if (const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+		{
+			Context = EventNode->GetFunctionName();
+		}
+		else if (const UK2Node_Variable* VariableNode = Cast<UK2Node_Variable>(Node))
+		{
+			Context = VariableNode->GetVarName();
+		}
+
+		if (!Context.IsNone())
+		{
+			Prefix += TEXT("_") + Context.ToString();
+		}
+		return Prefix;
+	}
+
+	/** Guid part of a node ID (the text after the last underscore) */
+	bool ParseNodeGuid(const FString& NodeId, FGuid& OutGuid)
+	{
+		int32 SeparatorIndex = INDEX_NONE;
+		const FString GuidString = NodeId.FindLastChar(TEXT('_'), SeparatorIndex) ? NodeId.RightChop(SeparatorIndex + 1) : NodeId;
+		return GuidString.Len() == 32 && FGuid::ParseExact(GuidString, EGuidFormats::Digits, OutGuid);
+	}
+
+	void AddNodeToIndex(FGraphNodeIndex& Index, UEdGraphNode* Node)
+	{
+		Index.ByGuid.Add(Node->NodeGuid, Node);
+		const FString LegacyId = GetLegacyNodeId(Node);
+		if (!LegacyId.IsEmpty())
+		{
+			Index.ByLegacyId.Add(LegacyId, Node);
+		}
+	}
+
+	FGraphNodeIndex& GetGraphNodeIndex(UEdGraph* Graph, bool bForceRebuild)
+	{
+		const FObjectKey Key(Graph);
+		FGraphNodeIndex* Index = GraphNodeIndices.Find(Key);
+		if (!Index)
+		{
+			// New graph: drop indexes of graphs that no longer exist
+			for (auto It = GraphNodeIndices.CreateIterator(); It; ++It)
+			{
+				if (!It.Value().Graph.IsValid())
+				{
+					It.RemoveCurrent();
+				}
+			}
+			Index = &GraphNodeIndices.Add(Key);
+			Index->Graph = Graph;
+		}
+
+		if (bForceRebuild || Index->SyncedNodeCount != Graph->Nodes.Num())
+		{
+			Index->ByGuid.Reset();
+			Index->ByLegacyId.Reset();
+			for (UEdGraphNode* Node : Graph->Nodes)
+			{
+				if (Node)
+				{
+					AddNodeToIndex(*Index, Node);
+				}
+			}
+			Index->SyncedNodeCount = Graph->Nodes.Num();
+		}
+		return *Index;
+	}
+}
 
 // ===== Graph Finding =====
 
@@ -97,14 +204,12 @@ UEdGraphNode* FBlueprintGraphEditor::CreateNode(
 	}
 
 	UEdGraphNode* NewNode = nullptr;
-	FString Context;
 
 	// Dispatch to appropriate creation function
 	if (NodeType.Equals(TEXT("CallFunction"), ESearchCase::IgnoreCase))
 	{
 		FString FunctionName = NodeParams.IsValid() ? NodeParams->GetStringField(TEXT("function")) : TEXT("");
 		FString TargetClass = NodeParams.IsValid() ? NodeParams->GetStringField(TEXT("target_class")) : TEXT("");
-		Context = FunctionName;
 		NewNode = CreateCallFunctionNode(Graph, FunctionName, TargetClass, PosX, PosY, OutError);
 	}
 	else if (NodeType.Equals(TEXT("Branch"), ESearchCase::IgnoreCase) || NodeType.Equals(TEXT("IfThenElse"), ESearchCase::IgnoreCase))
@@ -114,19 +219,16 @@ UEdGraphNode* FBlueprintGraphEditor::CreateNode(
 	else if (NodeType.Equals(TEXT("Event"), ESearchCase::IgnoreCase))
 	{
 		FString EventName = NodeParams.IsValid() ? NodeParams->GetStringField(TEXT("event")) : TEXT("");
-		Context = EventName;
 		NewNode = CreateEventNode(Graph, EventName, PosX, PosY, OutError);
 	}
 	else if (NodeType.Equals(TEXT("VariableGet"), ESearchCase::IgnoreCase) || NodeType.Equals(TEXT("GetVariable"), ESearchCase::IgnoreCase))
 	{
 		FString VariableName = NodeParams.IsValid() ? NodeParams->GetStringField(TEXT("variable")) : TEXT("");
-		Context = VariableName;
 		NewNode = CreateVariableGetNode(Graph, Blueprint, VariableName, PosX, PosY, OutError);
 	}
 	else if (NodeType.Equals(TEXT("VariableSet"), ESearchCase::IgnoreCase) || NodeType.Equals(TEXT("SetVariable"), ESearchCase::IgnoreCase))
 	{
 		FString VariableName = NodeParams.IsValid() ? NodeParams->GetStringField(TEXT("variable")) : TEXT("");
-		Context = VariableName;
 		NewNode = CreateVariableSetNode(Graph, Blueprint, VariableName, PosX, PosY, OutError);
 	}
 	else if (NodeType.Equals(TEXT("Sequence"), ESearchCase::IgnoreCase))
@@ -140,13 +242,11 @@ UEdGraphNode* FBlueprintGraphEditor::CreateNode(
 			 NodeType.Equals(TEXT("Multiply"), ESearchCase::IgnoreCase) ||
 			 NodeType.Equals(TEXT("Divide"), ESearchCase::IgnoreCase))
 	{
-		Context = NodeType;
 		NewNode = CreateMathNode(Graph, NodeType, PosX, PosY, OutError);
 	}
 	else if (NodeType.Equals(TEXT("PrintString"), ESearchCase::IgnoreCase))
 	{
 		// Convenience alias for CallFunction with PrintString
-		Context = TEXT("PrintString");
 		NewNode = CreateCallFunctionNode(Graph, TEXT("PrintString"), TEXT("KismetSystemLibrary"), PosX, PosY, OutError);
 	}
 	else
@@ -157,9 +257,8 @@ UEdGraphNode* FBlueprintGraphEditor::CreateNode(
 
 	if (NewNode)
 	{
-		// Generate and set node ID
-		OutNodeId = GenerateNodeId(NodeType, Context, Graph);
-		SetNodeId(NewNode, OutNodeId);
+		OutNodeId = GetNodeId(NewNode);
+		AddToNodeIndex(Graph, NewNode);
 
 		// Mark blueprint as modified
 		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
@@ -191,6 +290,7 @@ bool FBlueprintGraphEditor::DeleteNode(UEdGraph* Graph, const FString& NodeId, F
 	Node->BreakAllNodeLinks();
 
 	// Remove from graph
+	RemoveFromNodeIndex(Graph, Node);
 	Graph->RemoveNode(Node);
 
 	if (Blueprint)
@@ -209,9 +309,16 @@ UEdGraphNode* FBlueprintGraphEditor::FindNodeById(UEdGraph* Graph, const FString
 		return nullptr;
 	}
 
-	for (UEdGraphNode* Node : Graph->Nodes)
+	FGuid NodeGuid;
+	const bool bGuidId = ParseNodeGuid(NodeId, NodeGuid);
+
+	// Second pass rebuilds the index, for graphs edited without changing their node count
+	for (int32 Pass = 0; Pass < 2; ++Pass)
 	{
-		if (Node && GetNodeId(Node) == NodeId)
+		FGraphNodeIndex& Index = GetGraphNodeIndex(Graph, Pass > 0);
+		const TWeakObjectPtr<UEdGraphNode>* Found = bGuidId ? Index.ByGuid.Find(NodeGuid) : Index.ByLegacyId.Find(NodeId);
+		UEdGraphNode* Node = Found ? Found->Get() : nullptr;
+		if (Node && Node->GetGraph() == Graph && (!bGuidId || Node->NodeGuid == NodeGuid))
 		{
 			return Node;
 		}
@@ -569,58 +676,66 @@ TSharedPtr<FJsonObject> FBlueprintGraphEditor::SerializeNodeInfo(UEdGraphNode* N
 
 // ===== Node ID System =====
 
-FString FBlueprintGraphEditor::GenerateNodeId(const FString& NodeType, const FString& Context, UEdGraph* Graph)
+FString FBlueprintGraphEditor::GetNodeId(UEdGraphNode* Node)
 {
-	FString BaseId;
-	if (Context.IsEmpty())
-	{
-		BaseId = NodeType;
-	}
-	else
+	if (!Node)
 	{
-		BaseId = FString::Printf(TEXT("%s_%s"), *NodeType, *Context);
+		return FString();
 	}
 
-	// Ensure uniqueness with atomic increment for thread safety
-	int32 Counter = FPlatformAtomics::InterlockedIncrement(&NodeIdCounter);
-	FString NodeId = FString::Printf(TEXT("%s_%d"), *BaseId, Counter);
-
-	// Verify uniqueness in graph
-	if (Graph)
+	const FString LegacyId = GetLegacyNodeId(Node);
+	if (!LegacyId.IsEmpty())
 	{
-		while (FindNodeById(Graph, NodeId) != nullptr)
-		{
-			Counter = FPlatformAtomics::InterlockedIncrement(&NodeIdCounter);
-			NodeId = FString::Printf(TEXT("%s_%d"), *BaseId, Counter);
-		}
+		return LegacyId;
 	}
 
-	return NodeId;
+	return FString::Printf(TEXT("%s_%s"), *GetNodeIdPrefix(Node), *Node->NodeGuid.ToString(EGuidFormats::Digits));
 }
 
-void FBlueprintGraphEditor::SetNodeId(UEdGraphNode* Node, const FString& NodeId)
+void FBlueprintGraphEditor::InvalidateNodeIndex(UEdGraph* Graph)
 {
-	if (Node)
+	GraphNodeIndices.Remove(FObjectKey(Graph));
+}
+
+void FBlueprintGraphEditor::AddToNodeIndex(UEdGraph* Graph, UEdGraphNode* Node)
+{
+	FGraphNodeIndex* Index = GraphNodeIndices.Find(FObjectKey(Graph));
+	if (!Index)
+	{
+		return;
+	}
+
+	// Only patch an index that was in sync before this node was added
+	if (Index->SyncedNodeCount != Graph->Nodes.Num() - 1)
 	{
-		// Store ID in node comment (visible in editor, persisted)
-		Node->NodeComment = NodeIdPrefix + NodeId;
+		Index->SyncedNodeCount = INDEX_NONE;
+		return;
 	}
+	AddNodeToIndex(*Index, Node);
+	Index->SyncedNodeCount = Graph->Nodes.Num();
 }
 
-FString FBlueprintGraphEditor::GetNodeId(UEdGraphNode* Node)
+void FBlueprintGraphEditor::RemoveFromNodeIndex(UEdGraph* Graph, UEdGraphNode* Node)
 {
-	if (!Node)
+	FGraphNodeIndex* Index = GraphNodeIndices.Find(FObjectKey(Graph));
+	if (!Index)
 	{
-		return FString();
+		return;
 	}
 
-	// Extract ID from node comment
-	if (Node->NodeComment.StartsWith(NodeIdPrefix))
+	// Called before the node leaves Graph->Nodes
+	if (Index->SyncedNodeCount != Graph->Nodes.Num())
 	{
-		return Node->NodeComment.RightChop(NodeIdPrefix.Len());
+		Index->SyncedNodeCount = INDEX_NONE;
+		return;
 	}
-
-	return FString();
+	Index->ByGuid.Remove(Node->NodeGuid);
+	const FString LegacyId = GetLegacyNodeId(Node);
+	if (!LegacyId.IsEmpty())
+	{
+		Index->ByLegacyId.Remove(LegacyId);
+	}
+	Index->SyncedNodeCount = Graph->Nodes.Num() - 1;
 }
 
 // ===== Private Node Creation Helpers =====
@@ -643,22 +758,10 @@ UEdGraphNode* FBlueprintGraphEditor::CreateCallFunctionNode(
 	UFunction* Function = nullptr;
 	UClass* FunctionOwner = nullptr;
 
-	// Try to find class by name
+	// Short names, script paths and Blueprint class paths
 	if (!TargetClass.IsEmpty())
 	{
-		FunctionOwner = FindObject<UClass>(nullptr, *TargetClass);
-		if (!FunctionOwner)
-		{
-			// Try common library classes
-			if (TargetClass.Equals(TEXT("KismetSystemLibrary"), ESearchCase::IgnoreCase))
-			{
-				FunctionOwner = UKismetSystemLibrary::StaticClass();
-			}
-			else if (TargetClass.Equals(TEXT("KismetMathLibrary"), ESearchCase::IgnoreCase))
-			{
-				FunctionOwner = UKismetMathLibrary::StaticClass();
-			}
-		}
+		FunctionOwner = FMCPClassResolver::Get().FindClass(TargetClass);
 	}
 	else
 	{
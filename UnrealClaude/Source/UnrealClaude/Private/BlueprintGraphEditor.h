@@ -24,9 +24,10 @@
  * - Math: Add, Subtract, Multiply, Divide
  *
  * Node ID System:
- * - Auto-generated descriptive IDs stored in NodeComment
- * - Format: "{NodeType}_{Context}_{Counter}"
- * - Thread-safe counter for uniqueness
+ * - Every node has an ID derived from its NodeGuid; the user-visible comment is left alone
+ * - Format: "{NodeType}_{Context}_{Guid}" (lookups only use the Guid, so renames keep IDs valid)
+ * - Nodes tagged "MCP_ID:..." in their comment by older versions keep that ID
+ * - Lookups go through a per-graph index, rebuilt when the graph changes outside these functions
  */
 class FBlueprintGraphEditor
 {
@@ -188,32 +189,16 @@ public:
 	// ===== Node ID System =====
 
 	/**
-	 * Generate unique descriptive node ID
-	 * @param NodeType - Type of node
-	 * @param Context - Additional context (function name, etc.)
-	 * @param Graph - Graph to ensure uniqueness
-	 * @return Unique ID string
-	 */
-	static FString GenerateNodeId(const FString& NodeType, const FString& Context, UEdGraph* Graph);
-
-	/**
-	 * Store node ID in node metadata
-	 * @param Node - Node to tag
-	 * @param NodeId - ID to store
-	 */
-	static void SetNodeId(UEdGraphNode* Node, const FString& NodeId);
-
-	/**
-	 * Get node ID from metadata
+	 * Get a node's ID
 	 * @param Node - Node to query
-	 * @return Node ID or empty string
+	 * @return Legacy comment ID if the node has one, otherwise "{NodeType}_{Context}_{Guid}"
 	 */
 	static FString GetNodeId(UEdGraphNode* Node);
 
-private:
-	// Thread-safe counter for unique IDs
-	static volatile int32 NodeIdCounter;
+	/** Drop the cached node index for a graph (rebuilt on the next lookup) */
+	static void InvalidateNodeIndex(UEdGraph* Graph);
 
+private:
 	// Node creation helpers
 	static UEdGraphNode* CreateCallFunctionNode(UEdGraph* Graph, const FString& FunctionName, const FString& TargetClass, int32 PosX, int32 PosY, FString& OutError);
 	static UEdGraphNode* CreateBranchNode(UEdGraph* Graph, int32 PosX, int32 PosY, FString& OutError);
@@ -223,6 +208,7 @@ private:
 	static UEdGraphNode* CreateSequenceNode(UEdGraph* Graph, int32 NumOutputs, int32 PosX, int32 PosY, FString& OutError);
 	static UEdGraphNode* CreateMathNode(UEdGraph* Graph, const FString& MathOp, int32 PosX, int32 PosY, FString& OutError);
 
-	// ID prefix for node comments
-	static const FString NodeIdPrefix;
+	// Node index maintenance
+	static void AddToNodeIndex(UEdGraph* Graph, UEdGraphNode* Node);
+	static void RemoveFromNodeIndex(UEdGraph* Graph, UEdGraphNode* Node);
 };
@@ -0,0 +1,460 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "BlueprintGraphText.h"
+#include "BlueprintGraphEditor.h"
+#include "UnrealClaudeConstants.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "K2Node_Event.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_IfThenElse.h"
+#include "K2Node_VariableGet.h"
+#include "K2Node_VariableSet.h"
+#include "K2Node_ExecutionSequence.h"
+#include "EdGraphSchema_K2.h"
+#include "Algo/Count.h"
+
+using namespace UnrealClaudeConstants::GraphText;
+
+// ===== Writing =====
+
+void FBlueprintGraphText::GetNodeSpec(const UEdGraphNode* Node, FString& OutType, TArray<TPair<FString, FString>>& OutParams)
+{
+	OutType.Reset();
+	OutParams.Reset();
+	if (!Node)
+	{
+		return;
+	}
+
+	// Exact classes only: subclasses (custom events, array functions, ...) are not what add_nodes would create
+	const UClass* NodeClass = Node->GetClass();
+	if (NodeClass == UK2Node_CallFunction::StaticClass())
+	{
+		const UK2Node_CallFunction* CallNode = CastChecked<UK2Node_CallFunction>(Node);
+		OutType = TEXT("CallFunction");
+		OutParams.Emplace(TEXT("function"), CallNode->FunctionReference.GetMemberName().ToString());
+		if (const UFunction* Function = CallNode->GetTargetFunction())
+		{
+			// Full path so add_nodes resolves any class, not just the Kismet libraries; SKEL classes map to the generated class
+			OutParams.Emplace(TEXT("target_class"), Function->GetOwnerClass()->GetAuthoritativeClass()->GetPathName());
+		}
+	}
+	else if (NodeClass == UK2Node_Event::StaticClass())
+	{
+		OutType = TEXT("Event");
+		OutParams.Emplace(TEXT("event"), CastChecked<UK2Node_Event>(Node)->EventReference.GetMemberName().ToString());
+	}
+	else if (NodeClass == UK2Node_IfThenElse::StaticClass())
+	{
+		OutType = TEXT("Branch");
+	}
+	else if (NodeClass == UK2Node_VariableGet::StaticClass())
+	{
+		OutType = TEXT("VariableGet");
+		OutParams.Emplace(TEXT("variable"), CastChecked<UK2Node_VariableGet>(Node)->GetVarName().ToString());
+	}
+	else if (NodeClass == UK2Node_VariableSet::StaticClass())
+	{
+		OutType = TEXT("VariableSet");
+		OutParams.Emplace(TEXT("variable"), CastChecked<UK2Node_VariableSet>(Node)->GetVarName().ToString());
+	}
+	else if (NodeClass == UK2Node_ExecutionSequence::StaticClass())
+	{
+		int32 NumOutputs = 0;
+		for (const UEdGraphPin* Pin : Node->Pins)
+		{
+			if (Pin && Pin->Direction == EGPD_Output && Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+			{
+				++NumOutputs;
+			}
+		}
+		OutType = TEXT("Sequence");
+		OutParams.Emplace(TEXT("num_outputs"), FString::FromInt(NumOutputs));
+	}
+}
+
+FString FBlueprintGraphText::SerializeGraph(UEdGraph* Graph, int32& InOutNextLabel, bool bIncludeNodeIds)
+{
+	if (!Graph)
+	{
+		return FString();
+	}
+
+	FString NodeType;
+	TArray<TPair<FString, FString>> NodeParams;
+
+	// Nodes add_nodes cannot create are written commented out, and links into them use their node ID
+	TMap<const UEdGraphNode*, FString> Labels;
+	TSet<const UEdGraphNode*> ReadOnlyNodes;
+	for (const UEdGraphNode* Node : Graph->Nodes)
+	{
+		if (Node)
+		{
+			Labels.Add(Node, FString::Printf(TEXT("n%d"), InOutNextLabel++));
+			GetNodeSpec(Node, NodeType, NodeParams);
+			if (NodeType.IsEmpty())
+			{
+				ReadOnlyNodes.Add(Node);
+			}
+		}
+	}
+
+	TStringBuilder<4096> Builder;
+	Builder.Appendf(TEXT("# graph %s: %d nodes\n"), *Graph->GetName(), Labels.Num());
+
+	for (UEdGraphNode* Node : Graph->Nodes)
+	{
+		if (!Node)
+		{
+			continue;
+		}
+
+		GetNodeSpec(Node, NodeType, NodeParams);
+		if (NodeType.IsEmpty())
+		{
+			NodeType = Node->GetClass()->GetName();
+			NodeType.RemoveFromStart(TEXT("K2Node_"));
+			NodeType.RemoveFromStart(TEXT("EdGraphNode_"));
+			Builder.Append(TEXT("# "));
+		}
+
+		Builder.Append(Labels[Node]);
+		Builder.AppendChar(TEXT(' '));
+		Builder.Append(NodeType);
+		for (const TPair<FString, FString>& Param : NodeParams)
+		{
+			Builder.Appendf(TEXT(" %s=%s"), *Param.Key, *QuoteIfNeeded(Param.Value, false));
+		}
+		Builder.Appendf(TEXT(" @%d,%d"), Node->NodePosX, Node->NodePosY);
+
+		for (const UEdGraphPin* Pin : Node->Pins)
+		{
+			if (!Pin || Pin->bHidden)
+			{
+				continue;
+			}
+
+			const FString PinName = QuoteIfNeeded(Pin->PinName.ToString(), true);
+			if (Pin->Direction == EGPD_Input)
+			{
+				// Only values that differ from the pin's own default
+				if (Pin->LinkedTo.Num() == 0)
+				{
+					if (Pin->DefaultObject)
+					{
+						Builder.Appendf(TEXT(" .%s=%s"), *PinName, *QuoteIfNeeded(Pin->DefaultObject->GetPathName(), false));
+					}
+					else if (!Pin->DefaultValue.IsEmpty() && Pin->DefaultValue != Pin->AutogeneratedDefaultValue)
+					{
+						Builder.Appendf(TEXT(" .%s=%s"), *PinName, *QuoteIfNeeded(Pin->DefaultValue, false));
+					}
+				}
+				continue;
+			}
+
+			// Each link is written once, from its output pin
+			for (const UEdGraphPin* Linked : Pin->LinkedTo)
+			{
+				UEdGraphNode* LinkedNode = Linked ? Linked->GetOwningNode() : nullptr;
+				if (!LinkedNode)
+				{
+					continue;
+				}
+				const FString* LinkedLabel = ReadOnlyNodes.Contains(LinkedNode) ? nullptr : Labels.Find(LinkedNode);
+				Builder.Appendf(TEXT(" %s->%s.%s"), *PinName,
+					LinkedLabel ? **LinkedLabel : *FBlueprintGraphEditor::GetNodeId(LinkedNode),
+					*QuoteIfNeeded(Linked->PinName.ToString(), true));
+			}
+		}
+
+		if (bIncludeNodeIds)
+		{
+			Builder.Appendf(TEXT("  # %s"), *FBlueprintGraphEditor::GetNodeId(Node));
+		}
+		Builder.AppendChar(TEXT('\n'));
+	}
+
+	return Builder.ToString();
+}
+
+FString FBlueprintGraphText::QuoteIfNeeded(const FString& Value, bool bName)
+{
+	bool bNeedsQuotes = Value.IsEmpty() || Value.Contains(TEXT("->"));
+	for (int32 Index = 0; Index < Value.Len() && !bNeedsQuotes; ++Index)
+	{
+		const TCHAR Char = Value[Index];
+		bNeedsQuotes = FChar::IsWhitespace(Char) || Char == TEXT('"') || Char == TEXT('#') || Char == TEXT('\\') ||
+			(bName && (Char == TEXT('.') || Char == TEXT('=') || Char == TEXT('@')));
+	}
+	if (!bNeedsQuotes)
+	{
+		return Value;
+	}
+
+	FString Quoted;
+	Quoted.Reserve(Value.Len() + 2);
+	Quoted.AppendChar(TEXT('"'));
+	for (const TCHAR Char : Value)
+	{
+		if (Char == TEXT('"') || Char == TEXT('\\'))
+		{
+			Quoted.AppendChar(TEXT('\\'));
+		}
+		Quoted.AppendChar(Char);
+	}
+	Quoted.AppendChar(TEXT('"'));
+	return Quoted;
+}
+
+// ===== Parsing =====
+
+bool FBlueprintGraphText::Tokenize(const FString& Line, TArray<FString>& OutTokens, TArray<FString>& OutShapes, FString& OutError)
+{
+	FString Token;
+	FString Shape;
+	bool bHasToken = false;
+	bool bInQuotes = false;
+
+	for (int32 Index = 0; Index < Line.Len(); ++Index)
+	{
+		const TCHAR Char = Line[Index];
+		if (bInQuotes)
+		{
+			if (Char == TEXT('\\') && Index + 1 < Line.Len())
+			{
+				Token.AppendChar(Line[++Index]);
+				Shape.AppendChar(TEXT('_'));
+			}
+			else if (Char == TEXT('"'))
+			{
+				bInQuotes = false;
+			}
+			else
+			{
+				Token.AppendChar(Char);
+				Shape.AppendChar(TEXT('_'));
+			}
+			continue;
+		}
+
+		if (Char == TEXT('"'))
+		{
+			bInQuotes = true;
+			bHasToken = true;
+		}
+		else if (Char == TEXT('#'))
+		{
+			break;
+		}
+		else if (FChar::IsWhitespace(Char))
+		{
+			if (bHasToken)
+			{
+				OutTokens.Add(MoveTemp(Token));
+				OutShapes.Add(MoveTemp(Shape));
+				Token.Reset();
+				Shape.Reset();
+				bHasToken = false;
+			}
+		}
+		else
+		{
+			Token.AppendChar(Char);
+			Shape.AppendChar(Char);
+			bHasToken = true;
+		}
+	}
+
+	if (bInQuotes)
+	{
+		OutError = TEXT("unterminated quote");
+		return false;
+	}
+	if (bHasToken)
+	{
+		OutTokens.Add(MoveTemp(Token));
+		OutShapes.Add(MoveTemp(Shape));
+	}
+	return true;
+}
+
+bool FBlueprintGraphText::Parse(const FString& Text, TArray<TSharedPtr<FJsonValue>>& OutNodes,
+	TArray<TSharedPtr<FJsonValue>>& OutConnections, FString& OutError)
+{
+	struct FPendingLink
+	{
+		int32 FromIndex;
+		FString FromPin;
+		FString TargetRef;
+		FString ToPin;
+	};
+
+	TArray<FString> Lines;
+	Text.ParseIntoArrayLines(Lines, false);
+
+	// add_nodes targets one graph; nodes from several would all land in it
+	const int32 GraphCount = Algo::CountIf(Lines, [](const FString& Line)
+	{
+		return Line.TrimStart().StartsWith(TEXT("# graph "));
+	});
+	if (GraphCount > 1)
+	{
+		OutError = FString::Printf(TEXT("Text contains %d graphs ('# graph' lines); add_nodes takes one graph at a time "
+			"(use get_graph with graph_name)"), GraphCount);
+		return false;
+	}
+
+	TMap<FString, int32> LabelToIndex;
+	TArray<FPendingLink> Links;
+
+	for (int32 LineIndex = 0; LineIndex < Lines.Num(); ++LineIndex)
+	{
+		const int32 LineNumber = LineIndex + 1;
+
+		TArray<FString> Tokens;
+		TArray<FString> Shapes;
+		FString TokenizeError;
+		if (!Tokenize(Lines[LineIndex], Tokens, Shapes, TokenizeError))
+		{
+			OutError = FString::Printf(TEXT("Line %d: %s"), LineNumber, *TokenizeError);
+			return false;
+		}
+		if (Tokens.Num() == 0)
+		{
+			continue;
+		}
+		if (Tokens.Num() < 2)
+		{
+			OutError = FString::Printf(TEXT("Line %d: expected '<label> <NodeType> ...'"), LineNumber);
+			return false;
+		}
+		if (LabelToIndex.Contains(Tokens[0]))
+		{
+			OutError = FString::Printf(TEXT("Line %d: label '%s' is already used"), LineNumber, *Tokens[0]);
+			return false;
+		}
+		if (OutNodes.Num() >= MaxNodes)
+		{
+			OutError = FString::Printf(TEXT("Too many nodes (max %d per add_nodes call)"), MaxNodes);
+			return false;
+		}
+
+		const int32 NodeIndex = OutNodes.Num();
+		LabelToIndex.Add(Tokens[0], NodeIndex);
+
+		TSharedPtr<FJsonObject> NodeSpec = MakeShared<FJsonObject>();
+		TSharedPtr<FJsonObject> NodeParams = MakeShared<FJsonObject>();
+		TSharedPtr<FJsonObject> PinValues = MakeShared<FJsonObject>();
+		NodeSpec->SetStringField(TEXT("type"), Tokens[1]);
+		NodeSpec->SetNumberField(TEXT("pos_x"), NodeIndex * AutoLayoutSpacingX);
+		NodeSpec->SetNumberField(TEXT("pos_y"), 0);
+
+		for (int32 TokenIndex = 2; TokenIndex < Tokens.Num(); ++TokenIndex)
+		{
+			const FString& Token = Tokens[TokenIndex];
+			const FString& Shape = Shapes[TokenIndex];
+
+			if (Shape.StartsWith(TEXT("@")))
+			{
+				FString XString;
+				FString YString;
+				if (!Token.Mid(1).Split(TEXT(","), &XString, &YString) || !XString.IsNumeric() || !YString.IsNumeric())
+				{
+					OutError = FString::Printf(TEXT("Line %d: position must be @x,y, got '%s'"), LineNumber, *Token);
+					return false;
+				}
+				NodeSpec->SetNumberField(TEXT("pos_x"), FCString::Atoi(*XString));
+				NodeSpec->SetNumberField(TEXT("pos_y"), FCString::Atoi(*YString));
+				continue;
+			}
+
+			if (Shape.StartsWith(TEXT(".")))
+			{
+				const int32 EqualsIndex = Shape.Find(TEXT("="));
+				if (EqualsIndex <= 1)
+				{
+					OutError = FString::Printf(TEXT("Line %d: pin value must be .Pin=value, got '%s'"), LineNumber, *Token);
+					return false;
+				}
+				PinValues->SetStringField(Token.Mid(1, EqualsIndex - 1), Token.Mid(EqualsIndex + 1));
+				continue;
+			}
+
+			const int32 ArrowIndex = Shape.Find(TEXT("->"));
+			if (ArrowIndex != INDEX_NONE)
+			{
+				const int32 DotIndex = Shape.Find(TEXT("."), ESearchCase::CaseSensitive, ESearchDir::FromStart, ArrowIndex + 2);
+				FPendingLink Link;
+				Link.FromIndex = NodeIndex;
+				Link.FromPin = Token.Left(ArrowIndex);
+				if (DotIndex != INDEX_NONE)
+				{
+					Link.TargetRef = Token.Mid(ArrowIndex + 2, DotIndex - ArrowIndex - 2);
+					Link.ToPin = Token.Mid(DotIndex + 1);
+				}
+				if (Link.FromPin.IsEmpty() || Link.TargetRef.IsEmpty() || Link.ToPin.IsEmpty())
+				{
+					OutError = FString::Printf(TEXT("Line %d: link must be Pin->node.Pin, got '%s'"), LineNumber, *Token);
+					return false;
+				}
+				Links.Add(MoveTemp(Link));
+				continue;
+			}
+
+			const int32 EqualsIndex = Shape.Find(TEXT("="));
+			if (EqualsIndex > 0)
+			{
+				const FString Key = Token.Left(EqualsIndex);
+				const FString Value = Token.Mid(EqualsIndex + 1);
+				if (Value.IsNumeric())
+				{
+					NodeParams->SetNumberField(Key, FCString::Atod(*Value));
+				}
+				else
+				{
+					NodeParams->SetStringField(Key, Value);
+				}
+				continue;
+			}
+
+			OutError = FString::Printf(TEXT("Line %d: unexpected '%s' (expected key=value, @x,y, .Pin=value or Pin->node.Pin)"),
+				LineNumber, *Token);
+			return false;
+		}
+
+		NodeSpec->SetObjectField(TEXT("params"), NodeParams);
+		if (PinValues->Values.Num() > 0)
+		{
+			NodeSpec->SetObjectField(TEXT("pin_values"), PinValues);
+		}
+		OutNodes.Add(MakeShared<FJsonValueObject>(NodeSpec));
+	}
+
+	if (OutNodes.Num() == 0)
+	{
+		OutError = TEXT("No nodes found in text");
+		return false;
+	}
+
+	// Labels from this text become indices; anything else is an existing node ID
+	for (const FPendingLink& Link : Links)
+	{
+		TSharedPtr<FJsonObject> Connection = MakeShared<FJsonObject>();
+		Connection->SetNumberField(TEXT("from_node"), Link.FromIndex);
+		Connection->SetStringField(TEXT("from_pin"), Link.FromPin);
+		if (const int32* TargetIndex = LabelToIndex.Find(Link.TargetRef))
+		{
+			Connection->SetNumberField(TEXT("to_node"), *TargetIndex);
+		}
+		else
+		{
+			Connection->SetStringField(TEXT("to_node"), Link.TargetRef);
+		}
+		Connection->SetStringField(TEXT("to_pin"), Link.ToPin);
+		OutConnections.Add(MakeShared<FJsonValueObject>(Connection));
+	}
+
+	return true;
+}
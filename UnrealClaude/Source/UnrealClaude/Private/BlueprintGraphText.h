@@ -0,0 +1,75 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+class UEdGraph;
+class UEdGraphNode;
+
+/**
+ * Compact line-oriented text form of Blueprint graphs
+ *
+ * One line per node, a fraction of the size of per-pin JSON:
+ *
+ *   # graph EventGraph: 3 nodes
+ *   n0 Event event=ReceiveBeginPlay @0,0 then->n1.execute  # Event_ReceiveBeginPlay_<Guid>
+ *   n1 CallFunction function=PrintString target_class=/Script/Engine.KismetSystemLibrary @300,0 .InString="Hi" then->n2.execute
+ *   n2 Branch @600,0 .Condition=true
+ *
+ * Tokens after the label and node type:
+ * - key=value     Node parameter (function, target_class, event, variable, num_outputs)
+ * - @x,y          Position
+ * - .Pin=value    Pin default value
+ * - Pin->ref.Pin  Link from an output pin to another node's input pin; ref is a
+ *                 label from the same text or an existing node ID
+ * - # ...         Comment to end of line (IDs of existing nodes are written here)
+ *
+ * Values with spaces, quotes or '#' are double-quoted with backslash escapes.
+ * Parse turns the text into the nodes/connections arrays add_nodes takes, so
+ * single-graph output from get_graph can be edited and fed back; text with
+ * more than one "# graph" section is rejected. Nodes add_nodes cannot
+ * create (function entry/result, custom events, knots, casts, macros) are
+ * written as comment lines ("# n3 FunctionEntry ...") for reading only; links
+ * into them refer to their node ID, and links out of them are not recreated.
+ */
+class FBlueprintGraphText
+{
+public:
+	/**
+	 * Write a graph in compact form
+	 * @param Graph - Graph to write
+	 * @param InOutNextLabel - Number of the next node label (labels stay unique across graphs)
+	 * @param bIncludeNodeIds - Append each node's ID as a comment
+	 * @return Text, starting with a "# graph" comment line
+	 */
+	static FString SerializeGraph(UEdGraph* Graph, int32& InOutNextLabel, bool bIncludeNodeIds = true);
+
+	/**
+	 * Parse compact text into add_nodes specs
+	 * @param Text - Compact graph text
+	 * @param OutNodes - Node specs (type, pos_x, pos_y, params, pin_values) in line order
+	 * @param OutConnections - Connection specs; from_node/to_node are indices into OutNodes or node ID strings
+	 * @param OutError - Error with line number when parsing fails
+	 * @return false on error, including text that spans several graphs
+	 */
+	static bool Parse(const FString& Text, TArray<TSharedPtr<FJsonValue>>& OutNodes,
+		TArray<TSharedPtr<FJsonValue>>& OutConnections, FString& OutError);
+
+	/** Node type and parameters add_nodes would need to recreate a node (type is empty for unsupported nodes) */
+	static void GetNodeSpec(const UEdGraphNode* Node, FString& OutType, TArray<TPair<FString, FString>>& OutParams);
+
+private:
+	/**
+	 * Split a line into tokens; quotes group characters and are removed, '#' outside quotes ends the line
+	 * @param OutShapes - The same tokens with quoted characters replaced by '_', for finding separators
+	 */
+	static bool Tokenize(const FString& Line, TArray<FString>& OutTokens, TArray<FString>& OutShapes, FString& OutError);
+
+	/**
+	 * Quote a value if it would not survive Tokenize as a single token
+	 * @param bName - Also quote '.', '=' and '@', which separate pin and node references
+	 */
+	static FString QuoteIfNeeded(const FString& Value, bool bName);
+};
@@ -2,6 +2,7 @@
 
 #include "BlueprintLoader.h"
 #include "MCP/MCPParamValidator.h"
+#include "MCP/MCPClassResolver.h"
 #include "UnrealClaudeModule.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Kismet2/KismetEditorUtilities.h"
@@ -99,18 +100,9 @@ bool FBlueprintLoader::CompileBlueprint(UBlueprint* Blueprint, FString& OutError
 
 FBlueprintCompileResult FBlueprintLoader::CompileBlueprintWithResult(UBlueprint* Blueprint)
 {
-	FBlueprintCompileResult Result;
-
 	if (!Blueprint)
 	{
-		Result.StatusString = TEXT("Error");
-		Result.VerboseOutput = TEXT("Blueprint is null");
-		FBlueprintCompileMessage Msg;
-		Msg.Severity = TEXT("Error");
-		Msg.Message = TEXT("Blueprint is null");
-		Result.Messages.Add(Msg);
-		Result.ErrorCount = 1;
-		return Result;
+		return GetCompileResult(nullptr);
 	}
 
 	// Clear the message log before compile to capture fresh messages
@@ -123,6 +115,25 @@ FBlueprintCompileResult FBlueprintLoader::CompileBlueprintWithResult(UBlueprint*
 	// Compile the Blueprint
 	FKismetEditorUtilities::CompileBlueprint(Blueprint);
 
+	return GetCompileResult(Blueprint);
+}
+
+FBlueprintCompileResult FBlueprintLoader::GetCompileResult(UBlueprint* Blueprint)
+{
+	FBlueprintCompileResult Result;
+
+	if (!Blueprint)
+	{
+		Result.StatusString = TEXT("Error");
+		Result.VerboseOutput = TEXT("Blueprint is null");
+		FBlueprintCompileMessage Msg;
+		Msg.Severity = TEXT("Error");
+		Msg.Message = TEXT("Blueprint is null");
+		Result.Messages.Add(Msg);
+		Result.ErrorCount = 1;
+		return Result;
+	}
+
 	// Build verbose output from compiler status
 	TStringBuilder<1024> VerboseBuilder;
 	VerboseBuilder.Appendf(TEXT("Compiling Blueprint: %s\n"), *Blueprint->GetName());
@@ -313,29 +324,7 @@ UClass* FBlueprintLoader::FindParentClass(const FString& ParentClassName, FStrin
 		return nullptr;
 	}
 
-	UClass* ParentClass = nullptr;
-
-	// Try full path first
-	ParentClass = LoadClass<UObject>(nullptr, *ParentClassName);
-
-	// Try common engine prefixes
-	if (!ParentClass)
-	{
-		ParentClass = LoadClass<UObject>(nullptr,
-			*FString::Printf(TEXT("/Script/Engine.%s"), *ParentClassName));
-	}
-
-	if (!ParentClass)
-	{
-		ParentClass = LoadClass<UObject>(nullptr,
-			*FString::Printf(TEXT("/Script/CoreUObject.%s"), *ParentClassName));
-	}
-
-	// Try finding by short name
-	if (!ParentClass)
-	{
-		ParentClass = FindObject<UClass>(nullptr, *ParentClassName);
-	}
+	UClass* ParentClass = FMCPClassResolver::Get().FindClass(ParentClassName);
 
 	if (!ParentClass)
 	{
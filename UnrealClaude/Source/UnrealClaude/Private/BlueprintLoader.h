@@ -109,6 +109,14 @@ public:
 	 */
 	static FBlueprintCompileResult CompileBlueprintWithResult(UBlueprint* Blueprint);
 
+	/**
+	 * Build a compile result from a Blueprint's current status and node messages
+	 * Used after a batched compile, where the compilation manager compiles many Blueprints at once
+	 * @param Blueprint - Blueprint that has been compiled
+	 * @return Detailed compile result with messages
+	 */
+	static FBlueprintCompileResult GetCompileResult(UBlueprint* Blueprint);
+
 	/**
 	 * Mark Blueprint as modified (dirty)
 	 * @param Blueprint - Blueprint to mark
@@ -133,8 +141,8 @@ public:
 	);
 
 	/**
-	 * Find parent class from string
-	 * Supports: short names ("Actor"), full paths ("/Script/Engine.Pawn")
+	 * Find parent class from string via FMCPClassResolver
+	 * Supports: short names ("Actor"), full paths ("/Script/Engine.Pawn"), Blueprint classes
 	 * @param ParentClassName - Class name
 	 * @param OutError - Error message if not found
 	 * @return UClass or nullptr
@@ -13,6 +13,7 @@
 
 #include "BlueprintUtils.h"
 #include "UnrealClaudeModule.h"
+#include "MCP/MCPFieldSet.h"
 #include "K2Node_FunctionEntry.h"
 #include "K2Node_FunctionResult.h"
 #include "K2Node_Event.h"
@@ -46,6 +47,24 @@ TSharedPtr<FJsonObject> FBlueprintUtils::SerializeBlueprintInfo(
 	bool bIncludeVariables,
 	bool bIncludeFunctions,
 	bool bIncludeGraphs)
+{
+	FMCPFieldSet Fields = { TEXT("name"), TEXT("path"), TEXT("blueprint_type"), TEXT("parent_class"), TEXT("parent_class_name"), TEXT("generated_class") };
+	if (bIncludeVariables)
+	{
+		Fields.Add(TEXT("variables"));
+	}
+	if (bIncludeFunctions)
+	{
+		Fields.Add(TEXT("functions"));
+	}
+	if (bIncludeGraphs)
+	{
+		Fields.Add(TEXT("graph_info"));
+	}
+	return SerializeBlueprintInfo(Blueprint, Fields);
+}
+
+TSharedPtr<FJsonObject> FBlueprintUtils::SerializeBlueprintInfo(UBlueprint* Blueprint, const FMCPFieldSet& Fields)
 {
 	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
 
@@ -55,37 +74,52 @@ TSharedPtr<FJsonObject> FBlueprintUtils::SerializeBlueprintInfo(
 	}
 
 	// Basic info
-	Result->SetStringField(TEXT("name"), Blueprint->GetName());
-	Result->SetStringField(TEXT("path"), Blueprint->GetPathName());
-	Result->SetStringField(TEXT("blueprint_type"), GetBlueprintTypeString(Blueprint->BlueprintType));
+	if (Fields.Has(TEXT("name")))
+	{
+		Result->SetStringField(TEXT("name"), Blueprint->GetName());
+	}
+	if (Fields.Has(TEXT("path")))
+	{
+		Result->SetStringField(TEXT("path"), Blueprint->GetPathName());
+	}
+	if (Fields.Has(TEXT("blueprint_type")))
+	{
+		Result->SetStringField(TEXT("blueprint_type"), GetBlueprintTypeString(Blueprint->BlueprintType));
+	}
 
 	// Parent class
 	if (Blueprint->ParentClass)
 	{
-		Result->SetStringField(TEXT("parent_class"), Blueprint->ParentClass->GetPathName());
-		Result->SetStringField(TEXT("parent_class_name"), Blueprint->ParentClass->GetName());
+		if (Fields.Has(TEXT("parent_class")))
+		{
+			Result->SetStringField(TEXT("parent_class"), Blueprint->ParentClass->GetPathName());
+		}
+		if (Fields.Has(TEXT("parent_class_name")))
+		{
+			Result->SetStringField(TEXT("parent_class_name"), Blueprint->ParentClass->GetName());
+		}
 	}
 
 	// Generated class
-	if (Blueprint->GeneratedClass)
+	if (Blueprint->GeneratedClass && Fields.Has(TEXT("generated_class")))
 	{
 		Result->SetStringField(TEXT("generated_class"), Blueprint->GeneratedClass->GetPathName());
 	}
 
 	// Variables
-	if (bIncludeVariables)
+	if (Fields.Has(TEXT("variables")))
 	{
 		Result->SetArrayField(TEXT("variables"), GetBlueprintVariables(Blueprint));
 	}
 
 	// Functions
-	if (bIncludeFunctions)
+	if (Fields.Has(TEXT("functions")))
 	{
 		Result->SetArrayField(TEXT("functions"), GetBlueprintFunctions(Blueprint));
 	}
 
 	// Graphs
-	if (bIncludeGraphs)
+	if (Fields.Has(TEXT("graph_info")))
 	{
 		Result->SetObjectField(TEXT("graph_info"), GetGraphInfo(Blueprint));
 	}
@@ -93,6 +127,15 @@ TSharedPtr<FJsonObject> FBlueprintUtils::SerializeBlueprintInfo(
 	return Result;
 }
 
+const TArray<const TCHAR*>& FBlueprintUtils::GetBlueprintInfoFieldNames()
+{
+	static const TArray<const TCHAR*> Names = {
+		TEXT("name"), TEXT("path"), TEXT("blueprint_type"), TEXT("parent_class"), TEXT("parent_class_name"),
+		TEXT("generated_class"), TEXT("variables"), TEXT("functions"), TEXT("graph_info")
+	};
+	return Names;
+}
+
 TArray<TSharedPtr<FJsonValue>> FBlueprintUtils::GetBlueprintVariables(UBlueprint* Blueprint)
 {
 	TArray<TSharedPtr<FJsonValue>> Variables;
@@ -27,6 +27,8 @@
 #include "BlueprintEditor.h"
 #include "BlueprintGraphEditor.h"
 
+class FMCPFieldSet;
+
 /**
  * Facade class for backward compatibility with existing code.
  *
@@ -164,16 +166,6 @@ public:
 		return FBlueprintGraphEditor::FindNodeById(Graph, NodeId);
 	}
 
-	FORCEINLINE static FString GenerateNodeId(const FString& NodeType, const FString& Context, UEdGraph* Graph)
-	{
-		return FBlueprintGraphEditor::GenerateNodeId(NodeType, Context, Graph);
-	}
-
-	FORCEINLINE static void SetNodeId(UEdGraphNode* Node, const FString& NodeId)
-	{
-		FBlueprintGraphEditor::SetNodeId(Node, NodeId);
-	}
-
 	FORCEINLINE static FString GetNodeId(UEdGraphNode* Node)
 	{
 		return FBlueprintGraphEditor::GetNodeId(Node);
@@ -260,6 +252,15 @@ public:
 		bool bIncludeGraphs = false
 	);
 
+	/**
+	 * Serialize the selected Blueprint fields to JSON
+	 * Unselected sections (variables, functions, graph_info) are not computed.
+	 */
+	static TSharedPtr<FJsonObject> SerializeBlueprintInfo(UBlueprint* Blueprint, const FMCPFieldSet& Fields);
+
+	/** Field names understood by SerializeBlueprintInfo */
+	static const TArray<const TCHAR*>& GetBlueprintInfoFieldNames();
+
 	/**
 	 * Get all variables in Blueprint with metadata
 	 */
@@ -0,0 +1,29 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "CharacterDataTypes.h"
+#include "UObject/AssetRegistryTagsContext.h"
+
+const FName UCharacterConfigDataAsset::ConfigIdTag(TEXT("ConfigId"));
+const FName UCharacterConfigDataAsset::DisplayNameTag(TEXT("DisplayName"));
+const FName UCharacterConfigDataAsset::GameplayTagsTag(TEXT("GameplayTags"));
+const FName UCharacterConfigDataAsset::IsPlayerCharacterTag(TEXT("IsPlayerCharacter"));
+
+void UCharacterConfigDataAsset::GetAssetRegistryTags(FAssetRegistryTagsContext Context) const
+{
+	Super::GetAssetRegistryTags(Context);
+
+	FString TagsValue;
+	for (const FName& Tag : GameplayTags)
+	{
+		if (!TagsValue.IsEmpty())
+		{
+			TagsValue += GameplayTagsSeparator;
+		}
+		TagsValue += Tag.ToString();
+	}
+
+	Context.AddTag(FAssetRegistryTag(ConfigIdTag, ConfigId.ToString(), FAssetRegistryTag::TT_Alphabetical));
+	Context.AddTag(FAssetRegistryTag(DisplayNameTag, DisplayName, FAssetRegistryTag::TT_Alphabetical));
+	Context.AddTag(FAssetRegistryTag(GameplayTagsTag, TagsValue, FAssetRegistryTag::TT_Alphabetical));
+	Context.AddTag(FAssetRegistryTag(IsPlayerCharacterTag, bIsPlayerCharacter ? TEXT("True") : TEXT("False"), FAssetRegistryTag::TT_Alphabetical));
+}
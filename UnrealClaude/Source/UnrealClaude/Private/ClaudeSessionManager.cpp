@@ -16,17 +16,125 @@ FClaudeSessionManager::FClaudeSessionManager()
 void FClaudeSessionManager::AddExchange(const FString& Prompt, const FString& Response)
 {
 	ConversationHistory.Add(TPair<FString, FString>(Prompt, Response));
+	CompactedCache.AddDefaulted();
 
 	// Trim old history if exceeds max size
 	while (ConversationHistory.Num() > MaxHistorySize)
 	{
 		ConversationHistory.RemoveAt(0);
+		CompactedCache.RemoveAt(0);
 	}
 }
 
 void FClaudeSessionManager::ClearHistory()
 {
 	ConversationHistory.Empty();
+	CompactedCache.Empty();
+}
+
+const FClaudeCompactedExchange& FClaudeSessionManager::GetCompactedExchange(int32 Index) const
+{
+	check(ConversationHistory.IsValidIndex(Index));
+
+	// Keep cache aligned even if history was replaced wholesale (e.g. LoadSession)
+	if (CompactedCache.Num() != ConversationHistory.Num())
+	{
+		CompactedCache.Reset();
+		CompactedCache.SetNum(ConversationHistory.Num());
+	}
+
+	TOptional<FClaudeCompactedExchange>& Cached = CompactedCache[Index];
+	if (!Cached.IsSet())
+	{
+		const TPair<FString, FString>& Exchange = ConversationHistory[Index];
+		FClaudeCompactedExchange Compacted;
+		Compacted.Text = FormatExchange(CompactText(Exchange.Key), CompactText(Exchange.Value));
+		Compacted.EstimatedTokens = EstimateTokens(Compacted.Text);
+		Cached = MoveTemp(Compacted);
+	}
+
+	return Cached.GetValue();
+}
+
+FString FClaudeSessionManager::FormatExchange(const FString& Prompt, const FString& Response)
+{
+	return FString::Printf(TEXT("Human: %s\n\nAssistant: %s\n\n"), *Prompt, *Response);
+}
+
+FString FClaudeSessionManager::CompactText(const FString& Text)
+{
+	using namespace UnrealClaudeConstants::Session;
+
+	// Fast path: text too short to contain anything worth eliding
+	if (Text.Len() <= ElideLineMinChars && !Text.Contains(TEXT("```")))
+	{
+		return Text;
+	}
+
+	TArray<FString> Lines;
+	Text.ParseIntoArrayLines(Lines, false);
+
+	FString Result;
+	Result.Reserve(FMath::Min(Text.Len(), ElideLineMinChars * 2));
+
+	int32 LineIndex = 0;
+	while (LineIndex < Lines.Num())
+	{
+		const FString& Line = Lines[LineIndex];
+		const FString Trimmed = Line.TrimStart();
+
+		if (Trimmed.StartsWith(TEXT("```")))
+		{
+			// Find closing fence (an unterminated block runs to the end of the text)
+			int32 CloseIndex = LineIndex + 1;
+			while (CloseIndex < Lines.Num() && !Lines[CloseIndex].TrimStart().StartsWith(TEXT("```")))
+			{
+				++CloseIndex;
+			}
+
+			const int32 BodyLines = CloseIndex - LineIndex - 1;
+			if (BodyLines > ElideCodeBlockMinLines)
+			{
+				const FString Language = Trimmed.Mid(3).TrimEnd();
+				Result += FString::Printf(TEXT("[%d-line %s block elided]\n"),
+					BodyLines, Language.IsEmpty() ? TEXT("code") : *Language);
+			}
+			else
+			{
+				const int32 LastIndex = FMath::Min(CloseIndex, Lines.Num() - 1);
+				for (int32 i = LineIndex; i <= LastIndex; ++i)
+				{
+					Result += Lines[i];
+					Result += TEXT("\n");
+				}
+			}
+
+			LineIndex = CloseIndex + 1;
+			continue;
+		}
+
+		// Overlong single lines are usually tool output or minified JSON
+		if (Line.Len() > ElideLineMinChars)
+		{
+			Result += Line.Left(ElidedLineKeepChars);
+			Result += FString::Printf(TEXT("... [%d chars elided]\n"), Line.Len() - ElidedLineKeepChars);
+		}
+		else
+		{
+			Result += Line;
+			Result += TEXT("\n");
+		}
+		++LineIndex;
+	}
+
+	Result.TrimEndInline();
+	return Result;
+}
+
+int32 FClaudeSessionManager::EstimateTokens(const FString& Text)
+{
+	const int32 CharsPerToken = UnrealClaudeConstants::Session::ApproxCharsPerToken;
+	return (Text.Len() + CharsPerToken - 1) / CharsPerToken;
 }
 
 FString FClaudeSessionManager::GetSessionFilePath() const
@@ -119,6 +227,7 @@ bool FClaudeSessionManager::LoadSession()
 
 	// Clear existing history
 	ConversationHistory.Empty();
+	CompactedCache.Empty();
 
 	// Load messages array
 	TArray<TSharedPtr<FJsonValue>> MessagesArray;
@@ -134,6 +243,7 @@ bool FClaudeSessionManager::LoadSession()
 					FJsonUtils::GetStringField(*MessageObject, TEXT("assistant"), AssistantMessage))
 				{
 					ConversationHistory.Add(TPair<FString, FString>(UserMessage, AssistantMessage));
+					CompactedCache.AddDefaulted();
 				}
 			}
 		}
@@ -45,10 +45,22 @@ WHEN PROVIDING CODE:
 TOOL USAGE GUIDELINES:
 - You have dedicated MCP tools for common Unreal Editor operations. ALWAYS prefer these over execute_script:
   * spawn_actor, move_actor, delete_actors, get_level_actors, set_property - Actor manipulation
+  * spawn_actors_bulk - Many placements (transforms, grid, scatter, spline) in one call; instanced=true for plain meshes
+  * batch_edit_actors - Many move/set_property edits in one call and one undo step
+  * get_properties - Read property paths across many actors/assets as columns (audits without scripting)
+  * export_table - Write properties of many actors/assets/DataTable rows to CSV/JSONL; returns just the file path
+  * unload_actors - On World Partition maps, release actors other tools loaded for editing (after saving them)
+  * query_actors_spatial - Find actors near a point/actor, in a box, along a ray, or k-nearest
+  * get_level_changes - What changed since a version returned by get_level_actors (avoids re-listing)
+  * level_snapshot / level_diff / level_restore - Save the layout before trying variants, compare, and roll back in one undo step
   * open_level (open/new/list_templates) - Level management: open maps, create new levels, list templates
-  * blueprint_query, blueprint_modify - Blueprint inspection and editing
+  * blueprint_query, blueprint_modify - Blueprint inspection and editing (get_graph format=compact reads whole graphs cheaply; add_nodes takes the same text)
   * anim_blueprint_modify - Animation blueprint state machines
+  * compile_blueprints - Recompile every Blueprint under a folder in one dependency-ordered batch (per_asset_timing finds slow ones)
   * asset_search, asset_dependencies, asset_referencers - Asset discovery and dependency tracking
+  * asset_graph - Transitive dependencies/referencers with total on-disk size and reference chains
+  * analyze_hard_references - Rank hard references of a map/Blueprint by retained size; flags soft-reference candidates
+  * save_assets - Save many dirty assets in one batch (use save=false on material/enhanced_input/character_data, then save once)
   * capture_viewport - Screenshot the editor viewport
   * run_console_command - Run editor console commands
   * enhanced_input - Input action and mapping context management
@@ -251,15 +263,54 @@ FString FClaudeCodeSubsystem::BuildPromptWithHistory(const FString& NewPrompt) c
 		return NewPrompt;
 	}
 
+	using namespace UnrealClaudeConstants::Session;
+
+	// Walk history newest-first, keeping recent turns whole and using cached
+	// compacted forms for older ones, until the token budget is spent
+	TArray<FString> SelectedExchanges;
+	int32 RemainingTokens = HistoryTokenBudget;
+	const int32 OldestIndex = FMath::Max(0, History.Num() - MaxHistoryInPrompt);
+
+	for (int32 i = History.Num() - 1; i >= OldestIndex; --i)
+	{
+		const bool bRecent = (History.Num() - 1 - i) < RecentExchangesVerbatim;
+
+		FString ExchangeText;
+		int32 ExchangeTokens = 0;
+		if (bRecent)
+		{
+			ExchangeText = FClaudeSessionManager::FormatExchange(History[i].Key, History[i].Value);
+			ExchangeTokens = FClaudeSessionManager::EstimateTokens(ExchangeText);
+		}
+
+		// Older turns, or recent turns too large for what's left, fall back to the compacted form
+		if (!bRecent || ExchangeTokens > RemainingTokens)
+		{
+			const FClaudeCompactedExchange& Compacted = SessionManager->GetCompactedExchange(i);
+			ExchangeText = Compacted.Text;
+			ExchangeTokens = Compacted.EstimatedTokens;
+		}
+
+		if (ExchangeTokens > RemainingTokens)
+		{
+			break;
+		}
+
+		RemainingTokens -= ExchangeTokens;
+		SelectedExchanges.Add(MoveTemp(ExchangeText));
+	}
+
 	FString PromptWithHistory;
 
-	// Include recent history (limit to last N exchanges)
-	int32 StartIndex = FMath::Max(0, History.Num() - UnrealClaudeConstants::Session::MaxHistoryInPrompt);
+	const int32 OmittedCount = History.Num() - SelectedExchanges.Num();
+	if (OmittedCount > 0)
+	{
+		PromptWithHistory += FString::Printf(TEXT("[%d earlier exchange(s) omitted]\n\n"), OmittedCount);
+	}
 
-	for (int32 i = StartIndex; i < History.Num(); ++i)
+	for (int32 i = SelectedExchanges.Num() - 1; i >= 0; --i)
 	{
-		const TPair<FString, FString>& Exchange = History[i];
-		PromptWithHistory += FString::Printf(TEXT("Human: %s\n\nAssistant: %s\n\n"), *Exchange.Key, *Exchange.Value);
+		PromptWithHistory += SelectedExchanges[i];
 	}
 
 	PromptWithHistory += FString::Printf(TEXT("Human: %s"), *NewPrompt);
@@ -0,0 +1,229 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPActorIndex.h"
+#include "UnrealClaudeModule.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "GameFramework/Actor.h"
+#include "EngineUtils.h"
+#include "Misc/CoreDelegates.h"
+
+FMCPActorIndex& FMCPActorIndex::Get()
+{
+	static FMCPActorIndex Instance;
+	return Instance;
+}
+
+void FMCPActorIndex::Initialize()
+{
+	if (bInitialized || !GEngine)
+	{
+		return;
+	}
+
+	ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FMCPActorIndex::OnActorAdded);
+	ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FMCPActorIndex::OnActorDeleted);
+	ActorListChangedHandle = GEngine->OnLevelActorListChanged().AddRaw(this, &FMCPActorIndex::InvalidateAll);
+	ActorLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(this, &FMCPActorIndex::OnActorLabelChanged);
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddRaw(this, &FMCPActorIndex::OnLevelChanged);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddRaw(this, &FMCPActorIndex::OnLevelChanged);
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(this, &FMCPActorIndex::OnWorldCleanup);
+	MapChangeHandle = FEditorDelegates::MapChange.AddLambda([this](uint32) { InvalidateAll(); });
+	UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FMCPActorIndex::InvalidateAll);
+
+	bInitialized = true;
+	UE_LOG(LogUnrealClaude, Log, TEXT("Actor name index initialized"));
+}
+
+void FMCPActorIndex::Shutdown()
+{
+	if (!bInitialized)
+	{
+		return;
+	}
+
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+		GEngine->OnLevelActorListChanged().Remove(ActorListChangedHandle);
+	}
+	FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelChangedHandle);
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+	FEditorDelegates::MapChange.Remove(MapChangeHandle);
+	FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+
+	WorldIndexes.Empty();
+	bInitialized = false;
+}
+
+AActor* FMCPActorIndex::FindActor(UWorld* World, const FString& NameOrLabel, const UClass* RequiredClass)
+{
+	if (!World || NameOrLabel.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	// Without delegates the index could go stale, so fall back to a direct scan
+	if (!bInitialized)
+	{
+		for (TActorIterator<AActor> It(World); It; ++It)
+		{
+			AActor* Actor = *It;
+			if (Actor && (!RequiredClass || Actor->IsA(RequiredClass)) &&
+				(Actor->GetName() == NameOrLabel || Actor->GetActorLabel() == NameOrLabel))
+			{
+				return Actor;
+			}
+		}
+		return nullptr;
+	}
+
+	FWorldIndex& Index = GetOrBuildIndex(World);
+
+	auto IsMatch = [RequiredClass](const TWeakObjectPtr<AActor>& Candidate) -> AActor*
+	{
+		AActor* Actor = Candidate.Get();
+		if (IsValid(Actor) && (!RequiredClass || Actor->IsA(RequiredClass)))
+		{
+			return Actor;
+		}
+		return nullptr;
+	};
+
+	// FNAME_Find avoids growing the name table; an unknown name cannot match any actor
+	const FName Name(*NameOrLabel, FNAME_Find);
+	if (!Name.IsNone())
+	{
+		for (auto It = Index.ByName.CreateConstKeyIterator(Name); It; ++It)
+		{
+			// Guard against entries left behind by an object rename
+			AActor* Actor = IsMatch(It.Value());
+			if (Actor && Actor->GetFName() == Name)
+			{
+				return Actor;
+			}
+		}
+	}
+
+	for (auto It = Index.ByLabel.CreateConstKeyIterator(NameOrLabel); It; ++It)
+	{
+		if (AActor* Actor = IsMatch(It.Value()))
+		{
+			return Actor;
+		}
+	}
+
+	return nullptr;
+}
+
+void FMCPActorIndex::InvalidateWorld(UWorld* World)
+{
+	if (World)
+	{
+		WorldIndexes.Remove(TObjectKey<UWorld>(World));
+	}
+}
+
+void FMCPActorIndex::InvalidateAll()
+{
+	WorldIndexes.Empty();
+}
+
+FMCPActorIndex::FWorldIndex& FMCPActorIndex::GetOrBuildIndex(UWorld* World)
+{
+	const TObjectKey<UWorld> Key(World);
+	if (FWorldIndex* Existing = WorldIndexes.Find(Key))
+	{
+		return *Existing;
+	}
+
+	FWorldIndex& Index = WorldIndexes.Add(Key);
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		if (AActor* Actor = *It)
+		{
+			AddActor(Index, Actor);
+		}
+	}
+
+	UE_LOG(LogUnrealClaude, Verbose, TEXT("Built actor name index for %s (%d actors)"),
+		*World->GetMapName(), Index.LabelByActor.Num());
+	return Index;
+}
+
+void FMCPActorIndex::AddActor(FWorldIndex& Index, AActor* Actor)
+{
+	const TObjectKey<AActor> ActorKey(Actor);
+	if (Index.LabelByActor.Contains(ActorKey))
+	{
+		return;
+	}
+
+	const FString Label = Actor->GetActorLabel();
+	Index.ByName.Add(Actor->GetFName(), Actor);
+	Index.ByLabel.Add(Label, Actor);
+	Index.LabelByActor.Add(ActorKey, Label);
+}
+
+void FMCPActorIndex::RemoveActor(FWorldIndex& Index, AActor* Actor)
+{
+	FString OldLabel;
+	if (!Index.LabelByActor.RemoveAndCopyValue(TObjectKey<AActor>(Actor), OldLabel))
+	{
+		return;
+	}
+
+	const TWeakObjectPtr<AActor> WeakActor(Actor);
+	Index.ByName.RemoveSingle(Actor->GetFName(), WeakActor);
+	Index.ByLabel.RemoveSingle(OldLabel, WeakActor);
+}
+
+FMCPActorIndex::FWorldIndex* FMCPActorIndex::FindIndexForActor(const AActor* Actor)
+{
+	if (!Actor)
+	{
+		return nullptr;
+	}
+	UWorld* World = Actor->GetWorld();
+	return World ? WorldIndexes.Find(TObjectKey<UWorld>(World)) : nullptr;
+}
+
+void FMCPActorIndex::OnActorAdded(AActor* Actor)
+{
+	if (FWorldIndex* Index = FindIndexForActor(Actor))
+	{
+		AddActor(*Index, Actor);
+	}
+}
+
+void FMCPActorIndex::OnActorDeleted(AActor* Actor)
+{
+	if (FWorldIndex* Index = FindIndexForActor(Actor))
+	{
+		RemoveActor(*Index, Actor);
+	}
+}
+
+void FMCPActorIndex::OnActorLabelChanged(AActor* Actor)
+{
+	if (FWorldIndex* Index = FindIndexForActor(Actor))
+	{
+		RemoveActor(*Index, Actor);
+		AddActor(*Index, Actor);
+	}
+}
+
+void FMCPActorIndex::OnLevelChanged(ULevel* Level, UWorld* World)
+{
+	InvalidateWorld(World);
+}
+
+void FMCPActorIndex::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	InvalidateWorld(World);
+}
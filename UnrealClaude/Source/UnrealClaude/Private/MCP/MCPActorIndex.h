@@ -0,0 +1,99 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class AActor;
+class ULevel;
+class UWorld;
+
+/**
+ * Per-world hash index of actors by object name and editor label
+ *
+ * Each world's index is built lazily on first lookup (one actor iteration) and
+ * then kept current from editor actor add/delete/label-change delegates, so
+ * name lookups from MCP tools are O(1) instead of a full world walk per name.
+ * Events that can change the actor set wholesale (level streaming, undo/redo,
+ * map change) drop the affected world's index so it is rebuilt on next use.
+ *
+ * Game thread only.
+ */
+class FMCPActorIndex
+{
+public:
+	static FMCPActorIndex& Get();
+
+	/** Bind editor delegates (call once at module startup) */
+	void Initialize();
+
+	/** Unbind delegates and drop all indexes (call at module shutdown) */
+	void Shutdown();
+
+	/**
+	 * Find an actor by object name or label
+	 * Object-name matches take precedence over label matches
+	 * @param World - World to search
+	 * @param NameOrLabel - Actor name or label (case-insensitive)
+	 * @param RequiredClass - Optional class the actor must be a child of
+	 * @return The actor, or nullptr if none matches
+	 */
+	AActor* FindActor(UWorld* World, const FString& NameOrLabel, const UClass* RequiredClass = nullptr);
+
+	/** Drop the index for a world (rebuilt lazily on next lookup) */
+	void InvalidateWorld(UWorld* World);
+
+	/** Drop all indexes */
+	void InvalidateAll();
+
+private:
+	FMCPActorIndex() = default;
+
+	/** Lookup tables for a single world */
+	struct FWorldIndex
+	{
+		/** Object name -> actors (names are unique per level, not per world) */
+		TMultiMap<FName, TWeakObjectPtr<AActor>> ByName;
+
+		/** Label -> actors (labels are not unique) */
+		TMultiMap<FString, TWeakObjectPtr<AActor>> ByLabel;
+
+		/** Reverse map so a label change can remove the old label entry */
+		TMap<TObjectKey<AActor>, FString> LabelByActor;
+	};
+
+	/** Get the index for a world, building it if needed */
+	FWorldIndex& GetOrBuildIndex(UWorld* World);
+
+	/** Add an actor to a world index */
+	static void AddActor(FWorldIndex& Index, AActor* Actor);
+
+	/** Remove an actor from a world index */
+	static void RemoveActor(FWorldIndex& Index, AActor* Actor);
+
+	/** Find the index owning an actor, or nullptr if that world is not indexed */
+	FWorldIndex* FindIndexForActor(const AActor* Actor);
+
+	// Delegate handlers
+	void OnActorAdded(AActor* Actor);
+	void OnActorDeleted(AActor* Actor);
+	void OnActorLabelChanged(AActor* Actor);
+	void OnLevelChanged(ULevel* Level, UWorld* World);
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+	/** Indexes keyed by world */
+	TMap<TObjectKey<UWorld>, FWorldIndex> WorldIndexes;
+
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle ActorListChangedHandle;
+	FDelegateHandle ActorLabelChangedHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+	FDelegateHandle WorldCleanupHandle;
+	FDelegateHandle MapChangeHandle;
+	FDelegateHandle UndoRedoHandle;
+
+	bool bInitialized = false;
+};
@@ -0,0 +1,334 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPAssetNameIndex.h"
+#include "UnrealClaudeModule.h"
+#include "UnrealClaudeConstants.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+
+using namespace UnrealClaudeConstants::AssetNameIndex;
+
+namespace
+{
+	const FName AssetRegistryModuleName(TEXT("AssetRegistry"));
+
+	struct FCandidate
+	{
+		int32 EntryIndex;
+		EMCPAssetMatchTier Tier;
+		float Similarity;
+	};
+}
+
+FMCPAssetNameIndex& FMCPAssetNameIndex::Get()
+{
+	static FMCPAssetNameIndex Instance;
+	return Instance;
+}
+
+void FMCPAssetNameIndex::Initialize()
+{
+	if (bInitialized)
+	{
+		return;
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryModuleName).Get();
+	AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FMCPAssetNameIndex::OnAssetAdded);
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FMCPAssetNameIndex::OnAssetRemoved);
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FMCPAssetNameIndex::OnAssetRenamed);
+
+	bInitialized = true;
+	UE_LOG(LogUnrealClaude, Log, TEXT("Asset name index initialized"));
+}
+
+void FMCPAssetNameIndex::Shutdown()
+{
+	if (!bInitialized)
+	{
+		return;
+	}
+
+	// The registry may already be gone during editor shutdown
+	if (FAssetRegistryModule* Module = FModuleManager::GetModulePtr<FAssetRegistryModule>(AssetRegistryModuleName))
+	{
+		IAssetRegistry& AssetRegistry = Module->Get();
+		AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+	}
+
+	Invalidate();
+	bInitialized = false;
+}
+
+void FMCPAssetNameIndex::Invalidate()
+{
+	Entries.Empty();
+	EntryByPath.Empty();
+	Postings.Empty();
+	HitCounts.Empty();
+	RemovedCount = 0;
+	bBuilt = false;
+}
+
+const TCHAR* FMCPAssetNameIndex::TierToString(EMCPAssetMatchTier Tier)
+{
+	switch (Tier)
+	{
+	case EMCPAssetMatchTier::Exact: return TEXT("exact");
+	case EMCPAssetMatchTier::Prefix: return TEXT("prefix");
+	case EMCPAssetMatchTier::Substring: return TEXT("substring");
+	default: return TEXT("fuzzy");
+	}
+}
+
+void FMCPAssetNameIndex::Search(const FString& Query, const TSet<FTopLevelAssetPath>& ClassPaths, const FString& PathPrefix,
+	bool bIncludeFuzzy, TArray<FMCPAssetMatch>& OutMatches)
+{
+	OutMatches.Reset();
+	if (Query.IsEmpty())
+	{
+		return;
+	}
+
+	BuildIfNeeded();
+
+	const FString LowerQuery = Query.ToLower();
+	FString Folder = PathPrefix;
+	while (Folder.Len() > 1 && Folder.EndsWith(TEXT("/")))
+	{
+		Folder.LeftChopInline(1);
+	}
+
+	auto PassesFilters = [&ClassPaths, &Folder](const FEntry& Entry)
+	{
+		if (!Entry.bLive || (ClassPaths.Num() > 0 && !ClassPaths.Contains(Entry.ClassPath)))
+		{
+			return false;
+		}
+		if (Folder.IsEmpty() || Folder == TEXT("/"))
+		{
+			return true;
+		}
+		return Entry.PackagePath.StartsWith(Folder, ESearchCase::IgnoreCase) &&
+			(Entry.PackagePath.Len() == Folder.Len() || Entry.PackagePath[Folder.Len()] == TEXT('/'));
+	};
+
+	auto ContainedTier = [&LowerQuery](const FEntry& Entry)
+	{
+		if (Entry.LowerName.Len() == LowerQuery.Len())
+		{
+			return EMCPAssetMatchTier::Exact;
+		}
+		return Entry.LowerName.StartsWith(LowerQuery, ESearchCase::CaseSensitive)
+			? EMCPAssetMatchTier::Prefix
+			: EMCPAssetMatchTier::Substring;
+	};
+
+	TArray<FCandidate> Candidates;
+	TArray<uint64> QueryTrigrams;
+	GetTrigrams(LowerQuery, QueryTrigrams);
+
+	if (QueryTrigrams.Num() == 0)
+	{
+		// Too short for trigrams; a scan over the pre-lowered names is still allocation-free
+		for (int32 i = 0; i < Entries.Num(); ++i)
+		{
+			const FEntry& Entry = Entries[i];
+			if (PassesFilters(Entry) && Entry.LowerName.Contains(LowerQuery, ESearchCase::CaseSensitive))
+			{
+				Candidates.Add({ i, ContainedTier(Entry), 1.0f });
+			}
+		}
+	}
+	else
+	{
+		// Count how many of the query's trigrams each name has
+		HitCounts.SetNumZeroed(Entries.Num());
+		TArray<int32> Touched;
+		for (const uint64 Trigram : QueryTrigrams)
+		{
+			if (const TArray<int32>* Posting = Postings.Find(Trigram))
+			{
+				for (const int32 EntryIndex : *Posting)
+				{
+					if (HitCounts[EntryIndex]++ == 0)
+					{
+						Touched.Add(EntryIndex);
+					}
+				}
+			}
+		}
+
+		const int32 TrigramCount = QueryTrigrams.Num();
+		const int32 MinHits = bIncludeFuzzy
+			? FMath::Max(1, FMath::CeilToInt(TrigramCount * FuzzyMinSimilarity))
+			: TrigramCount;
+
+		for (const int32 EntryIndex : Touched)
+		{
+			const int32 Hits = HitCounts[EntryIndex];
+			HitCounts[EntryIndex] = 0;
+
+			const FEntry& Entry = Entries[EntryIndex];
+			if (Hits < MinHits || !PassesFilters(Entry))
+			{
+				continue;
+			}
+
+			// Having every trigram is necessary but not sufficient for containment
+			if (Hits == TrigramCount && Entry.LowerName.Contains(LowerQuery, ESearchCase::CaseSensitive))
+			{
+				Candidates.Add({ EntryIndex, ContainedTier(Entry), 1.0f });
+			}
+			else if (bIncludeFuzzy)
+			{
+				Candidates.Add({ EntryIndex, EMCPAssetMatchTier::Fuzzy, static_cast<float>(Hits) / TrigramCount });
+			}
+		}
+	}
+
+	// Best tier first, then closest fuzzy match, then shortest (most specific) name
+	Candidates.Sort([this](const FCandidate& A, const FCandidate& B)
+	{
+		if (A.Tier != B.Tier)
+		{
+			return A.Tier < B.Tier;
+		}
+		if (A.Similarity != B.Similarity)
+		{
+			return A.Similarity > B.Similarity;
+		}
+		const FString& NameA = Entries[A.EntryIndex].LowerName;
+		const FString& NameB = Entries[B.EntryIndex].LowerName;
+		if (NameA.Len() != NameB.Len())
+		{
+			return NameA.Len() < NameB.Len();
+		}
+		return NameA < NameB;
+	});
+
+	OutMatches.Reserve(Candidates.Num());
+	for (const FCandidate& Candidate : Candidates)
+	{
+		FMCPAssetMatch& Match = OutMatches.AddDefaulted_GetRef();
+		Match.ObjectPath = Entries[Candidate.EntryIndex].ObjectPath;
+		Match.Tier = Candidate.Tier;
+		Match.Similarity = Candidate.Similarity;
+	}
+}
+
+void FMCPAssetNameIndex::BuildIfNeeded()
+{
+	if (bBuilt)
+	{
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryModuleName).Get();
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAllAssets(Assets);
+
+	Entries.Reserve(Assets.Num());
+	EntryByPath.Reserve(Assets.Num());
+	for (const FAssetData& AssetData : Assets)
+	{
+		AddAsset(AssetData);
+	}
+	bBuilt = true;
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Asset name index built: %d assets, %d trigrams in %.1f ms"),
+		EntryByPath.Num(), Postings.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void FMCPAssetNameIndex::AddAsset(const FAssetData& AssetData)
+{
+	if (!AssetData.IsValid() || AssetData.IsRedirector())
+	{
+		return;
+	}
+
+	const FSoftObjectPath ObjectPath = AssetData.GetSoftObjectPath();
+	if (EntryByPath.Contains(ObjectPath))
+	{
+		RemoveAsset(ObjectPath);
+	}
+
+	const int32 EntryIndex = Entries.Num();
+	FEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.ObjectPath = ObjectPath;
+	Entry.ClassPath = AssetData.AssetClassPath;
+	Entry.PackagePath = AssetData.PackagePath.ToString();
+	Entry.LowerName = AssetData.AssetName.ToString().ToLower();
+	EntryByPath.Add(ObjectPath, EntryIndex);
+
+	TArray<uint64> Trigrams;
+	GetTrigrams(Entry.LowerName, Trigrams);
+	for (const uint64 Trigram : Trigrams)
+	{
+		Postings.FindOrAdd(Trigram).Add(EntryIndex);
+	}
+}
+
+void FMCPAssetNameIndex::RemoveAsset(const FSoftObjectPath& ObjectPath)
+{
+	int32 EntryIndex = INDEX_NONE;
+	if (!EntryByPath.RemoveAndCopyValue(ObjectPath, EntryIndex))
+	{
+		return;
+	}
+
+	Entries[EntryIndex].bLive = false;
+	RemovedCount++;
+
+	// Dead entries still cost time in posting lists; start over once there are many
+	if (RemovedCount > Entries.Num() * RebuildRemovedFraction)
+	{
+		Invalidate();
+	}
+}
+
+void FMCPAssetNameIndex::GetTrigrams(const FString& LowerText, TArray<uint64>& OutTrigrams)
+{
+	OutTrigrams.Reset();
+	for (int32 i = 0; i + 2 < LowerText.Len(); ++i)
+	{
+		// Code points fit in 21 bits, so three of them pack into one key
+		const uint64 Key =
+			(static_cast<uint64>(LowerText[i] & 0x1FFFFF) << 42) |
+			(static_cast<uint64>(LowerText[i + 1] & 0x1FFFFF) << 21) |
+			static_cast<uint64>(LowerText[i + 2] & 0x1FFFFF);
+		OutTrigrams.AddUnique(Key);
+	}
+}
+
+void FMCPAssetNameIndex::OnAssetAdded(const FAssetData& AssetData)
+{
+	if (bBuilt)
+	{
+		AddAsset(AssetData);
+	}
+}
+
+void FMCPAssetNameIndex::OnAssetRemoved(const FAssetData& AssetData)
+{
+	if (bBuilt)
+	{
+		RemoveAsset(AssetData.GetSoftObjectPath());
+	}
+}
+
+void FMCPAssetNameIndex::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	if (bBuilt)
+	{
+		RemoveAsset(FSoftObjectPath(OldObjectPath));
+		if (bBuilt)
+		{
+			AddAsset(AssetData);
+		}
+	}
+}
@@ -0,0 +1,113 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/TopLevelAssetPath.h"
+
+struct FAssetData;
+
+/** How an asset name matched a search query, best first */
+enum class EMCPAssetMatchTier : uint8
+{
+	Exact,
+	Prefix,
+	Substring,
+	Fuzzy
+};
+
+/** One ranked search hit */
+struct FMCPAssetMatch
+{
+	FSoftObjectPath ObjectPath;
+	EMCPAssetMatchTier Tier = EMCPAssetMatchTier::Fuzzy;
+
+	/** Fraction of the query's trigrams found in the name (1 for non-fuzzy tiers) */
+	float Similarity = 1.0f;
+};
+
+/**
+ * In-memory trigram index over asset names
+ *
+ * Built lazily from the asset registry on first search, then kept current
+ * from registry add/remove/rename events. A query's trigrams are looked up
+ * in posting lists to find candidates, so name searches touch only assets
+ * that share text with the query instead of scanning and stringifying every
+ * asset. Results are ranked exact > prefix > substring > fuzzy (names that
+ * share enough trigrams with the query, which tolerates typos).
+ *
+ * Game thread only.
+ */
+class FMCPAssetNameIndex
+{
+public:
+	static FMCPAssetNameIndex& Get();
+
+	/** Bind asset registry events (call once at module startup) */
+	void Initialize();
+
+	/** Unbind events and drop the index (call at module shutdown) */
+	void Shutdown();
+
+	/**
+	 * Search asset names
+	 * @param Query - Name text to look for (case-insensitive)
+	 * @param ClassPaths - If non-empty, only assets of these classes match
+	 * @param PathPrefix - If non-empty, only assets under this package path match
+	 * @param bIncludeFuzzy - Include near matches that do not contain the query
+	 * @param OutMatches - Ranked matches
+	 */
+	void Search(const FString& Query, const TSet<FTopLevelAssetPath>& ClassPaths, const FString& PathPrefix,
+		bool bIncludeFuzzy, TArray<FMCPAssetMatch>& OutMatches);
+
+	/** Drop the index (rebuilt lazily on next search) */
+	void Invalidate();
+
+	/** Number of indexed assets (0 until the first search builds the index) */
+	int32 Num() const { return EntryByPath.Num(); }
+
+	/** Lower-case name for a match tier, as reported to clients */
+	static const TCHAR* TierToString(EMCPAssetMatchTier Tier);
+
+private:
+	FMCPAssetNameIndex() = default;
+
+	struct FEntry
+	{
+		FSoftObjectPath ObjectPath;
+		FTopLevelAssetPath ClassPath;
+		FString PackagePath;
+		FString LowerName;
+
+		/** Cleared on removal; postings are left in place until the next rebuild */
+		bool bLive = true;
+	};
+
+	void BuildIfNeeded();
+	void AddAsset(const FAssetData& AssetData);
+	void RemoveAsset(const FSoftObjectPath& ObjectPath);
+
+	/** Distinct trigram keys of a lower-case string */
+	static void GetTrigrams(const FString& LowerText, TArray<uint64>& OutTrigrams);
+
+	// Registry event handlers
+	void OnAssetAdded(const FAssetData& AssetData);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+	TArray<FEntry> Entries;
+	TMap<FSoftObjectPath, int32> EntryByPath;
+	TMap<uint64, TArray<int32>> Postings;
+
+	/** Per-entry trigram hit counts, reused between searches */
+	TArray<uint16> HitCounts;
+
+	int32 RemovedCount = 0;
+	bool bBuilt = false;
+
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	bool bInitialized = false;
+};
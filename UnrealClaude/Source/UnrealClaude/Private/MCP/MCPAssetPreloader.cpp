@@ -0,0 +1,231 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPAssetPreloader.h"
+#include "MCPToolRegistry.h"
+#include "UnrealClaudeConstants.h"
+#include "Async/Async.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+
+using namespace UnrealClaudeConstants::AssetPreload;
+
+namespace
+{
+	/**
+	 * State shared by the waiting worker and the game thread
+	 * Everything except bAbandoned is written on the game thread before DoneEvent
+	 * is triggered, and only read by the worker after it fires.
+	 */
+	struct FPreloadState
+	{
+		int32 Requested = 0;
+		int32 AlreadyLoaded = 0;
+		int32 Loaded = 0;
+		TArray<FSoftObjectPath> PendingPaths;
+		TArray<FString> Failed;
+		TSharedPtr<FStreamableHandle> Handle;
+		TSharedPtr<FEvent, ESPMode::ThreadSafe> DoneEvent;
+
+		/** Set by the worker when it stops waiting; the game thread then skips or cancels the request */
+		FThreadSafeBool bAbandoned = false;
+
+		/** Game thread only: the handle is stored / the loads have completed */
+		bool bRequestIssued = false;
+		bool bLoadsFinished = false;
+	};
+
+	using FPreloadStateRef = TSharedRef<FPreloadState, ESPMode::ThreadSafe>;
+
+	/** Game thread: loads completed (may run inside RequestAsyncLoad, before the handle is stored) */
+	void OnLoadsFinished(FPreloadState& State)
+	{
+		State.bLoadsFinished = true;
+		for (const FSoftObjectPath& Path : State.PendingPaths)
+		{
+			if (Path.ResolveObject())
+			{
+				++State.Loaded;
+			}
+			else
+			{
+				State.Failed.Add(Path.ToString());
+			}
+		}
+		if (State.bRequestIssued)
+		{
+			State.DoneEvent->Trigger();
+		}
+	}
+
+	/** Game thread: collect the tool's assets and issue one batched async request */
+	void IssueRequest(const FPreloadStateRef& State, IMCPTool* Tool, const TSharedRef<FJsonObject>& Params)
+	{
+		if (State->bAbandoned)
+		{
+			return;
+		}
+
+		TArray<FSoftObjectPath> Declared;
+		Tool->GetRequiredAssets(Params, Declared);
+		if (Declared.Num() > MaxAssets)
+		{
+			Declared.SetNum(MaxAssets);
+		}
+		State->Requested = Declared.Num();
+
+		for (const FSoftObjectPath& Path : Declared)
+		{
+			if (Path.ResolveObject())
+			{
+				++State->AlreadyLoaded;
+			}
+			else
+			{
+				State->PendingPaths.Add(Path);
+			}
+		}
+
+		if (State->PendingPaths.Num() == 0 || !UAssetManager::IsInitialized())
+		{
+			State->PendingPaths.Reset();
+			State->bRequestIssued = true;
+			State->DoneEvent->Trigger();
+			return;
+		}
+
+		TWeakPtr<FPreloadState, ESPMode::ThreadSafe> WeakState = State;
+		State->Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+			State->PendingPaths,
+			FStreamableDelegate::CreateLambda([WeakState]()
+			{
+				if (TSharedPtr<FPreloadState, ESPMode::ThreadSafe> Pinned = WeakState.Pin())
+				{
+					OnLoadsFinished(*Pinned);
+				}
+			}),
+			FStreamableManager::AsyncLoadHighPriority);
+
+		State->bRequestIssued = true;
+		if (!State->Handle.IsValid() && !State->bLoadsFinished)
+		{
+			// Nothing valid to stream; let the tool report the bad paths
+			OnLoadsFinished(*State);
+		}
+		if (State->bLoadsFinished)
+		{
+			State->DoneEvent->Trigger();
+		}
+	}
+}
+
+TSharedPtr<FJsonObject> FMCPAssetPreloadResult::ToJson() const
+{
+	if (Requested == 0)
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+	Json->SetNumberField(TEXT("requested"), Requested);
+	Json->SetNumberField(TEXT("alreadyLoaded"), AlreadyLoaded);
+	Json->SetNumberField(TEXT("loaded"), Loaded);
+	Json->SetNumberField(TEXT("seconds"), Seconds);
+	if (bTimedOut)
+	{
+		Json->SetBoolField(TEXT("timedOut"), true);
+	}
+	if (Failed.Num() > 0)
+	{
+		TArray<TSharedPtr<FJsonValue>> FailedArray;
+		for (const FString& Path : Failed)
+		{
+			FailedArray.Add(MakeShared<FJsonValueString>(Path));
+		}
+		Json->SetArrayField(TEXT("failed"), FailedArray);
+	}
+	return Json;
+}
+
+FMCPAssetPreloadResult FMCPAssetPreloader::Preload(IMCPTool* Tool, const TSharedRef<FJsonObject>& Params,
+	uint32 TimeoutMs, const FThreadSafeBool& bCancellationRequested)
+{
+	FMCPAssetPreloadResult Result;
+
+	// Waiting on the game thread would stall the loads it is waiting for
+	if (!Tool || !Tool->HasRequiredAssets() || IsInGameThread())
+	{
+		return Result;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	FPreloadStateRef State = MakeShared<FPreloadState, ESPMode::ThreadSafe>();
+	State->DoneEvent = MakeShareable(
+		FPlatformProcess::GetSynchEventFromPool(),
+		[](FEvent* Event) { FPlatformProcess::ReturnSynchEventToPool(Event); });
+
+	AsyncTask(ENamedThreads::GameThread, [State, Tool, Params]()
+	{
+		IssueRequest(State, Tool, Params);
+	});
+
+	const double Deadline = StartTime + TimeoutMs / 1000.0;
+	bool bDone = false;
+	while (!(bDone = State->DoneEvent->Wait(PollIntervalMs)))
+	{
+		if (bCancellationRequested)
+		{
+			Result.bCancelled = true;
+			break;
+		}
+		if (FPlatformTime::Seconds() >= Deadline)
+		{
+			Result.bTimedOut = true;
+			break;
+		}
+	}
+
+	Result.Seconds = FPlatformTime::Seconds() - StartTime;
+
+	if (!bDone)
+	{
+		// Runs after IssueRequest (game thread tasks are ordered), so the handle is either set or never will be
+		State->bAbandoned = true;
+		AsyncTask(ENamedThreads::GameThread, [State]()
+		{
+			if (State->Handle.IsValid())
+			{
+				State->Handle->CancelHandle();
+				State->Handle.Reset();
+			}
+		});
+		return Result;
+	}
+
+	Result.Requested = State->Requested;
+	Result.AlreadyLoaded = State->AlreadyLoaded;
+	Result.Loaded = State->AlreadyLoaded + State->Loaded;
+	Result.Failed = MoveTemp(State->Failed);
+	Result.Handle = State->Handle;
+	return Result;
+}
+
+void FMCPAssetPreloader::Release(FMCPAssetPreloadResult& Result)
+{
+	TSharedPtr<FStreamableHandle> Handle = MoveTemp(Result.Handle);
+	if (!Handle.IsValid())
+	{
+		return;
+	}
+
+	if (IsInGameThread())
+	{
+		Handle->ReleaseHandle();
+		return;
+	}
+
+	AsyncTask(ENamedThreads::GameThread, [Handle]()
+	{
+		Handle->ReleaseHandle();
+	});
+}
@@ -0,0 +1,67 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "HAL/ThreadSafeBool.h"
+
+class IMCPTool;
+struct FStreamableHandle;
+
+/** Outcome of streaming in the assets a tool declared */
+struct FMCPAssetPreloadResult
+{
+	/** Assets the tool declared (after the MaxAssets cap) */
+	int32 Requested = 0;
+
+	/** Declared assets that were already in memory */
+	int32 AlreadyLoaded = 0;
+
+	/** Assets resident after streaming finished */
+	int32 Loaded = 0;
+
+	/** Declared assets that could not be loaded (Execute reports them) */
+	TArray<FString> Failed;
+
+	bool bTimedOut = false;
+	bool bCancelled = false;
+	double Seconds = 0.0;
+
+	/** Keeps the streamed assets referenced until Release */
+	TSharedPtr<FStreamableHandle> Handle;
+
+	/** Summary for the task result; null when nothing was declared */
+	TSharedPtr<FJsonObject> ToJson() const;
+};
+
+/**
+ * Streams in the assets a tool declares through IMCPTool::GetRequiredAssets
+ * before its game-thread part runs, so a tool touching many assets waits on
+ * one batched async request instead of a chain of synchronous loads.
+ *
+ * Preload is called from a task-queue worker thread and only blocks that
+ * worker: the request is issued on the game thread, which keeps ticking while
+ * the async loader works. The wait honours task cancellation and the task
+ * timeout; the task queue fails a task whose preload used its whole timeout.
+ * Tools that do not override HasRequiredAssets return at once, without a
+ * game-thread round trip. Uses the asset manager's streamable manager;
+ * without one it does nothing.
+ */
+class FMCPAssetPreloader
+{
+public:
+	/**
+	 * Stream in a tool's declared assets and wait for them
+	 * @param Tool - Tool about to execute
+	 * @param Params - Parameters it will execute with
+	 * @param TimeoutMs - Longest time to wait for the loads
+	 * @param bCancellationRequested - Task cancellation flag, polled while waiting
+	 * @return What was loaded; pass to Release once the tool has finished
+	 */
+	static FMCPAssetPreloadResult Preload(IMCPTool* Tool, const TSharedRef<FJsonObject>& Params,
+		uint32 TimeoutMs, const FThreadSafeBool& bCancellationRequested);
+
+	/** Drop the references taken by Preload (any thread) */
+	static void Release(FMCPAssetPreloadResult& Result);
+};
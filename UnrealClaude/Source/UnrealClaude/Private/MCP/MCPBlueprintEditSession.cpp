@@ -0,0 +1,193 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPBlueprintEditSession.h"
+#include "BlueprintLoader.h"
+#include "UnrealClaudeConstants.h"
+#include "UnrealClaudeModule.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+
+using namespace UnrealClaudeConstants::BlueprintEditSession;
+
+FMCPBlueprintEditSessions& FMCPBlueprintEditSessions::Get()
+{
+	static FMCPBlueprintEditSessions Instance;
+	return Instance;
+}
+
+void FMCPBlueprintEditSessions::Initialize()
+{
+	if (bInitialized)
+	{
+		return;
+	}
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FMCPBlueprintEditSessions::Tick), IdleCheckIntervalSeconds);
+	MapChangeHandle = FEditorDelegates::MapChange.AddLambda([this](uint32) { CommitAll(TEXT("map changed")); });
+	PreBeginPIEHandle = FEditorDelegates::PreBeginPIE.AddLambda([this](bool) { CommitAll(TEXT("play in editor")); });
+
+	bInitialized = true;
+}
+
+void FMCPBlueprintEditSessions::Shutdown()
+{
+	if (!bInitialized)
+	{
+		return;
+	}
+
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	FEditorDelegates::MapChange.Remove(MapChangeHandle);
+	FEditorDelegates::PreBeginPIE.Remove(PreBeginPIEHandle);
+	Sessions.Empty();
+	bInitialized = false;
+}
+
+bool FMCPBlueprintEditSessions::Begin(UBlueprint* Blueprint)
+{
+	if (!Blueprint)
+	{
+		return false;
+	}
+
+	RemoveStaleSessions();
+
+	const FObjectKey Key(Blueprint);
+	if (Sessions.Contains(Key))
+	{
+		return false;
+	}
+
+	FMCPBlueprintEditSession& Session = Sessions.Add(Key);
+	Session.Blueprint = Blueprint;
+	Session.StartedTime = FDateTime::UtcNow();
+	Session.LastChangeTime = Session.StartedTime;
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Blueprint edit session opened: %s"), *Blueprint->GetPathName());
+	return true;
+}
+
+bool FMCPBlueprintEditSessions::RecordChange(const UBlueprint* Blueprint, const FString& OperationName)
+{
+	if (!Blueprint)
+	{
+		return false;
+	}
+
+	FMCPBlueprintEditSession* Session = Sessions.Find(FObjectKey(Blueprint));
+	if (!Session)
+	{
+		return false;
+	}
+
+	Session->PendingOperations.Add(OperationName);
+	Session->LastChangeTime = FDateTime::UtcNow();
+	return true;
+}
+
+const FMCPBlueprintEditSession* FMCPBlueprintEditSessions::Find(const UBlueprint* Blueprint) const
+{
+	return Blueprint ? Sessions.Find(FObjectKey(Blueprint)) : nullptr;
+}
+
+bool FMCPBlueprintEditSessions::End(const UBlueprint* Blueprint, FMCPBlueprintEditSession& OutSession)
+{
+	if (!Blueprint)
+	{
+		return false;
+	}
+
+	if (!Sessions.RemoveAndCopyValue(FObjectKey(Blueprint), OutSession))
+	{
+		return false;
+	}
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Blueprint edit session closed: %s (%d pending operations)"),
+		*Blueprint->GetPathName(), OutSession.PendingOperations.Num());
+	return true;
+}
+
+void FMCPBlueprintEditSessions::RemoveStaleSessions()
+{
+	for (auto It = Sessions.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().Blueprint.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+int32 FMCPBlueprintEditSessions::CommitIdle(double IdleSeconds)
+{
+	RemoveStaleSessions();
+
+	const FDateTime Now = FDateTime::UtcNow();
+	TArray<FObjectKey> IdleKeys;
+	for (const TPair<FObjectKey, FMCPBlueprintEditSession>& Pair : Sessions)
+	{
+		if ((Now - Pair.Value.LastChangeTime).GetTotalSeconds() >= IdleSeconds)
+		{
+			IdleKeys.Add(Pair.Key);
+		}
+	}
+
+	for (const FObjectKey& Key : IdleKeys)
+	{
+		CommitSession(Key, TEXT("idle timeout"));
+	}
+	return IdleKeys.Num();
+}
+
+int32 FMCPBlueprintEditSessions::CommitAll(const TCHAR* Reason)
+{
+	RemoveStaleSessions();
+
+	TArray<FObjectKey> Keys;
+	Sessions.GetKeys(Keys);
+	for (const FObjectKey& Key : Keys)
+	{
+		CommitSession(Key, Reason);
+	}
+	return Keys.Num();
+}
+
+void FMCPBlueprintEditSessions::CommitSession(const FObjectKey& Key, const TCHAR* Reason)
+{
+	FMCPBlueprintEditSession Session;
+	if (!Sessions.RemoveAndCopyValue(Key, Session))
+	{
+		return;
+	}
+
+	UBlueprint* Blueprint = Session.Blueprint.Get();
+	if (!Blueprint)
+	{
+		return;
+	}
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Blueprint edit session committed (%s): %s (%d pending operations)"),
+		Reason, *Blueprint->GetPathName(), Session.PendingOperations.Num());
+	if (Session.PendingOperations.Num() == 0)
+	{
+		return;
+	}
+
+	// Nobody is waiting on an automatic commit, so a failed compile must show up in the log
+	const FBlueprintCompileResult CompileResult = FBlueprintLoader::CompileBlueprintWithResult(Blueprint);
+	if (!CompileResult.bSuccess)
+	{
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Blueprint edit session commit (%s) failed to compile %s:\n%s"),
+			Reason, *Blueprint->GetPathName(), *CompileResult.VerboseOutput);
+	}
+}
+
+bool FMCPBlueprintEditSessions::Tick(float DeltaTime)
+{
+	if (Sessions.Num() > 0)
+	{
+		CommitIdle(IdleTimeoutSeconds);
+	}
+	return true;
+}
@@ -0,0 +1,111 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UBlueprint;
+
+/** One open begin_edit/commit_edit session */
+struct FMCPBlueprintEditSession
+{
+	TWeakObjectPtr<UBlueprint> Blueprint;
+
+	/** Operations applied since begin_edit, in order (their compile is pending) */
+	TArray<FString> PendingOperations;
+
+	FDateTime StartedTime;
+
+	/** Last begin_edit or deferred change; sessions idle too long are committed */
+	FDateTime LastChangeTime;
+};
+
+/**
+ * Open Blueprint edit sessions
+ *
+ * While a session is open for a Blueprint, FMCPBlueprintLoadContext::CompileAndFinalize
+ * records the operation and marks the package dirty instead of running a full compile.
+ * Structural edits still refresh the skeleton class as they happen, so later
+ * operations in the session see earlier variables and functions. commit_edit
+ * ends the session and compiles once; abort_edit ends it without compiling.
+ *
+ * So that an abandoned session cannot leave a generated class stale, sessions
+ * are also committed when idle for BlueprintEditSession::IdleTimeoutSeconds,
+ * when the map changes and before PIE starts. compile_blueprints ends the
+ * sessions of the Blueprints it compiles. Module shutdown drops them.
+ *
+ * Game thread only.
+ */
+class FMCPBlueprintEditSessions
+{
+public:
+	static FMCPBlueprintEditSessions& Get();
+
+	/** Bind the idle ticker, map change and PIE delegates (call once at module startup) */
+	void Initialize();
+
+	/** Unbind and drop every session without compiling (call at module shutdown) */
+	void Shutdown();
+
+	/**
+	 * Open a session for a Blueprint
+	 * @return false if one was already open (it is kept as is)
+	 */
+	bool Begin(UBlueprint* Blueprint);
+
+	/**
+	 * Record an operation if a session is open for the Blueprint
+	 * @return true if the operation was recorded and its compile should be deferred
+	 */
+	bool RecordChange(const UBlueprint* Blueprint, const FString& OperationName);
+
+	/** Open session for a Blueprint, or nullptr */
+	const FMCPBlueprintEditSession* Find(const UBlueprint* Blueprint) const;
+
+	/**
+	 * Close the session for a Blueprint
+	 * @param OutSession - The closed session, with its pending operations
+	 * @return false if no session was open
+	 */
+	bool End(const UBlueprint* Blueprint, FMCPBlueprintEditSession& OutSession);
+
+	/** Number of open sessions */
+	int32 Num() const { return Sessions.Num(); }
+
+	/** Drop every session without compiling */
+	void Reset() { Sessions.Reset(); }
+
+	/**
+	 * Close sessions with no change for IdleSeconds, compiling Blueprints with pending changes
+	 * @return Number of sessions closed
+	 */
+	int32 CommitIdle(double IdleSeconds);
+
+	/**
+	 * Close every session, compiling Blueprints with pending changes
+	 * @param Reason - Why the sessions are closed, for the log
+	 * @return Number of sessions closed
+	 */
+	int32 CommitAll(const TCHAR* Reason);
+
+private:
+	FMCPBlueprintEditSessions() = default;
+
+	/** Drop sessions whose Blueprint was deleted or garbage collected */
+	void RemoveStaleSessions();
+
+	/** Close one session and compile its Blueprint if changes are pending */
+	void CommitSession(const FObjectKey& Key, const TCHAR* Reason);
+
+	bool Tick(float DeltaTime);
+
+	TMap<FObjectKey, FMCPBlueprintEditSession> Sessions;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	FDelegateHandle MapChangeHandle;
+	FDelegateHandle PreBeginPIEHandle;
+	bool bInitialized = false;
+};
@@ -7,6 +7,7 @@
 #include "MCPParamValidator.h"
 #include "BlueprintUtils.h"
 #include "BlueprintLoader.h"
+#include "MCPBlueprintEditSession.h"
 #include "Engine/Blueprint.h"
 
 /**
@@ -38,6 +39,9 @@ public:
 	/** Detailed compile result (populated after CompileAndFinalize) */
 	FBlueprintCompileResult CompileResult;
 
+	/** CompileAndFinalize skipped the compile because an edit session is open */
+	bool bCompileDeferred = false;
+
 	/**
 	 * Load and validate a Blueprint from JSON parameters
 	 * Handles: path extraction, path validation, loading, and editability check
@@ -117,6 +121,7 @@ public:
 	 * Compile the Blueprint and mark it dirty
 	 * Call this after making modifications
 	 * Stores detailed compile result in CompileResult member
+	 * Inside a begin_edit/commit_edit session only marks it dirty; the compile runs on commit
 	 *
 	 * @param OperationName - Name of the operation for error messages
 	 * @return Error result if compilation fails, empty optional on success
@@ -129,6 +134,16 @@ public:
 			return FMCPToolResult::Error(LastError);
 		}
 
+		if (FMCPBlueprintEditSessions::Get().RecordChange(Blueprint, OperationName))
+		{
+			bCompileDeferred = true;
+			CompileResult = FBlueprintCompileResult();
+			CompileResult.bSuccess = true;
+			CompileResult.StatusString = TEXT("Deferred");
+			FBlueprintUtils::MarkBlueprintDirty(Blueprint);
+			return TOptional<FMCPToolResult>();
+		}
+
 		// Compile with detailed result capture
 		CompileResult = FBlueprintLoader::CompileBlueprintWithResult(Blueprint);
 
@@ -156,9 +171,17 @@ public:
 		if (Blueprint)
 		{
 			ResultData->SetStringField(TEXT("blueprint_path"), Blueprint->GetPathName());
-			ResultData->SetBoolField(TEXT("compiled"), CompileResult.bSuccess);
+			ResultData->SetBoolField(TEXT("compiled"), CompileResult.bSuccess && !bCompileDeferred);
 			ResultData->SetStringField(TEXT("compile_status"), CompileResult.StatusString);
 
+			if (bCompileDeferred)
+			{
+				if (const FMCPBlueprintEditSession* Session = FMCPBlueprintEditSessions::Get().Find(Blueprint))
+				{
+					ResultData->SetNumberField(TEXT("pending_changes"), Session->PendingOperations.Num());
+				}
+			}
+
 			// Always include compile info when there are messages (errors OR warnings)
 			if (CompileResult.HasIssues() || !CompileResult.bSuccess)
 			{
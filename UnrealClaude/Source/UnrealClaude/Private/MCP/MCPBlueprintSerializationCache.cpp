@@ -0,0 +1,330 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPBlueprintSerializationCache.h"
+#include "UnrealClaudeModule.h"
+#include "UnrealClaudeConstants.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+using namespace UnrealClaudeConstants::BlueprintSerializationCache;
+
+namespace
+{
+	/**
+	 * First version for this process: the start time in seconds in the high bits
+	 * Versions are sent to clients as JSON numbers, so they stay below 2^53;
+	 * a process can hand out 2^VersionEpochBits versions before it reaches
+	 * the range of one started a second later.
+	 */
+	uint64 MakeVersionEpoch()
+	{
+		const uint64 Seconds = static_cast<uint64>(FDateTime::UtcNow().ToUnixTimestamp());
+		const uint64 MaxEpoch = (1ull << (53 - VersionEpochBits)) - 1;
+		return (Seconds & MaxEpoch) << VersionEpochBits;
+	}
+
+	/** Items of an array whose elements are all objects with a string "name", keyed by name */
+	bool GetNamedItems(const TSharedPtr<FJsonValue>& Value, TMap<FString, TSharedPtr<FJsonObject>>& OutItems)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Array = nullptr;
+		if (!Value.IsValid() || !Value->TryGetArray(Array))
+		{
+			return false;
+		}
+		for (const TSharedPtr<FJsonValue>& Item : *Array)
+		{
+			const TSharedPtr<FJsonObject>* ItemObject = nullptr;
+			FString Name;
+			if (!Item.IsValid() || !Item->TryGetObject(ItemObject) || !(*ItemObject)->TryGetStringField(TEXT("name"), Name))
+			{
+				return false;
+			}
+			OutItems.Add(Name, *ItemObject);
+		}
+		return true;
+	}
+
+	/** Added, removed and changed items between two named-item arrays; false if either is not one */
+	bool DiffNamedItems(const TSharedPtr<FJsonValue>& OldValue, const TSharedPtr<FJsonValue>& NewValue, TSharedPtr<FJsonObject>& OutDiff)
+	{
+		TMap<FString, TSharedPtr<FJsonObject>> OldItems;
+		TMap<FString, TSharedPtr<FJsonObject>> NewItems;
+		if (!GetNamedItems(OldValue, OldItems) || !GetNamedItems(NewValue, NewItems))
+		{
+			return false;
+		}
+
+		TArray<TSharedPtr<FJsonValue>> Added;
+		TArray<TSharedPtr<FJsonValue>> Changed;
+		TArray<TSharedPtr<FJsonValue>> Removed;
+		for (const TPair<FString, TSharedPtr<FJsonObject>>& Pair : NewItems)
+		{
+			const TSharedPtr<FJsonObject>* OldItem = OldItems.Find(Pair.Key);
+			if (!OldItem)
+			{
+				Added.Add(MakeShared<FJsonValueObject>(Pair.Value));
+			}
+			else if (!FJsonValue::CompareEqual(FJsonValueObject(*OldItem), FJsonValueObject(Pair.Value)))
+			{
+				Changed.Add(MakeShared<FJsonValueObject>(Pair.Value));
+			}
+		}
+		for (const TPair<FString, TSharedPtr<FJsonObject>>& Pair : OldItems)
+		{
+			if (!NewItems.Contains(Pair.Key))
+			{
+				Removed.Add(MakeShared<FJsonValueString>(Pair.Key));
+			}
+		}
+
+		OutDiff = MakeShared<FJsonObject>();
+		OutDiff->SetArrayField(TEXT("added"), Added);
+		OutDiff->SetArrayField(TEXT("removed"), Removed);
+		OutDiff->SetArrayField(TEXT("changed"), Changed);
+		return true;
+	}
+}
+
+FMCPBlueprintSerializationCache::FMCPBlueprintSerializationCache()
+	: LastVersion(MakeVersionEpoch())
+{
+}
+
+FMCPBlueprintSerializationCache& FMCPBlueprintSerializationCache::Get()
+{
+	static FMCPBlueprintSerializationCache Instance;
+	return Instance;
+}
+
+void FMCPBlueprintSerializationCache::Initialize()
+{
+	if (bInitialized)
+	{
+		return;
+	}
+
+	ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FMCPBlueprintSerializationCache::OnObjectModified);
+	PackageDirtyHandle = UPackage::PackageMarkedDirtyEvent.AddRaw(this, &FMCPBlueprintSerializationCache::OnPackageMarkedDirty);
+	UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FMCPBlueprintSerializationCache::InvalidateAll);
+
+	bInitialized = true;
+}
+
+void FMCPBlueprintSerializationCache::Shutdown()
+{
+	if (!bInitialized)
+	{
+		return;
+	}
+
+	FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+	UPackage::PackageMarkedDirtyEvent.Remove(PackageDirtyHandle);
+	FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+
+	TArray<FObjectKey> Keys;
+	Entries.GetKeys(Keys);
+	for (const FObjectKey& Key : Keys)
+	{
+		RemoveEntry(Key);
+	}
+	bInitialized = false;
+}
+
+TSharedPtr<FJsonObject> FMCPBlueprintSerializationCache::FindOrBuild(UBlueprint* Blueprint, const FString& Key,
+	TFunctionRef<TSharedPtr<FJsonObject>()> Build, uint64& OutVersion)
+{
+	OutVersion = 0;
+	if (!bInitialized || !Blueprint)
+	{
+		return Build();
+	}
+
+	{
+		FEntry& Entry = FindOrAddEntry(Blueprint);
+		Entry.LastAccessTime = FPlatformTime::Seconds();
+		OutVersion = Entry.Version;
+		if (const TSharedPtr<FJsonObject>* Cached = Entry.Results.Find(Key))
+		{
+			return *Cached;
+		}
+	}
+
+	TSharedPtr<FJsonObject> Result = Build();
+
+	// Only store it if nothing changed the Blueprint while it was being serialized
+	FEntry* Entry = Entries.Find(FObjectKey(Blueprint));
+	if (Entry && Entry->Version == OutVersion && Result.IsValid())
+	{
+		Entry->Results.Add(Key, Result);
+	}
+	return Result;
+}
+
+TSharedPtr<FJsonObject> FMCPBlueprintSerializationCache::FindPrevious(const UBlueprint* Blueprint, const FString& Key, uint64 Version) const
+{
+	const FEntry* Entry = Blueprint ? Entries.Find(FObjectKey(Blueprint)) : nullptr;
+	const TPair<uint64, TSharedPtr<FJsonObject>>* Previous = Entry ? Entry->Previous.Find(Key) : nullptr;
+	return (Previous && Previous->Key == Version) ? Previous->Value : nullptr;
+}
+
+void FMCPBlueprintSerializationCache::Invalidate(const UBlueprint* Blueprint)
+{
+	if (FEntry* Entry = Blueprint ? Entries.Find(FObjectKey(Blueprint)) : nullptr)
+	{
+		InvalidateEntry(*Entry);
+	}
+}
+
+void FMCPBlueprintSerializationCache::InvalidateAll()
+{
+	for (TPair<FObjectKey, FEntry>& Pair : Entries)
+	{
+		InvalidateEntry(Pair.Value);
+	}
+}
+
+TSharedPtr<FJsonObject> FMCPBlueprintSerializationCache::Diff(const TSharedPtr<FJsonObject>& Old, const TSharedPtr<FJsonObject>& New)
+{
+	TSharedPtr<FJsonObject> Fields = MakeShared<FJsonObject>();
+	TSharedPtr<FJsonObject> Items = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> RemovedFields;
+
+	if (New.IsValid())
+	{
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : New->Values)
+		{
+			const TSharedPtr<FJsonValue>* OldValue = Old.IsValid() ? Old->Values.Find(Pair.Key) : nullptr;
+			if (OldValue && OldValue->IsValid() && Pair.Value.IsValid() && FJsonValue::CompareEqual(**OldValue, *Pair.Value))
+			{
+				continue;
+			}
+
+			TSharedPtr<FJsonObject> ItemDiff;
+			if (OldValue && DiffNamedItems(*OldValue, Pair.Value, ItemDiff))
+			{
+				Items->SetObjectField(Pair.Key, ItemDiff);
+			}
+			else
+			{
+				Fields->SetField(Pair.Key, Pair.Value);
+			}
+		}
+	}
+
+	if (Old.IsValid())
+	{
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Old->Values)
+		{
+			if (!New.IsValid() || !New->HasField(Pair.Key))
+			{
+				RemovedFields.Add(MakeShared<FJsonValueString>(Pair.Key));
+			}
+		}
+	}
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetObjectField(TEXT("fields"), Fields);
+	Result->SetArrayField(TEXT("removed_fields"), RemovedFields);
+	Result->SetObjectField(TEXT("items"), Items);
+	return Result;
+}
+
+FMCPBlueprintSerializationCache::FEntry& FMCPBlueprintSerializationCache::FindOrAddEntry(UBlueprint* Blueprint)
+{
+	const FObjectKey BlueprintKey(Blueprint);
+	if (FEntry* Existing = Entries.Find(BlueprintKey))
+	{
+		return *Existing;
+	}
+
+	if (Entries.Num() >= MaxBlueprints)
+	{
+		Trim();
+	}
+
+	FEntry& Entry = Entries.Add(BlueprintKey);
+	Entry.Blueprint = Blueprint;
+	Entry.Package = FObjectKey(Blueprint->GetPackage());
+	Entry.Version = ++LastVersion;
+	Entry.ChangedHandle = Blueprint->OnChanged().AddRaw(this, &FMCPBlueprintSerializationCache::OnBlueprintChanged);
+	Entry.CompiledHandle = Blueprint->OnCompiled().AddRaw(this, &FMCPBlueprintSerializationCache::OnBlueprintChanged);
+	BlueprintByPackage.Add(Entry.Package, BlueprintKey);
+	return Entry;
+}
+
+void FMCPBlueprintSerializationCache::InvalidateEntry(FEntry& Entry)
+{
+	for (TPair<FString, TSharedPtr<FJsonObject>>& Pair : Entry.Results)
+	{
+		Entry.Previous.Add(Pair.Key, TPair<uint64, TSharedPtr<FJsonObject>>(Entry.Version, MoveTemp(Pair.Value)));
+	}
+	Entry.Results.Reset();
+	Entry.Version = ++LastVersion;
+}
+
+void FMCPBlueprintSerializationCache::RemoveEntry(const FObjectKey& Key)
+{
+	FEntry Entry;
+	if (!Entries.RemoveAndCopyValue(Key, Entry))
+	{
+		return;
+	}
+
+	if (UBlueprint* Blueprint = Entry.Blueprint.Get())
+	{
+		Blueprint->OnChanged().Remove(Entry.ChangedHandle);
+		Blueprint->OnCompiled().Remove(Entry.CompiledHandle);
+	}
+	BlueprintByPackage.Remove(Entry.Package);
+}
+
+void FMCPBlueprintSerializationCache::Trim()
+{
+	TArray<TPair<double, FObjectKey>> ByAccess;
+	for (const TPair<FObjectKey, FEntry>& Pair : Entries)
+	{
+		ByAccess.Emplace(Pair.Value.Blueprint.IsValid() ? Pair.Value.LastAccessTime : -1.0, Pair.Key);
+	}
+	ByAccess.Sort([](const TPair<double, FObjectKey>& A, const TPair<double, FObjectKey>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	// Stale entries sort first; then evict the oldest until there is room for one more
+	for (const TPair<double, FObjectKey>& Candidate : ByAccess)
+	{
+		if (Candidate.Key >= 0.0 && Entries.Num() < MaxBlueprints)
+		{
+			break;
+		}
+		RemoveEntry(Candidate.Value);
+	}
+}
+
+void FMCPBlueprintSerializationCache::OnObjectModified(UObject* Object)
+{
+	if (Entries.Num() == 0 || !Object)
+	{
+		return;
+	}
+
+	if (const FObjectKey* BlueprintKey = BlueprintByPackage.Find(FObjectKey(Object->GetPackage())))
+	{
+		if (FEntry* Entry = Entries.Find(*BlueprintKey))
+		{
+			InvalidateEntry(*Entry);
+		}
+	}
+}
+
+void FMCPBlueprintSerializationCache::OnPackageMarkedDirty(UPackage* Package, bool bWasDirty)
+{
+	OnObjectModified(Package);
+}
+
+void FMCPBlueprintSerializationCache::OnBlueprintChanged(UBlueprint* Blueprint)
+{
+	Invalidate(Blueprint);
+}
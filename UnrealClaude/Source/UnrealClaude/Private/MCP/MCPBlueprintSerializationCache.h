@@ -0,0 +1,116 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UBlueprint;
+class UPackage;
+
+/**
+ * Serialized blueprint_query results, cached per Blueprint until it changes
+ *
+ * Each Blueprint has a version that is bumped whenever it may have changed:
+ * any object in its package is modified, the package is marked dirty, the
+ * Blueprint broadcasts OnChanged or OnCompiled, or the editor undoes/redoes.
+ * Results are stored per query key at the current version, so repeated
+ * inspections between edits are served without walking graphs and pins.
+ *
+ * When a Blueprint changes, the last result for each key is kept with the
+ * version it was served at, so a caller holding that version can be sent a
+ * Diff instead of the whole result.
+ *
+ * Versions start from a per-process epoch rather than 0, so a version kept
+ * by a client across an editor restart cannot match a new, unrelated result.
+ *
+ * Game thread only.
+ */
+class FMCPBlueprintSerializationCache
+{
+public:
+	static FMCPBlueprintSerializationCache& Get();
+
+	/** Bind change delegates (call once at module startup); nothing is cached before this */
+	void Initialize();
+
+	/** Unbind delegates and drop every entry (call at module shutdown) */
+	void Shutdown();
+
+	/**
+	 * Cached result for a query, building and storing it on a miss
+	 * Callers must not modify the returned object; copy it first.
+	 * @param Blueprint - Blueprint being queried
+	 * @param Key - Query key (operation plus anything that changes the output)
+	 * @param Build - Serializes the result
+	 * @param OutVersion - Version the result belongs to (0 when caching is off)
+	 * @return The result
+	 */
+	TSharedPtr<FJsonObject> FindOrBuild(UBlueprint* Blueprint, const FString& Key,
+		TFunctionRef<TSharedPtr<FJsonObject>()> Build, uint64& OutVersion);
+
+	/** Result served for a key at an earlier version, if it is still remembered */
+	TSharedPtr<FJsonObject> FindPrevious(const UBlueprint* Blueprint, const FString& Key, uint64 Version) const;
+
+	/** Drop the cached results for a Blueprint and bump its version */
+	void Invalidate(const UBlueprint* Blueprint);
+
+	/** Drop every cached result */
+	void InvalidateAll();
+
+	/** Number of Blueprints with an entry */
+	int32 Num() const { return Entries.Num(); }
+
+	/**
+	 * Differences between two results
+	 * Arrays of objects with a "name" field (variables, functions) are compared
+	 * item by item; anything else is reported with its new value.
+	 * @return { fields: {changed/added values}, removed_fields: [...], items: {array: {added, removed, changed}} }
+	 */
+	static TSharedPtr<FJsonObject> Diff(const TSharedPtr<FJsonObject>& Old, const TSharedPtr<FJsonObject>& New);
+
+private:
+	FMCPBlueprintSerializationCache();
+
+	struct FEntry
+	{
+		TWeakObjectPtr<UBlueprint> Blueprint;
+		FObjectKey Package;
+		uint64 Version = 0;
+		double LastAccessTime = 0.0;
+
+		/** Results at the current version, by query key */
+		TMap<FString, TSharedPtr<FJsonObject>> Results;
+
+		/** Last result for each key before the Blueprint changed, with its version */
+		TMap<FString, TPair<uint64, TSharedPtr<FJsonObject>>> Previous;
+
+		FDelegateHandle ChangedHandle;
+		FDelegateHandle CompiledHandle;
+	};
+
+	FEntry& FindOrAddEntry(UBlueprint* Blueprint);
+	void InvalidateEntry(FEntry& Entry);
+	void RemoveEntry(const FObjectKey& Key);
+
+	/** Drop entries whose Blueprint is gone, then the least recently used ones past the limit */
+	void Trim();
+
+	// Delegate handlers
+	void OnObjectModified(UObject* Object);
+	void OnPackageMarkedDirty(UPackage* Package, bool bWasDirty);
+	void OnBlueprintChanged(UBlueprint* Blueprint);
+
+	TMap<FObjectKey, FEntry> Entries;
+	TMap<FObjectKey, FObjectKey> BlueprintByPackage;
+	/** Last version handed out; seeded by MakeVersionEpoch */
+	uint64 LastVersion = 0;
+
+	FDelegateHandle ObjectModifiedHandle;
+	FDelegateHandle PackageDirtyHandle;
+	FDelegateHandle UndoRedoHandle;
+
+	bool bInitialized = false;
+};
@@ -0,0 +1,308 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPClassResolver.h"
+#include "UnrealClaudeModule.h"
+#include "Engine/Blueprint.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/PackageName.h"
+#include "UObject/UObjectIterator.h"
+
+namespace
+{
+	const FName AssetRegistryModuleName(TEXT("AssetRegistry"));
+
+	/** Leftover classes from Blueprint compiles and reloads that must never be returned */
+	bool IsStaleClass(const UClass* Class)
+	{
+		if (Class->HasAnyClassFlags(CLASS_NewerVersionExists))
+		{
+			return true;
+		}
+		const FString Name = Class->GetName();
+		return Name.StartsWith(TEXT("SKEL_")) || Name.StartsWith(TEXT("REINST_")) ||
+			Name.StartsWith(TEXT("TRASHCLASS_")) || Name.StartsWith(TEXT("HOTRELOADED_"));
+	}
+}
+
+FMCPClassResolver& FMCPClassResolver::Get()
+{
+	static FMCPClassResolver Instance;
+	return Instance;
+}
+
+void FMCPClassResolver::Initialize()
+{
+	if (bInitialized)
+	{
+		return;
+	}
+
+	ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddRaw(this, &FMCPClassResolver::OnModulesChanged);
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FMCPClassResolver::OnReloadComplete);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryModuleName).Get();
+	AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FMCPClassResolver::OnAssetRegistryChanged);
+	AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FMCPClassResolver::OnAssetRegistryChanged);
+	AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FMCPClassResolver::OnAssetRenamed);
+
+	bInitialized = true;
+	UE_LOG(LogUnrealClaude, Log, TEXT("Class resolver initialized"));
+}
+
+void FMCPClassResolver::Shutdown()
+{
+	if (!bInitialized)
+	{
+		return;
+	}
+
+	FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+
+	// The registry may already be gone during editor shutdown
+	if (FAssetRegistryModule* Module = FModuleManager::GetModulePtr<FAssetRegistryModule>(AssetRegistryModuleName))
+	{
+		IAssetRegistry& AssetRegistry = Module->Get();
+		AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+	}
+
+	Invalidate();
+	bInitialized = false;
+}
+
+void FMCPClassResolver::Invalidate()
+{
+	LoadedClasses.Empty();
+	bLoadedClassesBuilt = false;
+	BlueprintClasses.Empty();
+	bBlueprintClassesBuilt = false;
+	Hits.Empty();
+	Misses.Empty();
+}
+
+UClass* FMCPClassResolver::FindClass(const FString& NameOrPath, const UClass* BaseClass)
+{
+	const FString Trimmed = NameOrPath.TrimStartAndEnd();
+	if (Trimmed.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	const FString Key = Trimmed.ToLower();
+	UClass* Class = nullptr;
+
+	if (const TWeakObjectPtr<UClass>* Hit = Hits.Find(Key))
+	{
+		Class = Hit->Get();
+		if (Class && IsStaleClass(Class))
+		{
+			Class = nullptr;
+		}
+	}
+
+	if (!Class)
+	{
+		if (Misses.Contains(Key))
+		{
+			return nullptr;
+		}
+
+		// Without event bindings the caches could go stale, so only use them once initialized
+		Class = ResolveUncached(Trimmed);
+		if (bInitialized)
+		{
+			if (Class)
+			{
+				Hits.Add(Key, Class);
+			}
+			else
+			{
+				Misses.Add(Key);
+			}
+		}
+	}
+
+	return Class && (!BaseClass || Class->IsChildOf(BaseClass)) ? Class : nullptr;
+}
+
+UClass* FMCPClassResolver::ResolveUncached(const FString& NameOrPath)
+{
+	if (NameOrPath.StartsWith(TEXT("/")))
+	{
+		return ResolvePath(NameOrPath);
+	}
+
+	if (UClass* Class = ResolveShortName(NameOrPath))
+	{
+		return Class;
+	}
+
+	// Accept C++ spellings such as "APointLight" or "UStaticMesh"
+	if (NameOrPath.Len() > 2 && (NameOrPath[0] == TEXT('A') || NameOrPath[0] == TEXT('U')) && FChar::IsUpper(NameOrPath[1]))
+	{
+		return ResolveShortName(NameOrPath.RightChop(1));
+	}
+
+	return nullptr;
+}
+
+UClass* FMCPClassResolver::ResolvePath(const FString& Path)
+{
+	if (UClass* Class = FindObject<UClass>(nullptr, *Path))
+	{
+		return Class;
+	}
+
+	if (Path.StartsWith(TEXT("/Script/")))
+	{
+		// Script packages are always loaded, so FindObject was authoritative
+		return nullptr;
+	}
+
+	// Blueprint asset paths: "/Game/X/BP_Y", "/Game/X/BP_Y.BP_Y" or "/Game/X/BP_Y.BP_Y_C"
+	const FString ObjectPath = Path.Contains(TEXT("."))
+		? Path
+		: FString::Printf(TEXT("%s.%s"), *Path, *FPackageName::GetShortName(Path));
+	if (!FPackageName::DoesPackageExist(FPackageName::ObjectPathToPackageName(ObjectPath)))
+	{
+		return nullptr;
+	}
+
+	const FString ClassPath = ObjectPath.EndsWith(TEXT("_C")) ? ObjectPath : ObjectPath + TEXT("_C");
+	if (UClass* Class = LoadObject<UClass>(nullptr, *ClassPath))
+	{
+		return Class;
+	}
+	return ClassPath != ObjectPath ? LoadObject<UClass>(nullptr, *ObjectPath) : nullptr;
+}
+
+UClass* FMCPClassResolver::ResolveShortName(const FString& ShortName)
+{
+	// A name that was never created as an FName cannot belong to any class or asset
+	const FName Name(*ShortName, FNAME_Find);
+	if (Name.IsNone())
+	{
+		return nullptr;
+	}
+
+	BuildLoadedClassIndex();
+	UClass* Best = nullptr;
+	if (TArray<TWeakObjectPtr<UClass>>* Candidates = LoadedClasses.Find(Name))
+	{
+		for (const TWeakObjectPtr<UClass>& Candidate : *Candidates)
+		{
+			UClass* Class = Candidate.Get();
+			if (Class && !IsStaleClass(Class) && (!Best || GetClassPriority(Class) < GetClassPriority(Best)))
+			{
+				Best = Class;
+			}
+		}
+	}
+	if (Best)
+	{
+		return Best;
+	}
+
+	// Blueprints that are not loaded yet, found through registry tags
+	BuildBlueprintClassIndex();
+	const FSoftObjectPath* ClassPath = BlueprintClasses.Find(Name);
+	return ClassPath ? Cast<UClass>(ClassPath->TryLoad()) : nullptr;
+}
+
+void FMCPClassResolver::BuildLoadedClassIndex()
+{
+	if (bLoadedClassesBuilt)
+	{
+		return;
+	}
+
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		if (!IsStaleClass(Class))
+		{
+			LoadedClasses.FindOrAdd(Class->GetFName()).Add(Class);
+		}
+	}
+	bLoadedClassesBuilt = true;
+}
+
+void FMCPClassResolver::BuildBlueprintClassIndex()
+{
+	if (bBlueprintClassesBuilt)
+	{
+		return;
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryModuleName).Get();
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+
+	TArray<FAssetData> Blueprints;
+	AssetRegistry.GetAssets(Filter, Blueprints);
+
+	for (const FAssetData& AssetData : Blueprints)
+	{
+		FString GeneratedClassTag;
+		if (!AssetData.GetTagValue(FBlueprintTags::GeneratedClassPath, GeneratedClassTag))
+		{
+			continue;
+		}
+
+		const FSoftObjectPath ClassPath(FPackageName::ExportTextPathToObjectPath(GeneratedClassTag));
+		if (ClassPath.IsNull())
+		{
+			continue;
+		}
+
+		// Reachable both as "BP_Enemy" and "BP_Enemy_C"
+		BlueprintClasses.Add(AssetData.AssetName, ClassPath);
+		BlueprintClasses.Add(FName(*ClassPath.GetAssetName()), ClassPath);
+	}
+	bBlueprintClassesBuilt = true;
+}
+
+int32 FMCPClassResolver::GetClassPriority(const UClass* Class)
+{
+	if (!Class->HasAnyClassFlags(CLASS_Native))
+	{
+		return 3;
+	}
+
+	const FName PackageName = Class->GetOutermost()->GetFName();
+	if (PackageName == TEXT("/Script/Engine"))
+	{
+		return 0;
+	}
+	return PackageName == TEXT("/Script/CoreUObject") ? 1 : 2;
+}
+
+void FMCPClassResolver::OnModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+	// New script packages bring new native classes
+	Invalidate();
+}
+
+void FMCPClassResolver::OnReloadComplete(EReloadCompleteReason Reason)
+{
+	Invalidate();
+}
+
+void FMCPClassResolver::OnAssetRegistryChanged(const FAssetData& AssetData)
+{
+	// Blueprint adds, removes and renames can change what a name resolves to
+	BlueprintClasses.Empty();
+	bBlueprintClassesBuilt = false;
+	Hits.Empty();
+	Misses.Empty();
+}
+
+void FMCPClassResolver::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	OnAssetRegistryChanged(AssetData);
+}
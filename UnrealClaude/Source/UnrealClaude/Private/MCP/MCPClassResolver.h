@@ -0,0 +1,95 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/UObjectGlobals.h"
+
+struct FAssetData;
+
+/**
+ * Shared class lookup by short name or path
+ *
+ * Accepts short names ("PointLight", "APointLight", "BP_Enemy", "BP_Enemy_C"),
+ * script paths ("/Script/Engine.PointLight") and Blueprint asset paths
+ * ("/Game/BP_Enemy" or "/Game/BP_Enemy.BP_Enemy_C").
+ *
+ * Short names are looked up in an index of every loaded class, built once
+ * from the object iterator, then in an index of Blueprint generated classes
+ * built from asset registry tags (so unloaded Blueprints resolve without a
+ * scan). When a short name matches several classes, Engine wins over
+ * CoreUObject, then other native classes, then Blueprints. Both hits and
+ * misses are cached. Module loads and hot reload drop everything, and
+ * asset registry changes drop the Blueprint index and cached lookups.
+ *
+ * Game thread only.
+ */
+class FMCPClassResolver
+{
+public:
+	static FMCPClassResolver& Get();
+
+	/** Bind module, reload and asset registry events (call once at module startup) */
+	void Initialize();
+
+	/** Unbind events and drop caches (call at module shutdown) */
+	void Shutdown();
+
+	/**
+	 * Find a class, loading Blueprint classes if needed
+	 * @param NameOrPath - Short class name, script path or Blueprint path
+	 * @param BaseClass - Optional class the result must derive from
+	 * @return The class, or nullptr if none matches
+	 */
+	UClass* FindClass(const FString& NameOrPath, const UClass* BaseClass = nullptr);
+
+	/** Drop all cached lookups and indexes */
+	void Invalidate();
+
+	/** Number of cached lookups (hits and misses) */
+	int32 GetCachedLookupCount() const { return Hits.Num() + Misses.Num(); }
+
+private:
+	FMCPClassResolver() = default;
+
+	/** Resolve without consulting the hit/miss caches */
+	UClass* ResolveUncached(const FString& NameOrPath);
+
+	UClass* ResolvePath(const FString& Path);
+	UClass* ResolveShortName(const FString& ShortName);
+
+	void BuildLoadedClassIndex();
+	void BuildBlueprintClassIndex();
+
+	/** Lower is preferred when a short name is ambiguous */
+	static int32 GetClassPriority(const UClass* Class);
+
+	// Event handlers
+	void OnModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+	void OnReloadComplete(EReloadCompleteReason Reason);
+	void OnAssetRegistryChanged(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+	/** Loaded classes by short name (FName compares case-insensitively) */
+	TMap<FName, TArray<TWeakObjectPtr<UClass>>> LoadedClasses;
+	bool bLoadedClassesBuilt = false;
+
+	/** Blueprint generated class paths by Blueprint asset name and by class name */
+	TMap<FName, FSoftObjectPath> BlueprintClasses;
+	bool bBlueprintClassesBuilt = false;
+
+	/** Lower-cased input -> resolved class */
+	TMap<FString, TWeakObjectPtr<UClass>> Hits;
+
+	/** Lower-cased inputs known not to resolve */
+	TSet<FString> Misses;
+
+	FDelegateHandle ModulesChangedHandle;
+	FDelegateHandle ReloadCompleteHandle;
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	bool bInitialized = false;
+};
@@ -0,0 +1,140 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPCursorStore.h"
+#include "UnrealClaudeConstants.h"
+#include "Misc/ScopeLock.h"
+
+FMCPCursorStore& FMCPCursorStore::Get()
+{
+	static FMCPCursorStore Instance;
+	return Instance;
+}
+
+FString FMCPCursorStore::CreateCursor(const FString& Scope, TArray<FString>&& Ids, int32 StartOffset, TSharedPtr<FJsonObject> Options)
+{
+	const FGuid SnapshotId = FGuid::NewGuid();
+	const FDateTime Now = FDateTime::UtcNow();
+
+	FScopeLock ScopeLock(&Lock);
+
+	FSnapshot& Snapshot = Snapshots.Add(SnapshotId);
+	Snapshot.Scope = Scope;
+	Snapshot.Ids = MoveTemp(Ids);
+	Snapshot.Options = Options;
+	Snapshot.LastAccess = Now;
+
+	PurgeLocked(Now);
+
+	return MakeCursor(SnapshotId, FMath::Clamp(StartOffset, 0, Snapshot.Ids.Num()));
+}
+
+bool FMCPCursorStore::ReadPage(const FString& Cursor, const FString& Scope, int32 Limit, FMCPCursorPage& OutPage, FString& OutError)
+{
+	FGuid SnapshotId;
+	int32 Offset = 0;
+	if (Cursor.Len() > UnrealClaudeConstants::Pagination::MaxCursorLength || !ParseCursor(Cursor, SnapshotId, Offset))
+	{
+		OutError = TEXT("Invalid cursor. Pass the cursor string returned by the previous page unchanged.");
+		return false;
+	}
+
+	const FDateTime Now = FDateTime::UtcNow();
+
+	FScopeLock ScopeLock(&Lock);
+	PurgeLocked(Now);
+
+	FSnapshot* Snapshot = Snapshots.Find(SnapshotId);
+	if (!Snapshot)
+	{
+		OutError = TEXT("Cursor has expired. Repeat the query without a cursor to start a new listing.");
+		return false;
+	}
+	if (Snapshot->Scope != Scope)
+	{
+		OutError = FString::Printf(TEXT("Cursor belongs to '%s', not '%s'"), *Snapshot->Scope, *Scope);
+		return false;
+	}
+	if (Offset > Snapshot->Ids.Num())
+	{
+		OutError = TEXT("Invalid cursor position");
+		return false;
+	}
+
+	Snapshot->LastAccess = Now;
+
+	const int32 End = FMath::Min(Offset + FMath::Max(Limit, 1), Snapshot->Ids.Num());
+	OutPage.Ids.Reset(End - Offset);
+	for (int32 i = Offset; i < End; ++i)
+	{
+		OutPage.Ids.Add(Snapshot->Ids[i]);
+	}
+	OutPage.Offset = Offset;
+	OutPage.Total = Snapshot->Ids.Num();
+	OutPage.Options = Snapshot->Options;
+	OutPage.NextCursor = End < Snapshot->Ids.Num() ? MakeCursor(SnapshotId, End) : FString();
+
+	return true;
+}
+
+void FMCPCursorStore::Reset()
+{
+	FScopeLock ScopeLock(&Lock);
+	Snapshots.Empty();
+}
+
+int32 FMCPCursorStore::GetSnapshotCount() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Snapshots.Num();
+}
+
+FString FMCPCursorStore::MakeCursor(const FGuid& SnapshotId, int32 Offset)
+{
+	return FString::Printf(TEXT("%s-%d"), *SnapshotId.ToString(EGuidFormats::Digits), Offset);
+}
+
+bool FMCPCursorStore::ParseCursor(const FString& Cursor, FGuid& OutSnapshotId, int32& OutOffset)
+{
+	FString GuidPart;
+	FString OffsetPart;
+	if (!Cursor.Split(TEXT("-"), &GuidPart, &OffsetPart) || OffsetPart.IsEmpty() || !OffsetPart.IsNumeric())
+	{
+		return false;
+	}
+	if (!FGuid::ParseExact(GuidPart, EGuidFormats::Digits, OutSnapshotId))
+	{
+		return false;
+	}
+
+	OutOffset = FCString::Atoi(*OffsetPart);
+	return OutOffset >= 0;
+}
+
+void FMCPCursorStore::PurgeLocked(const FDateTime& Now)
+{
+	using namespace UnrealClaudeConstants::Pagination;
+
+	const FTimespan TTL = FTimespan::FromSeconds(CursorTTLSeconds);
+	for (auto It = Snapshots.CreateIterator(); It; ++It)
+	{
+		if (Now - It.Value().LastAccess > TTL)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	while (Snapshots.Num() > MaxCursorSnapshots)
+	{
+		FGuid Oldest;
+		FDateTime OldestAccess = FDateTime::MaxValue();
+		for (const auto& Pair : Snapshots)
+		{
+			if (Pair.Value.LastAccess < OldestAccess)
+			{
+				OldestAccess = Pair.Value.LastAccess;
+				Oldest = Pair.Key;
+			}
+		}
+		Snapshots.Remove(Oldest);
+	}
+}
@@ -0,0 +1,84 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * A page of ids read from a cursor snapshot
+ */
+struct FMCPCursorPage
+{
+	/** Ids on this page, in snapshot order */
+	TArray<FString> Ids;
+
+	/** Position of the first id within the snapshot */
+	int32 Offset = 0;
+
+	/** Total number of ids in the snapshot */
+	int32 Total = 0;
+
+	/** Cursor for the following page (empty on the last page) */
+	FString NextCursor;
+
+	/** Listing options captured when the snapshot was taken */
+	TSharedPtr<FJsonObject> Options;
+};
+
+/**
+ * Snapshots of listing results for cursor pagination
+ *
+ * The first page of a large listing snapshots the full matching id list
+ * (actor or asset paths) once. Later pages are sliced from the snapshot, so
+ * they cost O(page) and don't shift when the level or registry changes in
+ * between. Cursors are opaque strings encoding the snapshot and position,
+ * scoped to the listing that created them, and expire after
+ * Pagination::CursorTTLSeconds without use.
+ */
+class FMCPCursorStore
+{
+public:
+	static FMCPCursorStore& Get();
+
+	/**
+	 * Snapshot an id list and return a cursor positioned at StartOffset
+	 * @param Scope - Listing that owns the snapshot (e.g. "get_level_actors")
+	 * @param Ids - Full ordered list of matching ids
+	 * @param StartOffset - Position the returned cursor reads from
+	 * @param Options - Listing options later pages should reuse (e.g. brief)
+	 */
+	FString CreateCursor(const FString& Scope, TArray<FString>&& Ids, int32 StartOffset, TSharedPtr<FJsonObject> Options = nullptr);
+
+	/**
+	 * Read up to Limit ids at the cursor's position
+	 * @return false with OutError set if the cursor is malformed, expired, or from another listing
+	 */
+	bool ReadPage(const FString& Cursor, const FString& Scope, int32 Limit, FMCPCursorPage& OutPage, FString& OutError);
+
+	/** Drop all snapshots */
+	void Reset();
+
+	/** Number of live snapshots */
+	int32 GetSnapshotCount() const;
+
+private:
+	FMCPCursorStore() = default;
+
+	struct FSnapshot
+	{
+		FString Scope;
+		TArray<FString> Ids;
+		TSharedPtr<FJsonObject> Options;
+		FDateTime LastAccess;
+	};
+
+	static FString MakeCursor(const FGuid& SnapshotId, int32 Offset);
+	static bool ParseCursor(const FString& Cursor, FGuid& OutSnapshotId, int32& OutOffset);
+
+	/** Remove expired snapshots and evict the least recently used beyond the cap (Lock must be held) */
+	void PurgeLocked(const FDateTime& Now);
+
+	TMap<FGuid, FSnapshot> Snapshots;
+	mutable FCriticalSection Lock;
+};
@@ -0,0 +1,141 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * Selection of JSON fields a serializer should compute and emit
+ *
+ * Tools read it from an optional 'fields' parameter (an array of names or a
+ * comma-separated string). Serializers check Has() before doing the work for
+ * a field, so transforms, tags or graph info nobody asked for are never
+ * computed. A default-constructed set selects every field.
+ */
+class FMCPFieldSet
+{
+public:
+	/** Select every field */
+	FMCPFieldSet() = default;
+
+	/** Select exactly the given fields */
+	FMCPFieldSet(std::initializer_list<const TCHAR*> InFields)
+		: bAll(false)
+	{
+		for (const TCHAR* Field : InFields)
+		{
+			Fields.Add(Field);
+		}
+	}
+
+	/** Select exactly the given fields */
+	explicit FMCPFieldSet(const TArray<FString>& InFields)
+		: Fields(InFields)
+		, bAll(false)
+	{
+	}
+
+	/** Whether a field is selected (case-insensitive) */
+	bool Has(const TCHAR* Field) const
+	{
+		if (bAll)
+		{
+			return true;
+		}
+		for (const FString& Selected : Fields)
+		{
+			if (FCString::Stricmp(*Selected, Field) == 0)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/** Add a field to an explicit selection */
+	void Add(const TCHAR* Field)
+	{
+		if (!bAll && !Has(Field))
+		{
+			Fields.Add(Field);
+		}
+	}
+
+	/** Whether every field is selected */
+	bool IsAll() const { return bAll; }
+
+	/** Selected field names (empty when every field is selected) */
+	const TArray<FString>& GetNames() const { return Fields; }
+
+	/**
+	 * Read a field selection parameter
+	 * @param Params - Tool parameters
+	 * @param ValidFields - Field names the serializer understands
+	 * @param InOutFields - Replaced by the requested selection; left unchanged if the parameter is absent
+	 * @param OutError - Set when the parameter is malformed or names an unknown field
+	 * @param ParamName - Parameter to read
+	 * @return false on error
+	 */
+	static bool Parse(const TSharedRef<FJsonObject>& Params, const TArray<const TCHAR*>& ValidFields,
+		FMCPFieldSet& InOutFields, FString& OutError, const TCHAR* ParamName = TEXT("fields"))
+	{
+		TArray<FString> Requested;
+		const TArray<TSharedPtr<FJsonValue>>* FieldArray = nullptr;
+		FString FieldString;
+		if (Params->TryGetArrayField(ParamName, FieldArray))
+		{
+			for (const TSharedPtr<FJsonValue>& Value : *FieldArray)
+			{
+				FString Name;
+				if (!Value.IsValid() || !Value->TryGetString(Name))
+				{
+					OutError = FString::Printf(TEXT("'%s' must be an array of field names"), ParamName);
+					return false;
+				}
+				Requested.Add(Name.TrimStartAndEnd());
+			}
+		}
+		else if (Params->TryGetStringField(ParamName, FieldString))
+		{
+			FieldString.ParseIntoArray(Requested, TEXT(","), true);
+			for (FString& Name : Requested)
+			{
+				Name.TrimStartAndEndInline();
+			}
+		}
+		else
+		{
+			return true;
+		}
+
+		Requested.RemoveAll([](const FString& Name) { return Name.IsEmpty(); });
+		if (Requested.Num() == 0)
+		{
+			return true;
+		}
+
+		FMCPFieldSet Parsed(TArray<FString>{});
+		for (const FString& Name : Requested)
+		{
+			const TCHAR* const* Match = ValidFields.FindByPredicate([&Name](const TCHAR* Valid)
+			{
+				return FCString::Stricmp(Valid, *Name) == 0;
+			});
+			if (!Match)
+			{
+				OutError = FString::Printf(TEXT("Unknown field '%s' in '%s'. Valid fields: %s"),
+					*Name, ParamName, *FString::Join(ValidFields, TEXT(", ")));
+				return false;
+			}
+			Parsed.Add(*Match);
+		}
+
+		InOutFields = MoveTemp(Parsed);
+		return true;
+	}
+
+private:
+	TArray<FString> Fields;
+	bool bAll = true;
+};
@@ -0,0 +1,283 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPLevelJournal.h"
+#include "UnrealClaudeModule.h"
+#include "UnrealClaudeConstants.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectGlobals.h"
+#include "Algo/BinarySearch.h"
+
+FMCPLevelJournal& FMCPLevelJournal::Get()
+{
+	static FMCPLevelJournal Instance;
+	return Instance;
+}
+
+void FMCPLevelJournal::Initialize()
+{
+	if (bInitialized || !GEngine)
+	{
+		return;
+	}
+
+	ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FMCPLevelJournal::OnActorAdded);
+	ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FMCPLevelJournal::OnActorDeleted);
+	ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FMCPLevelJournal::OnActorMoved);
+	ActorLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(this, &FMCPLevelJournal::OnActorLabelChanged);
+	PropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FMCPLevelJournal::OnObjectPropertyChanged);
+	MapChangeHandle = FEditorDelegates::MapChange.AddLambda([this](uint32) { RecordReset(TEXT("map changed")); });
+	UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddLambda([this]() { RecordReset(TEXT("undo/redo")); });
+
+	bInitialized = true;
+	UE_LOG(LogUnrealClaude, Log, TEXT("Level change journal initialized"));
+}
+
+void FMCPLevelJournal::Shutdown()
+{
+	if (!bInitialized)
+	{
+		return;
+	}
+
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+		GEngine->OnActorMoved().Remove(ActorMovedHandle);
+	}
+	FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelChangedHandle);
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(PropertyChangedHandle);
+	FEditorDelegates::MapChange.Remove(MapChangeHandle);
+	FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+
+	Clear();
+	bInitialized = false;
+}
+
+bool FMCPLevelJournal::GetChangesSince(uint64 SinceVersion, TArray<FMCPActorChangeSummary>& OutChanges, TArray<FString>& OutResetReasons) const
+{
+	OutChanges.Reset();
+	OutResetReasons.Reset();
+
+	// Entries after SinceVersion were dropped
+	const bool bComplete = SinceVersion >= DroppedThroughVersion;
+
+	const int32 First = Algo::UpperBoundBy(Entries, SinceVersion, &FMCPLevelChange::Version);
+
+	TMap<FString, int32> SummaryIndexByPath;
+	for (int32 i = First; i < Entries.Num(); ++i)
+	{
+		const FMCPLevelChange& Change = Entries[i];
+		if (Change.Type == EMCPLevelChangeType::Reset)
+		{
+			OutResetReasons.AddUnique(Change.Detail);
+			continue;
+		}
+
+		int32* ExistingIndex = SummaryIndexByPath.Find(Change.ActorPath);
+		if (!ExistingIndex)
+		{
+			ExistingIndex = &SummaryIndexByPath.Add(Change.ActorPath, OutChanges.AddDefaulted());
+			OutChanges[*ExistingIndex].FirstVersion = Change.Version;
+		}
+		FMCPActorChangeSummary& Summary = OutChanges[*ExistingIndex];
+
+		Summary.ActorPath = Change.ActorPath;
+		Summary.ActorName = Change.ActorName;
+		Summary.ActorLabel = Change.ActorLabel;
+		Summary.ActorClass = Change.ActorClass;
+		Summary.LastVersion = Change.Version;
+
+		switch (Change.Type)
+		{
+		case EMCPLevelChangeType::Created:
+			// Re-created after a delete (e.g. redo) nets out to a modification
+			if (Summary.bDeleted)
+			{
+				Summary.bDeleted = false;
+			}
+			else
+			{
+				Summary.bCreated = true;
+			}
+			break;
+		case EMCPLevelChangeType::Deleted:
+			Summary.bDeleted = true;
+			break;
+		case EMCPLevelChangeType::Transformed:
+			Summary.bTransformed = true;
+			break;
+		case EMCPLevelChangeType::PropertyChanged:
+			if (!Change.Detail.IsEmpty())
+			{
+				Summary.Properties.AddUnique(Change.Detail);
+			}
+			break;
+		case EMCPLevelChangeType::Relabeled:
+			Summary.bRelabeled = true;
+			break;
+		default:
+			break;
+		}
+	}
+
+	// Actors created and deleted within the window never existed from the caller's point of view
+	OutChanges.RemoveAll([](const FMCPActorChangeSummary& Summary)
+	{
+		return Summary.bCreated && Summary.bDeleted;
+	});
+
+	return bComplete;
+}
+
+void FMCPLevelJournal::RecordChange(EMCPLevelChangeType Type, AActor* Actor, const FString& Detail)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	FMCPLevelChange Change;
+	Change.Type = Type;
+	Change.ActorPath = Actor->GetPathName();
+	Change.ActorName = Actor->GetName();
+	Change.ActorLabel = Actor->GetActorLabel();
+	Change.ActorClass = Actor->GetClass()->GetName();
+	Change.Detail = Detail;
+
+	// Fold repeated updates to the same actor (viewport drags, slider edits) into the latest entry
+	if (Entries.Num() > 0)
+	{
+		FMCPLevelChange& Last = Entries.Last();
+		if (Last.Type == Type && Last.ActorPath == Change.ActorPath && Last.Detail == Change.Detail &&
+			(Type == EMCPLevelChangeType::Transformed || Type == EMCPLevelChangeType::PropertyChanged))
+		{
+			Last.Version = ++CurrentVersion;
+			Last.ActorLabel = MoveTemp(Change.ActorLabel);
+			return;
+		}
+	}
+
+	Append(MoveTemp(Change));
+}
+
+void FMCPLevelJournal::RecordReset(const FString& Reason)
+{
+	FMCPLevelChange Change;
+	Change.Type = EMCPLevelChangeType::Reset;
+	Change.Detail = Reason;
+	Append(MoveTemp(Change));
+}
+
+void FMCPLevelJournal::Clear()
+{
+	Entries.Empty();
+	DroppedThroughVersion = CurrentVersion;
+}
+
+const TCHAR* FMCPLevelJournal::ChangeTypeToString(EMCPLevelChangeType Type)
+{
+	switch (Type)
+	{
+	case EMCPLevelChangeType::Created: return TEXT("created");
+	case EMCPLevelChangeType::Deleted: return TEXT("deleted");
+	case EMCPLevelChangeType::Transformed: return TEXT("transformed");
+	case EMCPLevelChangeType::PropertyChanged: return TEXT("property_changed");
+	case EMCPLevelChangeType::Relabeled: return TEXT("relabeled");
+	case EMCPLevelChangeType::Reset: return TEXT("reset");
+	default: return TEXT("unknown");
+	}
+}
+
+bool FMCPLevelJournal::IsTrackedActor(const AActor* Actor)
+{
+	if (!Actor || Actor->IsTemplate() || Actor->HasAnyFlags(RF_Transient))
+	{
+		return false;
+	}
+	const UWorld* World = Actor->GetWorld();
+	return World && World->WorldType == EWorldType::Editor;
+}
+
+void FMCPLevelJournal::Append(FMCPLevelChange&& Change)
+{
+	using namespace UnrealClaudeConstants::LevelJournal;
+
+	Change.Version = ++CurrentVersion;
+	Entries.Add(MoveTemp(Change));
+
+	// Drop the oldest quarter at once so trimming stays amortized O(1)
+	if (Entries.Num() > MaxEntries)
+	{
+		DroppedThroughVersion = Entries[MaxEntries / 4 - 1].Version;
+		Entries.RemoveAt(0, MaxEntries / 4, EAllowShrinking::No);
+	}
+}
+
+void FMCPLevelJournal::OnActorAdded(AActor* Actor)
+{
+	if (IsTrackedActor(Actor))
+	{
+		RecordChange(EMCPLevelChangeType::Created, Actor);
+	}
+}
+
+void FMCPLevelJournal::OnActorDeleted(AActor* Actor)
+{
+	if (IsTrackedActor(Actor))
+	{
+		RecordChange(EMCPLevelChangeType::Deleted, Actor);
+	}
+}
+
+void FMCPLevelJournal::OnActorMoved(AActor* Actor)
+{
+	if (IsTrackedActor(Actor))
+	{
+		RecordChange(EMCPLevelChangeType::Transformed, Actor);
+	}
+}
+
+void FMCPLevelJournal::OnActorLabelChanged(AActor* Actor)
+{
+	if (IsTrackedActor(Actor))
+	{
+		RecordChange(EMCPLevelChangeType::Relabeled, Actor);
+	}
+}
+
+void FMCPLevelJournal::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+	// Only record committed edits, not every tick of a slider drag
+	if (!Object || Event.ChangeType == EPropertyChangeType::Interactive)
+	{
+		return;
+	}
+
+	AActor* Actor = Cast<AActor>(Object);
+	if (!Actor)
+	{
+		if (const UActorComponent* Component = Cast<UActorComponent>(Object))
+		{
+			Actor = Component->GetOwner();
+		}
+	}
+	if (!IsTrackedActor(Actor))
+	{
+		return;
+	}
+
+	const FName PropertyName = Event.GetMemberPropertyName().IsNone() ? Event.GetPropertyName() : Event.GetMemberPropertyName();
+	FString Detail = PropertyName.IsNone() ? FString() : PropertyName.ToString();
+	if (Object != Actor && !PropertyName.IsNone())
+	{
+		Detail = FString::Printf(TEXT("%s.%s"), *Object->GetName(), *Detail);
+	}
+
+	RecordChange(EMCPLevelChangeType::PropertyChanged, Actor, Detail);
+}
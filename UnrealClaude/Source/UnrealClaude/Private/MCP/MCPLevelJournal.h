@@ -0,0 +1,160 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class ULevel;
+class UObject;
+class UWorld;
+struct FPropertyChangedEvent;
+
+/**
+ * Kind of change recorded in the level journal
+ */
+enum class EMCPLevelChangeType : uint8
+{
+	/** Actor was added to the level */
+	Created,
+	/** Actor was removed from the level */
+	Deleted,
+	/** Actor was moved, rotated or scaled */
+	Transformed,
+	/** A property on the actor or one of its components was edited */
+	PropertyChanged,
+	/** Actor label was changed */
+	Relabeled,
+	/** Changes happened that the journal could not attribute to actors (map change, undo/redo) */
+	Reset
+};
+
+/**
+ * Single journal entry
+ */
+struct FMCPLevelChange
+{
+	/** Journal version assigned to this change (strictly increasing) */
+	uint64 Version = 0;
+
+	EMCPLevelChangeType Type = EMCPLevelChangeType::Reset;
+
+	/** Full object path of the actor (empty for Reset) */
+	FString ActorPath;
+
+	/** Actor name, label and class at the time of the change */
+	FString ActorName;
+	FString ActorLabel;
+	FString ActorClass;
+
+	/** Property name for PropertyChanged, reason for Reset */
+	FString Detail;
+};
+
+/**
+ * Net change to one actor since a journal version
+ */
+struct FMCPActorChangeSummary
+{
+	FString ActorPath;
+	FString ActorName;
+	FString ActorLabel;
+	FString ActorClass;
+
+	/** Actor did not exist at the queried version */
+	bool bCreated = false;
+
+	/** Actor no longer exists */
+	bool bDeleted = false;
+
+	bool bTransformed = false;
+
+	bool bRelabeled = false;
+
+	/** Edited property names, in first-seen order */
+	TArray<FString> Properties;
+
+	/** Journal versions of the first and latest change to this actor */
+	uint64 FirstVersion = 0;
+	uint64 LastVersion = 0;
+};
+
+/**
+ * Versioned journal of editor-world actor changes
+ *
+ * Fed by editor delegates, so changes made by the user in the editor are
+ * recorded alongside changes made through MCP tools. Consecutive transform
+ * updates to the same actor (viewport drags) are folded into one entry.
+ * Queries collapse the entries after a version into one net change per actor.
+ *
+ * Game thread only.
+ */
+class FMCPLevelJournal
+{
+public:
+	static FMCPLevelJournal& Get();
+
+	/** Bind editor delegates (call once at module startup) */
+	void Initialize();
+
+	/** Unbind delegates and drop all entries (call at module shutdown) */
+	void Shutdown();
+
+	/** Version of the most recent change (0 if nothing has been recorded) */
+	uint64 GetCurrentVersion() const { return CurrentVersion; }
+
+	/**
+	 * Collapse every change after SinceVersion into per-actor summaries
+	 * @param SinceVersion - Version the caller last saw
+	 * @param OutChanges - Net changes per actor, ordered by first change
+	 * @param OutResetReasons - Reset entries after SinceVersion (caller should re-list the level)
+	 * @return false if entries after SinceVersion were already dropped from the journal
+	 */
+	bool GetChangesSince(uint64 SinceVersion, TArray<FMCPActorChangeSummary>& OutChanges, TArray<FString>& OutResetReasons) const;
+
+	/** Record a change directly (delegate handlers and tests) */
+	void RecordChange(EMCPLevelChangeType Type, AActor* Actor, const FString& Detail = FString());
+
+	/** Record a change that cannot be attributed to individual actors */
+	void RecordReset(const FString& Reason);
+
+	/** Drop every entry; queries from earlier versions then report incomplete history */
+	void Clear();
+
+	static const TCHAR* ChangeTypeToString(EMCPLevelChangeType Type);
+
+private:
+	FMCPLevelJournal() = default;
+
+	/** Whether changes to this actor belong in the journal (editor world, not a template) */
+	static bool IsTrackedActor(const AActor* Actor);
+
+	void Append(FMCPLevelChange&& Change);
+
+	// Delegate handlers
+	void OnActorAdded(AActor* Actor);
+	void OnActorDeleted(AActor* Actor);
+	void OnActorMoved(AActor* Actor);
+	void OnActorLabelChanged(AActor* Actor);
+	void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+
+	TArray<FMCPLevelChange> Entries;
+	uint64 CurrentVersion = 0;
+
+	/**
+	 * Highest version whose entry was dropped by trimming or Clear
+	 * Folding gives an entry a new version, so the oldest retained version
+	 * cannot tell whether anything was dropped.
+	 */
+	uint64 DroppedThroughVersion = 0;
+
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle ActorMovedHandle;
+	FDelegateHandle ActorLabelChangedHandle;
+	FDelegateHandle PropertyChangedHandle;
+	FDelegateHandle MapChangeHandle;
+	FDelegateHandle UndoRedoHandle;
+
+	bool bInitialized = false;
+};
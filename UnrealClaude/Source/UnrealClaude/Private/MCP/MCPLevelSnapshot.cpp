@@ -0,0 +1,548 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPLevelSnapshot.h"
+#include "MCPPropertyPath.h"
+#include "UnrealClaudeModule.h"
+#include "UnrealClaudeConstants.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "GameFramework/Actor.h"
+#include "EngineUtils.h"
+#include "ScopedTransaction.h"
+#include "Misc/Crc.h"
+#include "Misc/PackageName.h"
+
+using namespace UnrealClaudeConstants::LevelSnapshot;
+
+namespace
+{
+	void AddFieldNames(EMCPSnapshotField Fields, TArray<FString>& OutNames)
+	{
+		if (EnumHasAnyFlags(Fields, EMCPSnapshotField::Class)) { OutNames.Add(TEXT("class")); }
+		if (EnumHasAnyFlags(Fields, EMCPSnapshotField::Transform)) { OutNames.Add(TEXT("transform")); }
+		if (EnumHasAnyFlags(Fields, EMCPSnapshotField::Label)) { OutNames.Add(TEXT("label")); }
+		if (EnumHasAnyFlags(Fields, EMCPSnapshotField::Hidden)) { OutNames.Add(TEXT("hidden")); }
+		if (EnumHasAnyFlags(Fields, EMCPSnapshotField::Folder)) { OutNames.Add(TEXT("folder")); }
+		if (EnumHasAnyFlags(Fields, EMCPSnapshotField::Properties)) { OutNames.Add(TEXT("properties")); }
+	}
+
+	TSharedPtr<FJsonObject> RecordToJson(const FMCPActorRecord& Record)
+	{
+		TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+		Json->SetStringField(TEXT("name"), Record.ActorName);
+		Json->SetStringField(TEXT("label"), Record.Label);
+		Json->SetStringField(TEXT("class"), FPackageName::ObjectPathToObjectName(Record.ClassPath));
+		return Json;
+	}
+}
+
+FMCPLevelSnapshotStore& FMCPLevelSnapshotStore::Get()
+{
+	static FMCPLevelSnapshotStore Instance;
+	return Instance;
+}
+
+// ===== Capture =====
+
+TSharedRef<FMCPLevelSnapshot> FMCPLevelSnapshotStore::Capture(UWorld* World, const FString& Name, const TArray<FString>& PropertyPaths)
+{
+	TSharedRef<FMCPLevelSnapshot> Snapshot = MakeShared<FMCPLevelSnapshot>();
+	Snapshot->Name = Name;
+	Snapshot->CreatedAt = FDateTime::UtcNow();
+	Snapshot->PropertyPaths = PropertyPaths;
+
+	if (!World)
+	{
+		return Snapshot;
+	}
+
+	Snapshot->WorldPath = World->GetPathName();
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		AActor* Actor = *It;
+		if (ShouldCapture(Actor))
+		{
+			CaptureActor(Actor, PropertyPaths, Snapshot->Actors.Add(Actor->GetPathName()));
+		}
+	}
+
+	return Snapshot;
+}
+
+bool FMCPLevelSnapshotStore::ShouldCapture(const AActor* Actor)
+{
+	// Skip editor-internal actors (world settings, brushes the outliner hides, transient previews)
+	return IsValid(Actor) && !Actor->IsTemplate() && !Actor->HasAnyFlags(RF_Transient) && Actor->IsListedInSceneOutliner();
+}
+
+void FMCPLevelSnapshotStore::CaptureActor(AActor* Actor, const TArray<FString>& PropertyPaths, FMCPActorRecord& OutRecord)
+{
+	OutRecord.ActorName = Actor->GetName();
+	OutRecord.Label = Actor->GetActorLabel();
+	OutRecord.ClassPath = Actor->GetClass()->GetPathName();
+	OutRecord.LevelPath = Actor->GetLevel() ? Actor->GetLevel()->GetPathName() : FString();
+	OutRecord.FolderPath = Actor->GetFolderPath().ToString();
+	OutRecord.Transform = Actor->GetActorTransform();
+	OutRecord.bHidden = Actor->IsHidden();
+
+	for (const FString& Path : PropertyPaths)
+	{
+		FMCPResolvedProperty Resolved;
+		FString ResolveError;
+		if (FMCPPropertyPathCache::Get().Resolve(Actor, Path, Resolved, ResolveError))
+		{
+			FString Value;
+			Resolved.Property->ExportTextItem_Direct(Value, Resolved.ValuePtr, nullptr, Resolved.Object, PPF_None);
+			OutRecord.Properties.Add(Path, MoveTemp(Value));
+		}
+	}
+
+	OutRecord.TransformHash = HashTransform(OutRecord.Transform);
+
+	uint32 Hash = FCrc::StrCrc32(*OutRecord.ClassPath);
+	Hash = HashCombine(Hash, FCrc::StrCrc32(*OutRecord.Label));
+	Hash = HashCombine(Hash, FCrc::StrCrc32(*OutRecord.FolderPath));
+	Hash = HashCombine(Hash, GetTypeHash(OutRecord.bHidden));
+	Hash = HashCombine(Hash, OutRecord.TransformHash);
+	for (const TPair<FString, FString>& Property : OutRecord.Properties)
+	{
+		Hash = HashCombine(Hash, FCrc::StrCrc32(*Property.Key));
+		Hash = HashCombine(Hash, FCrc::StrCrc32(*Property.Value));
+	}
+	OutRecord.StateHash = Hash;
+}
+
+uint32 FMCPLevelSnapshotStore::HashTransform(const FTransform& Transform)
+{
+	auto Quantize = [](double Value, double Step)
+	{
+		return GetTypeHash(FMath::RoundToInt64(Value / Step));
+	};
+
+	// q and -q are the same rotation; hash one canonical sign
+	FQuat Rotation = Transform.GetRotation().GetNormalized();
+	if (Rotation.W < 0.0)
+	{
+		Rotation = FQuat(-Rotation.X, -Rotation.Y, -Rotation.Z, -Rotation.W);
+	}
+	const FVector Location = Transform.GetLocation();
+	const FVector Scale = Transform.GetScale3D();
+
+	uint32 Hash = Quantize(Location.X, LocationTolerance);
+	Hash = HashCombine(Hash, Quantize(Location.Y, LocationTolerance));
+	Hash = HashCombine(Hash, Quantize(Location.Z, LocationTolerance));
+	Hash = HashCombine(Hash, Quantize(Rotation.X, RotationTolerance));
+	Hash = HashCombine(Hash, Quantize(Rotation.Y, RotationTolerance));
+	Hash = HashCombine(Hash, Quantize(Rotation.Z, RotationTolerance));
+	Hash = HashCombine(Hash, Quantize(Rotation.W, RotationTolerance));
+	Hash = HashCombine(Hash, Quantize(Scale.X, ScaleTolerance));
+	Hash = HashCombine(Hash, Quantize(Scale.Y, ScaleTolerance));
+	Hash = HashCombine(Hash, Quantize(Scale.Z, ScaleTolerance));
+	return Hash;
+}
+
+// ===== Storage =====
+
+void FMCPLevelSnapshotStore::Add(const TSharedRef<FMCPLevelSnapshot>& Snapshot)
+{
+	Remove(Snapshot->Name);
+	Snapshots.Add(Snapshot);
+
+	while (Snapshots.Num() > MaxSnapshots)
+	{
+		UE_LOG(LogUnrealClaude, Log, TEXT("Dropping level snapshot '%s' (limit %d)"), *Snapshots[0]->Name, MaxSnapshots);
+		Snapshots.RemoveAt(0);
+	}
+}
+
+TSharedPtr<FMCPLevelSnapshot> FMCPLevelSnapshotStore::Find(const FString& Name) const
+{
+	for (const TSharedRef<FMCPLevelSnapshot>& Snapshot : Snapshots)
+	{
+		if (Snapshot->Name == Name)
+		{
+			return Snapshot;
+		}
+	}
+	return nullptr;
+}
+
+bool FMCPLevelSnapshotStore::Remove(const FString& Name)
+{
+	return Snapshots.RemoveAll([&Name](const TSharedRef<FMCPLevelSnapshot>& Snapshot)
+	{
+		return Snapshot->Name == Name;
+	}) > 0;
+}
+
+FString FMCPLevelSnapshotStore::MakeUniqueName() const
+{
+	for (int32 Index = 1; ; ++Index)
+	{
+		FString Candidate = FString::Printf(TEXT("snapshot_%d"), Index);
+		if (!Find(Candidate).IsValid())
+		{
+			return Candidate;
+		}
+	}
+}
+
+// ===== Diff =====
+
+EMCPSnapshotField FMCPLevelSnapshotStore::CompareRecords(const FMCPActorRecord& From, const FMCPActorRecord& To, TArray<FString>& OutChangedProperties)
+{
+	EMCPSnapshotField Fields = EMCPSnapshotField::None;
+
+	if (From.ClassPath != To.ClassPath)
+	{
+		Fields |= EMCPSnapshotField::Class;
+	}
+
+	// Hashes quantize, so confirm with tolerances to avoid flagging values that straddle a bucket edge
+	if (From.TransformHash != To.TransformHash &&
+		(!From.Transform.GetLocation().Equals(To.Transform.GetLocation(), LocationTolerance) ||
+		 !From.Transform.GetRotation().Equals(To.Transform.GetRotation(), RotationTolerance) ||
+		 !From.Transform.GetScale3D().Equals(To.Transform.GetScale3D(), ScaleTolerance)))
+	{
+		Fields |= EMCPSnapshotField::Transform;
+	}
+
+	if (!From.Label.Equals(To.Label, ESearchCase::CaseSensitive))
+	{
+		Fields |= EMCPSnapshotField::Label;
+	}
+	if (From.bHidden != To.bHidden)
+	{
+		Fields |= EMCPSnapshotField::Hidden;
+	}
+	if (!From.FolderPath.Equals(To.FolderPath, ESearchCase::CaseSensitive))
+	{
+		Fields |= EMCPSnapshotField::Folder;
+	}
+
+	for (const TPair<FString, FString>& Property : From.Properties)
+	{
+		const FString* ToValue = To.Properties.Find(Property.Key);
+		if (!ToValue || !ToValue->Equals(Property.Value, ESearchCase::CaseSensitive))
+		{
+			OutChangedProperties.Add(Property.Key);
+		}
+	}
+	for (const TPair<FString, FString>& Property : To.Properties)
+	{
+		if (!From.Properties.Contains(Property.Key))
+		{
+			OutChangedProperties.Add(Property.Key);
+		}
+	}
+	if (OutChangedProperties.Num() > 0)
+	{
+		Fields |= EMCPSnapshotField::Properties;
+	}
+
+	return Fields;
+}
+
+void FMCPLevelSnapshotStore::Diff(const FMCPLevelSnapshot& From, const FMCPLevelSnapshot& To, FMCPLevelDiff& OutDiff)
+{
+	OutDiff = FMCPLevelDiff();
+
+	for (const TPair<FString, FMCPActorRecord>& Pair : From.Actors)
+	{
+		const FMCPActorRecord* ToRecord = To.Actors.Find(Pair.Key);
+		if (!ToRecord)
+		{
+			OutDiff.Removed.Add(Pair.Key);
+			continue;
+		}
+
+		if (ToRecord->StateHash == Pair.Value.StateHash)
+		{
+			OutDiff.UnchangedCount++;
+			continue;
+		}
+
+		FMCPActorDiff ActorDiff;
+		ActorDiff.ActorPath = Pair.Key;
+		ActorDiff.Fields = CompareRecords(Pair.Value, *ToRecord, ActorDiff.ChangedProperties);
+		if (ActorDiff.Fields == EMCPSnapshotField::None)
+		{
+			OutDiff.UnchangedCount++;
+		}
+		else
+		{
+			OutDiff.Changed.Add(MoveTemp(ActorDiff));
+		}
+	}
+
+	for (const TPair<FString, FMCPActorRecord>& Pair : To.Actors)
+	{
+		if (!From.Actors.Contains(Pair.Key))
+		{
+			OutDiff.Added.Add(Pair.Key);
+		}
+	}
+}
+
+TSharedPtr<FJsonObject> FMCPLevelSnapshotStore::DiffToJson(const FMCPLevelDiff& Diff, const FMCPLevelSnapshot& From,
+	const FMCPLevelSnapshot& To, int32 MaxEntries)
+{
+	auto ListRecords = [MaxEntries](const TArray<FString>& Paths, const FMCPLevelSnapshot& Source)
+	{
+		TArray<TSharedPtr<FJsonValue>> Array;
+		for (int32 i = 0; i < Paths.Num() && i < MaxEntries; ++i)
+		{
+			if (const FMCPActorRecord* Record = Source.Actors.Find(Paths[i]))
+			{
+				Array.Add(MakeShared<FJsonValueObject>(RecordToJson(*Record)));
+			}
+		}
+		return Array;
+	};
+
+	TArray<TSharedPtr<FJsonValue>> ChangedArray;
+	for (int32 i = 0; i < Diff.Changed.Num() && i < MaxEntries; ++i)
+	{
+		const FMCPActorDiff& ActorDiff = Diff.Changed[i];
+		const FMCPActorRecord* Record = To.Actors.Find(ActorDiff.ActorPath);
+		if (!Record)
+		{
+			continue;
+		}
+
+		TSharedPtr<FJsonObject> Json = RecordToJson(*Record);
+		TArray<FString> FieldNames;
+		AddFieldNames(ActorDiff.Fields, FieldNames);
+		TArray<TSharedPtr<FJsonValue>> FieldArray;
+		for (const FString& FieldName : FieldNames)
+		{
+			FieldArray.Add(MakeShared<FJsonValueString>(FieldName));
+		}
+		Json->SetArrayField(TEXT("fields"), FieldArray);
+
+		if (ActorDiff.ChangedProperties.Num() > 0)
+		{
+			TArray<TSharedPtr<FJsonValue>> PropertyArray;
+			for (const FString& Property : ActorDiff.ChangedProperties)
+			{
+				PropertyArray.Add(MakeShared<FJsonValueString>(Property));
+			}
+			Json->SetArrayField(TEXT("properties"), PropertyArray);
+		}
+		ChangedArray.Add(MakeShared<FJsonValueObject>(Json));
+	}
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetArrayField(TEXT("added"), ListRecords(Diff.Added, To));
+	Result->SetArrayField(TEXT("removed"), ListRecords(Diff.Removed, From));
+	Result->SetArrayField(TEXT("changed"), ChangedArray);
+	Result->SetNumberField(TEXT("addedCount"), Diff.Added.Num());
+	Result->SetNumberField(TEXT("removedCount"), Diff.Removed.Num());
+	Result->SetNumberField(TEXT("changedCount"), Diff.Changed.Num());
+	Result->SetNumberField(TEXT("unchanged"), Diff.UnchangedCount);
+	if (Diff.Added.Num() > MaxEntries || Diff.Removed.Num() > MaxEntries || Diff.Changed.Num() > MaxEntries)
+	{
+		Result->SetBoolField(TEXT("truncated"), true);
+	}
+	return Result;
+}
+
+// ===== Restore =====
+
+bool FMCPLevelSnapshotStore::ApplyRecord(AActor* Actor, const FMCPActorRecord& Record, EMCPSnapshotField Fields,
+	const TArray<FString>& Properties, FString& OutError)
+{
+	Actor->Modify();
+
+	if (EnumHasAnyFlags(Fields, EMCPSnapshotField::Transform))
+	{
+		Actor->SetActorTransform(Record.Transform, false, nullptr, ETeleportType::TeleportPhysics);
+	}
+	if (EnumHasAnyFlags(Fields, EMCPSnapshotField::Label))
+	{
+		Actor->SetActorLabel(Record.Label);
+	}
+	if (EnumHasAnyFlags(Fields, EMCPSnapshotField::Hidden))
+	{
+		Actor->SetActorHiddenInGame(Record.bHidden);
+	}
+	if (EnumHasAnyFlags(Fields, EMCPSnapshotField::Folder))
+	{
+		Actor->SetFolderPath(FName(*Record.FolderPath));
+	}
+
+	bool bAllApplied = true;
+	for (const FString& Path : Properties)
+	{
+		// Properties the snapshot could not read are left alone
+		const FString* Value = Record.Properties.Find(Path);
+		if (!Value)
+		{
+			continue;
+		}
+
+		FMCPResolvedProperty Resolved;
+		FString ResolveError;
+		if (!FMCPPropertyPathCache::Get().Resolve(Actor, Path, Resolved, ResolveError))
+		{
+			OutError += FString::Printf(TEXT("%s: %s; "), *Record.Label, *ResolveError);
+			bAllApplied = false;
+			continue;
+		}
+
+		UObject* Object = Resolved.Object;
+		Object->Modify();
+		Object->PreEditChange(Resolved.MemberProperty);
+		if (!Resolved.Property->ImportText_Direct(**Value, Resolved.ValuePtr, Object, PPF_None))
+		{
+			OutError += FString::Printf(TEXT("%s: could not restore '%s'; "), *Record.Label, *Path);
+			bAllApplied = false;
+		}
+		FPropertyChangedEvent ChangedEvent(Resolved.MemberProperty, EPropertyChangeType::ValueSet);
+		Object->PostEditChangeProperty(ChangedEvent);
+	}
+
+	if (EnumHasAnyFlags(Fields, EMCPSnapshotField::Transform) && GEngine)
+	{
+		GEngine->BroadcastOnActorMoved(Actor);
+	}
+	Actor->MarkPackageDirty();
+
+	return bAllApplied;
+}
+
+void FMCPLevelSnapshotStore::Restore(UWorld* World, const FMCPLevelSnapshot& Target, const FMCPLevelDiff& Plan,
+	FMCPRestoreResult& OutResult)
+{
+	if (!World)
+	{
+		return;
+	}
+
+	const FScopedTransaction Transaction(NSLOCTEXT("UnrealClaude", "RestoreLevelSnapshot", "Restore Level Snapshot"));
+
+	// Actors whose class changed cannot be patched in place; they are replaced like deleted ones
+	TArray<FString> ToRespawn = Plan.Removed;
+	TArray<FString> ToDestroy = Plan.Added;
+	for (const FMCPActorDiff& ActorDiff : Plan.Changed)
+	{
+		if (EnumHasAnyFlags(ActorDiff.Fields, EMCPSnapshotField::Class))
+		{
+			ToDestroy.Add(ActorDiff.ActorPath);
+			ToRespawn.Add(ActorDiff.ActorPath);
+		}
+	}
+
+	// Destroy first so respawned actors can request their original names
+	for (const FString& Path : ToDestroy)
+	{
+		AActor* Actor = FindObject<AActor>(nullptr, *Path);
+		if (!IsValid(Actor))
+		{
+			continue;
+		}
+		const FString Label = Actor->GetActorLabel();
+		if (World->EditorDestroyActor(Actor, true))
+		{
+			OutResult.Destroyed.Add(Label);
+		}
+		else
+		{
+			OutResult.Errors.Add(FString::Printf(TEXT("Could not delete '%s'"), *Label));
+		}
+	}
+
+	for (const FString& Path : ToRespawn)
+	{
+		const FMCPActorRecord& Record = Target.Actors.FindChecked(Path);
+		UClass* ActorClass = LoadClass<AActor>(nullptr, *Record.ClassPath);
+		if (!ActorClass)
+		{
+			OutResult.Errors.Add(FString::Printf(TEXT("Could not load class '%s' for '%s'"), *Record.ClassPath, *Record.Label));
+			continue;
+		}
+
+		// Respawn into the level that owned the actor; an unloaded streaming level falls back to the persistent one
+		ULevel* SpawnLevel = World->PersistentLevel;
+		if (!Record.LevelPath.IsEmpty() && Record.LevelPath != SpawnLevel->GetPathName())
+		{
+			ULevel* const* OwningLevel = World->GetLevels().FindByPredicate([&Record](const ULevel* Level)
+			{
+				return Level && Level->GetPathName() == Record.LevelPath;
+			});
+			if (OwningLevel)
+			{
+				SpawnLevel = *OwningLevel;
+			}
+			else
+			{
+				OutResult.Errors.Add(FString::Printf(TEXT("Level '%s' of '%s' is not loaded; recreated in the persistent level"),
+					*Record.LevelPath, *Record.Label));
+			}
+		}
+
+		// A destroyed actor keeps its name until garbage collection, and Requested would then
+		// silently pick another one; move the dead object aside so the name is free again
+		const FName RequestedName(*Record.ActorName);
+		UObject* NameHolder = StaticFindObjectFast(nullptr, SpawnLevel, RequestedName);
+		if (NameHolder && !IsValid(NameHolder))
+		{
+			const FName DeadName = MakeUniqueObjectName(SpawnLevel, NameHolder->GetClass(),
+				FName(*(Record.ActorName + TEXT("_Destroyed"))));
+			NameHolder->Rename(*DeadName.ToString(), nullptr, REN_DontCreateRedirectors | REN_ForceNoResetLoaders);
+		}
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.Name = RequestedName;
+		SpawnParams.OverrideLevel = SpawnLevel;
+		SpawnParams.NameMode = FActorSpawnParameters::ESpawnActorNameMode::Requested;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		AActor* Spawned = World->SpawnActor<AActor>(ActorClass, Record.Transform, SpawnParams);
+		if (!Spawned)
+		{
+			OutResult.Errors.Add(FString::Printf(TEXT("Could not respawn '%s'"), *Record.Label));
+			continue;
+		}
+
+		// A live object still holds the name; report the name the actor got instead
+		if (Spawned->GetFName() != RequestedName)
+		{
+			OutResult.Renamed.Add(Record.ActorName, Spawned->GetName());
+		}
+
+		TArray<FString> PropertyPaths;
+		Record.Properties.GetKeys(PropertyPaths);
+		FString ApplyError;
+		if (!ApplyRecord(Spawned, Record, EMCPSnapshotField::Label | EMCPSnapshotField::Hidden | EMCPSnapshotField::Folder,
+			PropertyPaths, ApplyError))
+		{
+			OutResult.Errors.Add(ApplyError);
+		}
+		OutResult.Respawned.Add(Spawned->GetActorLabel());
+	}
+
+	for (const FMCPActorDiff& ActorDiff : Plan.Changed)
+	{
+		if (EnumHasAnyFlags(ActorDiff.Fields, EMCPSnapshotField::Class))
+		{
+			continue;
+		}
+
+		AActor* Actor = FindObject<AActor>(nullptr, *ActorDiff.ActorPath);
+		const FMCPActorRecord* Record = Target.Actors.Find(ActorDiff.ActorPath);
+		if (!IsValid(Actor) || !Record)
+		{
+			continue;
+		}
+
+		FString ApplyError;
+		if (!ApplyRecord(Actor, *Record, ActorDiff.Fields, ActorDiff.ChangedProperties, ApplyError))
+		{
+			OutResult.Errors.Add(ApplyError);
+		}
+		OutResult.Updated.Add(Record->Label);
+	}
+}
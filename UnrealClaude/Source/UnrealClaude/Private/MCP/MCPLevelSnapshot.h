@@ -0,0 +1,166 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+class AActor;
+class UWorld;
+
+/**
+ * Parts of an actor's recorded state that can differ between snapshots
+ */
+enum class EMCPSnapshotField : uint8
+{
+	None = 0,
+	Class = 1 << 0,
+	Transform = 1 << 1,
+	Label = 1 << 2,
+	Hidden = 1 << 3,
+	Folder = 1 << 4,
+	Properties = 1 << 5
+};
+ENUM_CLASS_FLAGS(EMCPSnapshotField);
+
+/**
+ * Recorded state of one actor
+ */
+struct FMCPActorRecord
+{
+	FString ActorName;
+	FString Label;
+	FString ClassPath;
+
+	/** Path of the level that owned the actor (persistent or streaming), so a respawn keeps its object path */
+	FString LevelPath;
+
+	FString FolderPath;
+	FTransform Transform;
+	bool bHidden = false;
+
+	/** Exported text of each captured property path that resolved on this actor */
+	TMap<FString, FString> Properties;
+
+	/** Hash of the quantized transform */
+	uint32 TransformHash = 0;
+
+	/** Hash of everything above; equal hashes mean the actor is unchanged */
+	uint32 StateHash = 0;
+};
+
+/**
+ * Recorded state of every actor in a level
+ */
+struct FMCPLevelSnapshot
+{
+	FString Name;
+	FString WorldPath;
+	FDateTime CreatedAt;
+
+	/** Extra property paths captured for each actor (e.g. 'StaticMeshComponent.StaticMesh') */
+	TArray<FString> PropertyPaths;
+
+	/** Records keyed by actor object path */
+	TMap<FString, FMCPActorRecord> Actors;
+};
+
+/**
+ * Difference of one actor between two snapshots
+ */
+struct FMCPActorDiff
+{
+	FString ActorPath;
+	EMCPSnapshotField Fields = EMCPSnapshotField::None;
+	TArray<FString> ChangedProperties;
+};
+
+/**
+ * Difference between two snapshots
+ */
+struct FMCPLevelDiff
+{
+	/** Actor paths only present in the 'to' snapshot */
+	TArray<FString> Added;
+
+	/** Actor paths only present in the 'from' snapshot */
+	TArray<FString> Removed;
+
+	TArray<FMCPActorDiff> Changed;
+	int32 UnchangedCount = 0;
+
+	bool IsEmpty() const { return Added.Num() == 0 && Removed.Num() == 0 && Changed.Num() == 0; }
+};
+
+/**
+ * Outcome of restoring a snapshot
+ */
+struct FMCPRestoreResult
+{
+	TArray<FString> Destroyed;
+	TArray<FString> Respawned;
+	TArray<FString> Updated;
+	TArray<FString> Errors;
+
+	/** Respawned actors whose original object name was taken by a live object: original -> new name */
+	TMap<FString, FString> Renamed;
+};
+
+/**
+ * In-memory level snapshots with hash-based diff and restore
+ *
+ * Each actor record carries a hash of its class, quantized transform, label,
+ * visibility, folder and captured properties, so diffing two snapshots is a
+ * hash comparison per actor; field-level comparison only runs for actors
+ * whose hashes differ. Restore applies just that diff inside one undoable
+ * transaction. Respawned actors get their class defaults plus whatever the
+ * snapshot captured, so capture the properties that matter (meshes,
+ * materials) when actors may be deleted.
+ *
+ * Game thread only.
+ */
+class FMCPLevelSnapshotStore
+{
+public:
+	static FMCPLevelSnapshotStore& Get();
+
+	/** Record the current state of every user-visible actor in World */
+	static TSharedRef<FMCPLevelSnapshot> Capture(UWorld* World, const FString& Name, const TArray<FString>& PropertyPaths);
+
+	/** Store a snapshot, replacing one with the same name and evicting the oldest beyond the cap */
+	void Add(const TSharedRef<FMCPLevelSnapshot>& Snapshot);
+
+	TSharedPtr<FMCPLevelSnapshot> Find(const FString& Name) const;
+
+	bool Remove(const FString& Name);
+
+	/** Stored snapshots, oldest first */
+	const TArray<TSharedRef<FMCPLevelSnapshot>>& GetAll() const { return Snapshots; }
+
+	/** Name for a snapshot captured without one */
+	FString MakeUniqueName() const;
+
+	/** Compare two snapshots */
+	static void Diff(const FMCPLevelSnapshot& From, const FMCPLevelSnapshot& To, FMCPLevelDiff& OutDiff);
+
+	/**
+	 * Return World to Target by applying Diff(Target, live state)
+	 * @param Plan - Diff from Target to a live capture taken with Target's property paths
+	 */
+	static void Restore(UWorld* World, const FMCPLevelSnapshot& Target, const FMCPLevelDiff& Plan, FMCPRestoreResult& OutResult);
+
+	/** Serialize a diff, listing at most MaxEntries actors per category */
+	static TSharedPtr<FJsonObject> DiffToJson(const FMCPLevelDiff& Diff, const FMCPLevelSnapshot& From,
+		const FMCPLevelSnapshot& To, int32 MaxEntries);
+
+private:
+	FMCPLevelSnapshotStore() = default;
+
+	static bool ShouldCapture(const AActor* Actor);
+	static void CaptureActor(AActor* Actor, const TArray<FString>& PropertyPaths, FMCPActorRecord& OutRecord);
+	static uint32 HashTransform(const FTransform& Transform);
+	static EMCPSnapshotField CompareRecords(const FMCPActorRecord& From, const FMCPActorRecord& To, TArray<FString>& OutChangedProperties);
+	static bool ApplyRecord(AActor* Actor, const FMCPActorRecord& Record, EMCPSnapshotField Fields, const TArray<FString>& Properties, FString& OutError);
+
+	TArray<TSharedRef<FMCPLevelSnapshot>> Snapshots;
+};
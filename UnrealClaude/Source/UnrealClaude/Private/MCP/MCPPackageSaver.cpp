@@ -0,0 +1,196 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPPackageSaver.h"
+#include "UnrealClaudeModule.h"
+#include "FileHelpers.h"
+#include "HAL/FileManager.h"
+#include "ISourceControlModule.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+namespace
+{
+	FSavePackageArgs MakeSaveArgs()
+	{
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		return SaveArgs;
+	}
+
+	/** Check out packages whose files are read-only, in one source control request */
+	void CheckOutReadOnlyPackages(const TArray<UPackage*>& Packages)
+	{
+		if (!ISourceControlModule::Get().IsEnabled())
+		{
+			return;
+		}
+
+		TArray<UPackage*> ReadOnlyPackages;
+		for (UPackage* Package : Packages)
+		{
+			const FString FileName = FMCPPackageSaver::GetPackageFileName(Package);
+			if (!FileName.IsEmpty() && IFileManager::Get().IsReadOnly(*FileName))
+			{
+				ReadOnlyPackages.AddUnique(Package);
+			}
+		}
+
+		if (ReadOnlyPackages.Num() > 0)
+		{
+			FEditorFileUtils::CheckoutPackages(ReadOnlyPackages, nullptr, /*bErrorIfAlreadyCheckedOut=*/ false);
+		}
+	}
+
+	/** Checks shared by single and batched saves; fills OutResult.Error on failure */
+	bool PrepareSave(UPackage* Package, FMCPPackageSaveResult& OutResult)
+	{
+		OutResult.PackageName = Package->GetName();
+		OutResult.FileName = FMCPPackageSaver::GetPackageFileName(Package);
+
+		if (OutResult.FileName.IsEmpty())
+		{
+			OutResult.Error = TEXT("Package has no file on disk (transient or script package)");
+			return false;
+		}
+		if (IFileManager::Get().IsReadOnly(*OutResult.FileName))
+		{
+			OutResult.Error = FString::Printf(TEXT("File is read-only and could not be checked out: %s"), *OutResult.FileName);
+			return false;
+		}
+		return true;
+	}
+}
+
+FString FMCPPackageSaver::GetPackageFileName(const UPackage* Package)
+{
+	FString FileName;
+	if (!Package || !FPackageName::TryConvertLongPackageNameToFilename(Package->GetName(), FileName,
+		Package->ContainsMap() ? FPackageName::GetMapPackageExtension() : FPackageName::GetAssetPackageExtension()))
+	{
+		return FString();
+	}
+	return FPaths::ConvertRelativePathToFull(FileName);
+}
+
+bool FMCPPackageSaver::SaveAsset(UObject* Asset, FString& OutError)
+{
+	if (!Asset)
+	{
+		OutError = TEXT("Cannot save null asset");
+		return false;
+	}
+
+	UPackage* Package = Asset->GetOutermost();
+	if (!Package)
+	{
+		OutError = TEXT("Asset has no package");
+		return false;
+	}
+
+	CheckOutReadOnlyPackages({ Package });
+
+	FMCPPackageSaveResult Result;
+	if (!PrepareSave(Package, Result))
+	{
+		OutError = Result.Error;
+		return false;
+	}
+
+	const FSavePackageResultStruct SaveResult = UPackage::Save(Package, Asset, *Result.FileName, MakeSaveArgs());
+	if (!SaveResult.IsSuccessful())
+	{
+		OutError = FString::Printf(TEXT("Failed to save asset: %s"), *Result.FileName);
+		return false;
+	}
+	return true;
+}
+
+int32 FMCPPackageSaver::SavePackages(const TArray<UPackage*>& Packages, bool bAllowConcurrent, TArray<FMCPPackageSaveResult>& OutResults)
+{
+	OutResults.Reset();
+	OutResults.Reserve(Packages.Num());
+
+	TSet<UPackage*> Seen;
+	TArray<FPackageSaveInfo> ConcurrentSaves;
+	TArray<int32> ConcurrentResultIndices;
+	TArray<int32> SequentialResultIndices;
+	TArray<UPackage*> SequentialPackages;
+
+	CheckOutReadOnlyPackages(Packages);
+
+	for (UPackage* Package : Packages)
+	{
+		if (!Package)
+		{
+			continue;
+		}
+		bool bAlreadySeen = false;
+		Seen.Add(Package, &bAlreadySeen);
+		if (bAlreadySeen)
+		{
+			continue;
+		}
+
+		const int32 ResultIndex = OutResults.AddDefaulted();
+		if (!PrepareSave(Package, OutResults[ResultIndex]))
+		{
+			continue;
+		}
+
+		if (bAllowConcurrent && !Package->ContainsMap())
+		{
+			FPackageSaveInfo& SaveInfo = ConcurrentSaves.AddDefaulted_GetRef();
+			SaveInfo.Package = Package;
+			SaveInfo.Asset = Package->FindAssetInPackage();
+			SaveInfo.Filename = OutResults[ResultIndex].FileName;
+			ConcurrentResultIndices.Add(ResultIndex);
+		}
+		else
+		{
+			SequentialPackages.Add(Package);
+			SequentialResultIndices.Add(ResultIndex);
+		}
+	}
+
+	const FSavePackageArgs SaveArgs = MakeSaveArgs();
+
+	if (ConcurrentSaves.Num() > 0)
+	{
+		TArray<FSavePackageResultStruct> SaveResults;
+		UPackage::SaveConcurrent(ConcurrentSaves, SaveArgs, SaveResults);
+
+		for (int32 i = 0; i < ConcurrentResultIndices.Num(); ++i)
+		{
+			FMCPPackageSaveResult& Result = OutResults[ConcurrentResultIndices[i]];
+			Result.bConcurrent = true;
+			Result.bSuccess = SaveResults.IsValidIndex(i) && SaveResults[i].IsSuccessful();
+			if (!Result.bSuccess)
+			{
+				Result.Error = FString::Printf(TEXT("Failed to save package: %s"), *Result.FileName);
+			}
+		}
+	}
+
+	for (int32 i = 0; i < SequentialPackages.Num(); ++i)
+	{
+		UPackage* Package = SequentialPackages[i];
+		FMCPPackageSaveResult& Result = OutResults[SequentialResultIndices[i]];
+		const FSavePackageResultStruct SaveResult = UPackage::Save(Package, Package->FindAssetInPackage(), *Result.FileName, SaveArgs);
+		Result.bSuccess = SaveResult.IsSuccessful();
+		if (!Result.bSuccess)
+		{
+			Result.Error = FString::Printf(TEXT("Failed to save package: %s"), *Result.FileName);
+		}
+	}
+
+	int32 SavedCount = 0;
+	for (const FMCPPackageSaveResult& Result : OutResults)
+	{
+		SavedCount += Result.bSuccess ? 1 : 0;
+	}
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Saved %d of %d packages (%d concurrently)"),
+		SavedCount, OutResults.Num(), ConcurrentSaves.Num());
+	return SavedCount;
+}
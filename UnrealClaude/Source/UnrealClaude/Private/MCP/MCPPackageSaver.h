@@ -0,0 +1,55 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Outcome of saving one package */
+struct FMCPPackageSaveResult
+{
+	FString PackageName;
+	FString FileName;
+	bool bSuccess = false;
+
+	/** Saved through the engine's concurrent save path */
+	bool bConcurrent = false;
+
+	FString Error;
+};
+
+/**
+ * Shared package saving for MCP tools
+ *
+ * Single-asset saves go through SaveAsset. SavePackages saves many packages
+ * as one batch. Read-only files are first checked out of source control
+ * (one request for the whole batch), then each package is validated (has a
+ * file name, file is writable). Packages without a map are written together
+ * through UPackage::SaveConcurrent and maps are saved one at a time, since
+ * world packages are not safe to serialize concurrently. Every package gets
+ * its own result, so one failure does not hide the rest.
+ *
+ * Game thread only.
+ */
+class FMCPPackageSaver
+{
+public:
+	/**
+	 * Save the package containing an asset
+	 * @param Asset - Asset whose package is saved
+	 * @param OutError - Error message if the save fails
+	 * @return true if the package was written
+	 */
+	static bool SaveAsset(UObject* Asset, FString& OutError);
+
+	/**
+	 * Save many packages in one batch
+	 * @param Packages - Packages to save (duplicates are saved once)
+	 * @param bAllowConcurrent - Use the concurrent save path for packages that allow it
+	 * @param OutResults - One result per unique package, in input order
+	 * @return Number of packages saved successfully
+	 */
+	static int32 SavePackages(const TArray<UPackage*>& Packages, bool bAllowConcurrent, TArray<FMCPPackageSaveResult>& OutResults);
+
+	/** On-disk file name for a package (.umap for maps, .uasset otherwise) */
+	static FString GetPackageFileName(const UPackage* Package);
+};
@@ -0,0 +1,298 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPPropertyPath.h"
+#include "UnrealClaudeConstants.h"
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+#include "Editor.h"
+#include "UObject/UObjectGlobals.h"
+
+FMCPPropertyPathCache& FMCPPropertyPathCache::Get()
+{
+	static FMCPPropertyPathCache Instance;
+	return Instance;
+}
+
+void FMCPPropertyPathCache::Initialize()
+{
+	if (bInitialized)
+	{
+		return;
+	}
+
+	// Recompiled Blueprint classes free their old properties at GC
+	PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FMCPPropertyPathCache::Reset);
+
+	// Recompiles, reinstancing and hot reload change property layouts before the next GC
+	ObjectsReinstancedHandle = FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda([this](const FCoreUObjectDelegates::FReplacementObjectMap&)
+	{
+		Reset();
+	});
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason)
+	{
+		Reset();
+	});
+	if (GEditor)
+	{
+		BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FMCPPropertyPathCache::Reset);
+	}
+	bInitialized = true;
+}
+
+void FMCPPropertyPathCache::Shutdown()
+{
+	if (!bInitialized)
+	{
+		return;
+	}
+
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	FCoreUObjectDelegates::OnObjectsReinstanced.Remove(ObjectsReinstancedHandle);
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+	if (GEditor)
+	{
+		GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+	}
+	Chains.Empty();
+	bInitialized = false;
+}
+
+void FMCPPropertyPathCache::Reset()
+{
+	Chains.Reset();
+}
+
+bool FMCPPropertyPathCache::Resolve(UObject* Root, const FString& Path, FMCPResolvedProperty& OutResolved, FString& OutError)
+{
+	if (!Root)
+	{
+		OutError = TEXT("Invalid object");
+		return false;
+	}
+
+	return ResolveFrom(Root->GetClass(), Root, Root, Path, OutResolved, OutError);
+}
+
+bool FMCPPropertyPathCache::ResolveInStruct(const UStruct* Struct, void* Data, UObject* Owner, const FString& Path, FMCPResolvedProperty& OutResolved, FString& OutError)
+{
+	if (!Struct || !Data)
+	{
+		OutError = TEXT("Invalid struct");
+		return false;
+	}
+
+	return ResolveFrom(Struct, Data, Owner, Path, OutResolved, OutError);
+}
+
+bool FMCPPropertyPathCache::ResolveFrom(const UStruct* Struct, void* Data, UObject* Owner, const FString& Path, FMCPResolvedProperty& OutResolved, FString& OutError)
+{
+	UObject* Object = Owner;
+	FString CurrentPath = Path;
+
+	// Every object boundary consumes at least one path segment, so this terminates
+	for (;;)
+	{
+		const FChain* Chain = FindOrCompile(Struct, CurrentPath, OutError);
+		if (!Chain)
+		{
+			return false;
+		}
+
+		void* Cursor = Data;
+		FProperty* LastProperty = nullptr;
+		FProperty* MemberProperty = nullptr;
+		for (const FStep& Step : Chain->Steps)
+		{
+			if (Step.ArrayIndex == INDEX_NONE)
+			{
+				Cursor = Step.Property->ContainerPtrToValuePtr<void>(Cursor);
+				LastProperty = Step.Property;
+				if (!MemberProperty)
+				{
+					MemberProperty = Step.Property;
+				}
+				continue;
+			}
+
+			FArrayProperty* ArrayProp = CastFieldChecked<FArrayProperty>(Step.Property);
+			FScriptArrayHelper ArrayHelper(ArrayProp, Cursor);
+			if (!ArrayHelper.IsValidIndex(Step.ArrayIndex))
+			{
+				OutError = FString::Printf(TEXT("Array index %d out of bounds (size: %d)"), Step.ArrayIndex, ArrayHelper.Num());
+				return false;
+			}
+			Cursor = ArrayHelper.GetRawPtr(Step.ArrayIndex);
+			LastProperty = ArrayProp->Inner;
+		}
+
+		switch (Chain->Terminal)
+		{
+		case ETerminal::Leaf:
+			OutResolved.Object = Object;
+			OutResolved.Property = LastProperty;
+			OutResolved.MemberProperty = MemberProperty;
+			OutResolved.ValuePtr = Cursor;
+			return true;
+
+		case ETerminal::Object:
+		{
+			UObject* Nested = CastFieldChecked<FObjectPropertyBase>(LastProperty)->GetObjectPropertyValue(Cursor);
+			if (!Nested)
+			{
+				OutError = FString::Printf(TEXT("Nested object is null: %s"), *Chain->BoundaryName);
+				return false;
+			}
+			Object = Nested;
+			Struct = Nested->GetClass();
+			Data = Nested;
+			CurrentPath = Chain->Remaining;
+			break;
+		}
+
+		case ETerminal::Component:
+		{
+			// Exact name first, then the substring match set_property has always accepted
+			UActorComponent* Found = nullptr;
+			const FName ComponentName(*Chain->ComponentName, FNAME_Find);
+			for (UActorComponent* Component : CastChecked<AActor>(Object)->GetComponents())
+			{
+				if (!Component)
+				{
+					continue;
+				}
+				if (!ComponentName.IsNone() && Component->GetFName() == ComponentName)
+				{
+					Found = Component;
+					break;
+				}
+				if (!Found && Component->GetName().Contains(Chain->ComponentName))
+				{
+					Found = Component;
+				}
+			}
+			if (!Found)
+			{
+				OutError = FString::Printf(TEXT("Property not found: %s on %s"), *Chain->ComponentName, *Object->GetClass()->GetName());
+				return false;
+			}
+			Object = Found;
+			Struct = Found->GetClass();
+			Data = Found;
+			CurrentPath = Chain->Remaining;
+			break;
+		}
+		}
+	}
+}
+
+const FMCPPropertyPathCache::FChain* FMCPPropertyPathCache::FindOrCompile(const UStruct* Struct, const FString& Path, FString& OutError)
+{
+	const TPair<TObjectKey<UStruct>, FString> Key(Struct, Path);
+	if (const FChain* Existing = Chains.Find(Key))
+	{
+		return Existing;
+	}
+
+	FChain Chain;
+	if (!Compile(Struct, Path, Chain, OutError))
+	{
+		return nullptr;
+	}
+
+	if (Chains.Num() >= UnrealClaudeConstants::PropertyPath::MaxCachedPaths)
+	{
+		Chains.Reset();
+	}
+	return &Chains.Add(Key, MoveTemp(Chain));
+}
+
+bool FMCPPropertyPathCache::Compile(const UStruct* Struct, const FString& Path, FChain& OutChain, FString& OutError)
+{
+	TArray<FString> Parts;
+	Path.ParseIntoArray(Parts, TEXT("."), true);
+	if (Parts.Num() == 0)
+	{
+		OutError = TEXT("Empty property path");
+		return false;
+	}
+
+	auto JoinFrom = [&Parts](int32 Index)
+	{
+		return FString::Join(TArrayView<const FString>(Parts).Slice(Index, Parts.Num() - Index), TEXT("."));
+	};
+
+	const UStruct* Scope = Struct;
+	FProperty* Pending = nullptr;
+
+	for (int32 i = 0; i < Parts.Num(); ++i)
+	{
+		const FString& Part = Parts[i];
+
+		// Decide how to step past the value reached by the previous segment
+		if (Pending)
+		{
+			if (FArrayProperty* ArrayProp = CastField<FArrayProperty>(Pending))
+			{
+				if (!Part.IsNumeric())
+				{
+					OutError = FString::Printf(TEXT("Expected an index after array property '%s', got '%s'"), *Parts[i - 1], *Part);
+					return false;
+				}
+				FStep& Step = OutChain.Steps.AddDefaulted_GetRef();
+				Step.Property = ArrayProp;
+				Step.ArrayIndex = FCString::Atoi(*Part);
+				Pending = ArrayProp->Inner;
+				continue;
+			}
+
+			if (CastField<FObjectPropertyBase>(Pending))
+			{
+				// The rest depends on the referenced object's runtime class
+				OutChain.Terminal = ETerminal::Object;
+				OutChain.Remaining = JoinFrom(i);
+				OutChain.BoundaryName = Parts[i - 1];
+				return true;
+			}
+
+			FStructProperty* StructProp = CastField<FStructProperty>(Pending);
+			if (!StructProp)
+			{
+				OutError = FString::Printf(TEXT("Cannot navigate into property type: %s"), *Parts[i - 1]);
+				return false;
+			}
+			Scope = StructProp->Struct;
+			Pending = nullptr;
+		}
+
+		if (Part.IsNumeric())
+		{
+			OutError = TEXT("Cannot index without preceding array property");
+			return false;
+		}
+
+		FProperty* Property = Scope->FindPropertyByName(FName(*Part));
+		if (!Property)
+		{
+			// Unknown first segment on an actor may name a component
+			const bool bAtActorRoot = OutChain.Steps.Num() == 0 && Scope == Struct && Struct->IsChildOf(AActor::StaticClass());
+			if (bAtActorRoot && i < Parts.Num() - 1)
+			{
+				OutChain.Terminal = ETerminal::Component;
+				OutChain.ComponentName = Part;
+				OutChain.Remaining = JoinFrom(i + 1);
+				OutChain.BoundaryName = Part;
+				return true;
+			}
+
+			OutError = FString::Printf(TEXT("Property not found: %s on %s"), *Part, *Scope->GetName());
+			return false;
+		}
+
+		FStep& Step = OutChain.Steps.AddDefaulted_GetRef();
+		Step.Property = Property;
+		Pending = Property;
+	}
+
+	OutChain.Terminal = ETerminal::Leaf;
+	return true;
+}
@@ -0,0 +1,130 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ * Result of resolving a property path on an object
+ */
+struct FMCPResolvedProperty
+{
+	/** Object that owns the value (the root, a component, or a nested object) */
+	UObject* Object = nullptr;
+
+	/** Property describing the value (an array's inner property for indexed paths) */
+	FProperty* Property = nullptr;
+
+	/** Direct member of Object containing the value; use for Modify/PostEditChangeProperty */
+	FProperty* MemberProperty = nullptr;
+
+	/** Address of the value */
+	void* ValuePtr = nullptr;
+};
+
+/**
+ * Shared property-path resolver with a compiled-path cache
+ *
+ * Paths are dot-separated: property names, array indices ('Materials.0'),
+ * struct members ('RelativeLocation.X'), nested object properties, and on
+ * actors, component names ('LightComponent.Intensity').
+ *
+ * Each (type, path) is compiled once into a chain of FProperty steps. A
+ * chain ends where the path crosses into another object (an object property
+ * or a component), and the rest of the path is compiled against that
+ * object's runtime class, so repeated edits on objects of the same classes
+ * skip reflection lookups entirely. The cache is dropped whenever property
+ * layouts can change or properties can be freed: Blueprint compiles, object
+ * reinstancing, hot reload / Live Coding, and garbage collection.
+ *
+ * Game thread only.
+ */
+class FMCPPropertyPathCache
+{
+public:
+	static FMCPPropertyPathCache& Get();
+
+	/** Bind the compile, reinstance, reload and garbage-collection delegates (call once at module startup) */
+	void Initialize();
+
+	/** Unbind delegates and drop the cache (call at module shutdown) */
+	void Shutdown();
+
+	/**
+	 * Resolve a property path on an object
+	 * @param Root - Object the path starts from
+	 * @param Path - Dot-separated property path
+	 * @param OutResolved - Resolved value location
+	 * @param OutError - Error message if resolution fails
+	 * @return true if the path resolved
+	 */
+	bool Resolve(UObject* Root, const FString& Path, FMCPResolvedProperty& OutResolved, FString& OutError);
+
+	/**
+	 * Resolve a property path inside a struct instance (e.g. a DataTable row)
+	 * @param Struct - Type of the struct
+	 * @param Data - Address of the struct instance
+	 * @param Owner - Object that owns the instance; reported as the value's owner
+	 * @param Path - Dot-separated property path
+	 * @param OutResolved - Resolved value location
+	 * @param OutError - Error message if resolution fails
+	 * @return true if the path resolved
+	 */
+	bool ResolveInStruct(const UStruct* Struct, void* Data, UObject* Owner, const FString& Path, FMCPResolvedProperty& OutResolved, FString& OutError);
+
+	/** Drop all compiled paths */
+	void Reset();
+
+	/** Number of compiled (type, path) chains */
+	int32 GetCachedPathCount() const { return Chains.Num(); }
+
+private:
+	FMCPPropertyPathCache() = default;
+
+	/** One step inside a single object's memory */
+	struct FStep
+	{
+		/** Property to offset into, or the array property being indexed */
+		FProperty* Property = nullptr;
+
+		/** Element index when Property is an array being indexed */
+		int32 ArrayIndex = INDEX_NONE;
+	};
+
+	/** How a compiled chain ends */
+	enum class ETerminal : uint8
+	{
+		/** The last step's value is the target */
+		Leaf,
+		/** The last step's value is an object pointer; continue with Remaining on it */
+		Object,
+		/** Look up a component named ComponentName on the actor; continue with Remaining on it */
+		Component
+	};
+
+	/** Compiled path segment for one class or struct */
+	struct FChain
+	{
+		TArray<FStep> Steps;
+		ETerminal Terminal = ETerminal::Leaf;
+		FString ComponentName;
+		FString Remaining;
+
+		/** Path segment that led to the next object, for error messages */
+		FString BoundaryName;
+	};
+
+	/** Walk Path from a value of type Struct at Data, crossing into nested objects as needed */
+	bool ResolveFrom(const UStruct* Struct, void* Data, UObject* Owner, const FString& Path, FMCPResolvedProperty& OutResolved, FString& OutError);
+
+	const FChain* FindOrCompile(const UStruct* Struct, const FString& Path, FString& OutError);
+	static bool Compile(const UStruct* Struct, const FString& Path, FChain& OutChain, FString& OutError);
+
+	TMap<TPair<TObjectKey<UStruct>, FString>, FChain> Chains;
+	FDelegateHandle PostGarbageCollectHandle;
+	FDelegateHandle ObjectsReinstancedHandle;
+	FDelegateHandle ReloadCompleteHandle;
+	FDelegateHandle BlueprintCompiledHandle;
+	bool bInitialized = false;
+};
@@ -0,0 +1,535 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPSpatialIndex.h"
+#include "UnrealClaudeModule.h"
+#include "UnrealClaudeConstants.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "GameFramework/Actor.h"
+#include "EngineUtils.h"
+#include "Algo/Sort.h"
+
+using namespace UnrealClaudeConstants::SpatialQuery;
+
+FMCPSpatialIndex& FMCPSpatialIndex::Get()
+{
+	static FMCPSpatialIndex Instance;
+	return Instance;
+}
+
+void FMCPSpatialIndex::Initialize()
+{
+	if (bInitialized || !GEngine)
+	{
+		return;
+	}
+
+	ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FMCPSpatialIndex::OnActorAdded);
+	ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FMCPSpatialIndex::OnActorDeleted);
+	ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FMCPSpatialIndex::NotifyActorMoved);
+	ActorListChangedHandle = GEngine->OnLevelActorListChanged().AddRaw(this, &FMCPSpatialIndex::InvalidateAll);
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddRaw(this, &FMCPSpatialIndex::OnLevelChanged);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddRaw(this, &FMCPSpatialIndex::OnLevelChanged);
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(this, &FMCPSpatialIndex::OnWorldCleanup);
+	MapChangeHandle = FEditorDelegates::MapChange.AddLambda([this](uint32) { InvalidateAll(); });
+	UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FMCPSpatialIndex::InvalidateAll);
+
+	bInitialized = true;
+	UE_LOG(LogUnrealClaude, Log, TEXT("Spatial actor index initialized"));
+}
+
+void FMCPSpatialIndex::Shutdown()
+{
+	if (!bInitialized)
+	{
+		return;
+	}
+
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+		GEngine->OnActorMoved().Remove(ActorMovedHandle);
+		GEngine->OnLevelActorListChanged().Remove(ActorListChangedHandle);
+	}
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+	FEditorDelegates::MapChange.Remove(MapChangeHandle);
+	FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+
+	WorldGrids.Empty();
+	bInitialized = false;
+}
+
+// ===== Queries =====
+
+void FMCPSpatialIndex::QuerySphere(UWorld* World, const FVector& Center, double Radius, FActorFilter Filter, TArray<FMCPSpatialHit>& OutHits)
+{
+	OutHits.Reset();
+	if (!World || Radius < 0.0)
+	{
+		return;
+	}
+
+	const double RadiusSq = Radius * Radius;
+	const FBox QueryBox(Center - FVector(Radius), Center + FVector(Radius));
+
+	ForEachCandidate(GetOrBuildGrid(World), QueryBox, [&](AActor* Actor, const FBox& Bounds)
+	{
+		const double DistSq = Bounds.ComputeSquaredDistanceToPoint(Center);
+		if (DistSq <= RadiusSq && Filter(Actor))
+		{
+			OutHits.Add({ Actor, FMath::Sqrt(DistSq) });
+		}
+	});
+
+	SortHits(OutHits);
+}
+
+void FMCPSpatialIndex::QueryBox(UWorld* World, const FBox& Box, FActorFilter Filter, TArray<FMCPSpatialHit>& OutHits)
+{
+	OutHits.Reset();
+	if (!World || !Box.IsValid)
+	{
+		return;
+	}
+
+	const FVector BoxCenter = Box.GetCenter();
+
+	ForEachCandidate(GetOrBuildGrid(World), Box, [&](AActor* Actor, const FBox& Bounds)
+	{
+		if (Bounds.Intersect(Box) && Filter(Actor))
+		{
+			OutHits.Add({ Actor, FMath::Sqrt(Bounds.ComputeSquaredDistanceToPoint(BoxCenter)) });
+		}
+	});
+
+	SortHits(OutHits);
+}
+
+void FMCPSpatialIndex::QueryCorridor(UWorld* World, const FVector& Start, const FVector& End, double Radius, FActorFilter Filter, TArray<FMCPSpatialHit>& OutHits)
+{
+	OutHits.Reset();
+	if (!World || Radius < 0.0)
+	{
+		return;
+	}
+
+	const FVector Delta = End - Start;
+	const double Length = Delta.Size();
+	const FVector Direction = Length > UE_KINDA_SMALL_NUMBER ? Delta / Length : FVector::ForwardVector;
+
+	FBox QueryBox(Start, Start);
+	QueryBox += End;
+	QueryBox = QueryBox.ExpandBy(Radius);
+
+	ForEachCandidate(GetOrBuildGrid(World), QueryBox, [&](AActor* Actor, const FBox& Bounds)
+	{
+		// Segment vs bounds grown by the corridor radius (slightly generous at box corners)
+		const FBox Grown = Bounds.ExpandBy(Radius);
+		const bool bHit = Grown.IsInsideOrOn(Start) || Grown.IsInsideOrOn(End) ||
+			(Length > UE_KINDA_SMALL_NUMBER && FMath::LineBoxIntersection(Grown, Start, End, Delta));
+		if (bHit && Filter(Actor))
+		{
+			const double Along = FMath::Clamp(FVector::DotProduct(Bounds.GetCenter() - Start, Direction), 0.0, Length);
+			OutHits.Add({ Actor, Along });
+		}
+	});
+
+	SortHits(OutHits);
+}
+
+void FMCPSpatialIndex::QueryNearest(UWorld* World, const FVector& Center, int32 Count, double MaxRadius, FActorFilter Filter, TArray<FMCPSpatialHit>& OutHits)
+{
+	OutHits.Reset();
+	if (!World || Count <= 0)
+	{
+		return;
+	}
+
+	FWorldGrid& Grid = GetOrBuildGrid(World);
+	const bool bBounded = MaxRadius > 0.0;
+	const double MaxRadiusSq = MaxRadius * MaxRadius;
+
+	// Max-heap on distance holding the best Count hits so far
+	auto FarthestFirst = [](const FMCPSpatialHit& A, const FMCPSpatialHit& B) { return A.Distance > B.Distance; };
+	TArray<FMCPSpatialHit> Heap;
+	TSet<TObjectKey<AActor>> Visited;
+
+	auto Consider = [&](const TObjectKey<AActor>& Key)
+	{
+		bool bAlreadyVisited = false;
+		Visited.Add(Key, &bAlreadyVisited);
+		if (bAlreadyVisited)
+		{
+			return;
+		}
+
+		const FEntry* Entry = Grid.Entries.Find(Key);
+		AActor* Actor = Entry ? Entry->Actor.Get() : nullptr;
+		if (!IsValid(Actor))
+		{
+			return;
+		}
+
+		const double DistSq = Entry->Bounds.ComputeSquaredDistanceToPoint(Center);
+		if (bBounded && DistSq > MaxRadiusSq)
+		{
+			return;
+		}
+
+		const double Dist = FMath::Sqrt(DistSq);
+		if (Heap.Num() >= Count && Dist >= Heap.HeapTop().Distance)
+		{
+			return;
+		}
+
+		if (!Filter(Actor))
+		{
+			return;
+		}
+
+		Heap.HeapPush({ Actor, Dist }, FarthestFirst);
+		if (Heap.Num() > Count)
+		{
+			Heap.HeapPopDiscard(FarthestFirst, EAllowShrinking::No);
+		}
+	};
+
+	for (const TObjectKey<AActor>& Key : Grid.Oversized)
+	{
+		Consider(Key);
+	}
+
+	// Furthest ring that can still contain occupied cells
+	const FIntVector CenterCell = ToCell(Center);
+	int32 MaxRing = 0;
+	for (const auto& CellPair : Grid.Cells)
+	{
+		const FIntVector D = CellPair.Key - CenterCell;
+		MaxRing = FMath::Max(MaxRing, FMath::Max3(FMath::Abs(D.X), FMath::Abs(D.Y), FMath::Abs(D.Z)));
+	}
+
+	// Expand Chebyshev rings of cells outward. Anything in ring R or beyond is at
+	// least (R - 1) * CellSize away, which bounds when the search can stop.
+	for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+	{
+		const double RingMinDistance = FMath::Max(0, Ring - 1) * CellSize;
+		if (Heap.Num() >= Count && Heap.HeapTop().Distance <= RingMinDistance)
+		{
+			break;
+		}
+		if (bBounded && RingMinDistance > MaxRadius)
+		{
+			break;
+		}
+
+		const int32 Side = 2 * Ring + 1;
+		const int32 RingCellCount = Ring == 0 ? 1 : Side * Side * Side - (Side - 2) * (Side - 2) * (Side - 2);
+
+		// Sparse grids: cheaper to sweep occupied cells than enumerate the shell
+		if (RingCellCount > Grid.Cells.Num())
+		{
+			for (const auto& CellPair : Grid.Cells)
+			{
+				const FIntVector D = CellPair.Key - CenterCell;
+				if (FMath::Max3(FMath::Abs(D.X), FMath::Abs(D.Y), FMath::Abs(D.Z)) >= Ring)
+				{
+					for (const TObjectKey<AActor>& Key : CellPair.Value)
+					{
+						Consider(Key);
+					}
+				}
+			}
+			break;
+		}
+
+		for (int32 X = -Ring; X <= Ring; ++X)
+		{
+			for (int32 Y = -Ring; Y <= Ring; ++Y)
+			{
+				const bool bXYEdge = FMath::Abs(X) == Ring || FMath::Abs(Y) == Ring;
+				for (int32 Z = -Ring; Z <= Ring; Z += (bXYEdge ? 1 : FMath::Max(1, 2 * Ring)))
+				{
+					if (const TArray<TObjectKey<AActor>>* Cell = Grid.Cells.Find(CenterCell + FIntVector(X, Y, Z)))
+					{
+						for (const TObjectKey<AActor>& Key : *Cell)
+						{
+							Consider(Key);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	OutHits = MoveTemp(Heap);
+	SortHits(OutHits);
+}
+
+// ===== Maintenance =====
+
+void FMCPSpatialIndex::NotifyActorMoved(AActor* Actor)
+{
+	if (FWorldGrid* Grid = FindGridForActor(Actor))
+	{
+		RemoveActor(*Grid, Actor);
+		AddActor(*Grid, Actor);
+	}
+}
+
+void FMCPSpatialIndex::InvalidateWorld(UWorld* World)
+{
+	if (World)
+	{
+		WorldGrids.Remove(TObjectKey<UWorld>(World));
+	}
+}
+
+void FMCPSpatialIndex::InvalidateAll()
+{
+	WorldGrids.Empty();
+}
+
+int32 FMCPSpatialIndex::GetIndexedActorCount(UWorld* World)
+{
+	return World ? GetOrBuildGrid(World).Entries.Num() : 0;
+}
+
+FMCPSpatialIndex::FWorldGrid& FMCPSpatialIndex::GetOrBuildGrid(UWorld* World)
+{
+	const TObjectKey<UWorld> Key(World);
+
+	// Without delegates a cached grid could be stale, so always rebuild
+	if (!bInitialized)
+	{
+		WorldGrids.Remove(Key);
+	}
+
+	if (FWorldGrid* Existing = WorldGrids.Find(Key))
+	{
+		return *Existing;
+	}
+
+	FWorldGrid& Grid = WorldGrids.Add(Key);
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		if (AActor* Actor = *It)
+		{
+			AddActor(Grid, Actor);
+		}
+	}
+
+	UE_LOG(LogUnrealClaude, Verbose, TEXT("Built spatial index for %s (%d actors, %d cells, %d oversized)"),
+		*World->GetMapName(), Grid.Entries.Num(), Grid.Cells.Num(), Grid.Oversized.Num());
+	return Grid;
+}
+
+FMCPSpatialIndex::FWorldGrid* FMCPSpatialIndex::FindGridForActor(const AActor* Actor)
+{
+	if (!Actor)
+	{
+		return nullptr;
+	}
+	UWorld* World = Actor->GetWorld();
+	return World ? WorldGrids.Find(TObjectKey<UWorld>(World)) : nullptr;
+}
+
+FBox FMCPSpatialIndex::GetActorBounds(const AActor* Actor)
+{
+	FBox Bounds = Actor->GetComponentsBoundingBox(true);
+	if (!Bounds.IsValid)
+	{
+		// Actors without primitives (lights, targets, managers) are treated as points
+		const FVector Location = Actor->GetActorLocation();
+		Bounds = FBox(Location, Location);
+	}
+	return Bounds;
+}
+
+FIntVector FMCPSpatialIndex::ToCell(const FVector& Location)
+{
+	return FIntVector(
+		FMath::FloorToInt32(Location.X / CellSize),
+		FMath::FloorToInt32(Location.Y / CellSize),
+		FMath::FloorToInt32(Location.Z / CellSize));
+}
+
+void FMCPSpatialIndex::AddActor(FWorldGrid& Grid, AActor* Actor)
+{
+	const TObjectKey<AActor> Key(Actor);
+	if (Grid.Entries.Contains(Key))
+	{
+		return;
+	}
+
+	FEntry Entry;
+	Entry.Actor = Actor;
+	Entry.Bounds = GetActorBounds(Actor);
+	Entry.MinCell = ToCell(Entry.Bounds.Min);
+	Entry.MaxCell = ToCell(Entry.Bounds.Max);
+
+	const FIntVector Span = Entry.MaxCell - Entry.MinCell + FIntVector(1);
+	const int64 CellCount = int64(Span.X) * Span.Y * Span.Z;
+	Entry.bOversized = CellCount > MaxCellsPerActor;
+
+	if (Entry.bOversized)
+	{
+		Grid.Oversized.Add(Key);
+	}
+	else
+	{
+		for (int32 X = Entry.MinCell.X; X <= Entry.MaxCell.X; ++X)
+		{
+			for (int32 Y = Entry.MinCell.Y; Y <= Entry.MaxCell.Y; ++Y)
+			{
+				for (int32 Z = Entry.MinCell.Z; Z <= Entry.MaxCell.Z; ++Z)
+				{
+					Grid.Cells.FindOrAdd(FIntVector(X, Y, Z)).Add(Key);
+				}
+			}
+		}
+	}
+
+	Grid.Entries.Add(Key, MoveTemp(Entry));
+}
+
+void FMCPSpatialIndex::RemoveActor(FWorldGrid& Grid, const AActor* Actor)
+{
+	const TObjectKey<AActor> Key(Actor);
+	FEntry Entry;
+	if (!Grid.Entries.RemoveAndCopyValue(Key, Entry))
+	{
+		return;
+	}
+
+	if (Entry.bOversized)
+	{
+		Grid.Oversized.Remove(Key);
+		return;
+	}
+
+	for (int32 X = Entry.MinCell.X; X <= Entry.MaxCell.X; ++X)
+	{
+		for (int32 Y = Entry.MinCell.Y; Y <= Entry.MaxCell.Y; ++Y)
+		{
+			for (int32 Z = Entry.MinCell.Z; Z <= Entry.MaxCell.Z; ++Z)
+			{
+				const FIntVector Cell(X, Y, Z);
+				if (TArray<TObjectKey<AActor>>* Keys = Grid.Cells.Find(Cell))
+				{
+					Keys->RemoveSingleSwap(Key, EAllowShrinking::No);
+					if (Keys->Num() == 0)
+					{
+						Grid.Cells.Remove(Cell);
+					}
+				}
+			}
+		}
+	}
+}
+
+void FMCPSpatialIndex::ForEachCandidate(FWorldGrid& Grid, const FBox& Box, TFunctionRef<void(AActor*, const FBox&)> Visitor)
+{
+	TSet<TObjectKey<AActor>> Visited;
+
+	auto Visit = [&](const TObjectKey<AActor>& Key)
+	{
+		bool bAlreadyVisited = false;
+		Visited.Add(Key, &bAlreadyVisited);
+		if (bAlreadyVisited)
+		{
+			return;
+		}
+		if (const FEntry* Entry = Grid.Entries.Find(Key))
+		{
+			AActor* Actor = Entry->Actor.Get();
+			if (IsValid(Actor))
+			{
+				Visitor(Actor, Entry->Bounds);
+			}
+		}
+	};
+
+	for (const TObjectKey<AActor>& Key : Grid.Oversized)
+	{
+		Visit(Key);
+	}
+
+	const FIntVector MinCell = ToCell(Box.Min);
+	const FIntVector MaxCell = ToCell(Box.Max);
+	const FIntVector Span = MaxCell - MinCell + FIntVector(1);
+	const int64 QueryCellCount = int64(Span.X) * Span.Y * Span.Z;
+
+	// Large query regions: sweep occupied cells instead of enumerating empty ones
+	if (QueryCellCount > Grid.Cells.Num())
+	{
+		for (const auto& CellPair : Grid.Cells)
+		{
+			const FIntVector& C = CellPair.Key;
+			if (C.X >= MinCell.X && C.X <= MaxCell.X &&
+				C.Y >= MinCell.Y && C.Y <= MaxCell.Y &&
+				C.Z >= MinCell.Z && C.Z <= MaxCell.Z)
+			{
+				for (const TObjectKey<AActor>& Key : CellPair.Value)
+				{
+					Visit(Key);
+				}
+			}
+		}
+		return;
+	}
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				if (const TArray<TObjectKey<AActor>>* Keys = Grid.Cells.Find(FIntVector(X, Y, Z)))
+				{
+					for (const TObjectKey<AActor>& Key : *Keys)
+					{
+						Visit(Key);
+					}
+				}
+			}
+		}
+	}
+}
+
+void FMCPSpatialIndex::SortHits(TArray<FMCPSpatialHit>& Hits)
+{
+	Algo::SortBy(Hits, &FMCPSpatialHit::Distance);
+}
+
+// ===== Delegate Handlers =====
+
+void FMCPSpatialIndex::OnActorAdded(AActor* Actor)
+{
+	if (FWorldGrid* Grid = FindGridForActor(Actor))
+	{
+		AddActor(*Grid, Actor);
+	}
+}
+
+void FMCPSpatialIndex::OnActorDeleted(AActor* Actor)
+{
+	if (FWorldGrid* Grid = FindGridForActor(Actor))
+	{
+		RemoveActor(*Grid, Actor);
+	}
+}
+
+void FMCPSpatialIndex::OnLevelChanged(ULevel* Level, UWorld* World)
+{
+	InvalidateWorld(World);
+}
+
+void FMCPSpatialIndex::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	InvalidateWorld(World);
+}
@@ -0,0 +1,125 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class AActor;
+class ULevel;
+class UWorld;
+
+/**
+ * Result of a spatial actor query
+ */
+struct FMCPSpatialHit
+{
+	/** Matching actor */
+	AActor* Actor = nullptr;
+
+	/** Query-specific distance (to bounds, or along the ray for corridor queries) */
+	double Distance = 0.0;
+};
+
+/**
+ * Per-world uniform spatial hash over actor bounds
+ *
+ * Built lazily per world on first query and kept current from editor actor
+ * add/delete/move delegates. Actors whose bounds cover too many cells (sky
+ * spheres, landscapes, volumes) are kept in a separate list checked by every
+ * query so they don't bloat the grid.
+ *
+ * Game thread only.
+ */
+class FMCPSpatialIndex
+{
+public:
+	/** Predicate deciding whether an actor may appear in results */
+	using FActorFilter = TFunctionRef<bool(AActor*)>;
+
+	static FMCPSpatialIndex& Get();
+
+	/** Bind editor delegates (call once at module startup) */
+	void Initialize();
+
+	/** Unbind delegates and drop all indexes (call at module shutdown) */
+	void Shutdown();
+
+	/** Actors whose bounds are within Radius of Center, sorted by distance */
+	void QuerySphere(UWorld* World, const FVector& Center, double Radius, FActorFilter Filter, TArray<FMCPSpatialHit>& OutHits);
+
+	/** Actors whose bounds intersect Box, sorted by distance to the box center */
+	void QueryBox(UWorld* World, const FBox& Box, FActorFilter Filter, TArray<FMCPSpatialHit>& OutHits);
+
+	/** Actors whose bounds come within Radius of the segment Start-End, sorted by distance along the segment */
+	void QueryCorridor(UWorld* World, const FVector& Start, const FVector& End, double Radius, FActorFilter Filter, TArray<FMCPSpatialHit>& OutHits);
+
+	/** Up to Count actors nearest to Center (MaxRadius <= 0 means unbounded), sorted by distance */
+	void QueryNearest(UWorld* World, const FVector& Center, int32 Count, double MaxRadius, FActorFilter Filter, TArray<FMCPSpatialHit>& OutHits);
+
+	/** Re-read an actor's bounds (call after moving it outside the editor's move events) */
+	void NotifyActorMoved(AActor* Actor);
+
+	/** Drop the index for a world (rebuilt lazily on next query) */
+	void InvalidateWorld(UWorld* World);
+
+	/** Drop all indexes */
+	void InvalidateAll();
+
+	/** Number of actors indexed for a world (builds the index if needed) */
+	int32 GetIndexedActorCount(UWorld* World);
+
+private:
+	FMCPSpatialIndex() = default;
+
+	/** Indexed bounds of a single actor */
+	struct FEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FBox Bounds;
+		FIntVector MinCell;
+		FIntVector MaxCell;
+		bool bOversized = false;
+	};
+
+	/** Spatial hash for a single world */
+	struct FWorldGrid
+	{
+		TMap<FIntVector, TArray<TObjectKey<AActor>>> Cells;
+		TMap<TObjectKey<AActor>, FEntry> Entries;
+		TSet<TObjectKey<AActor>> Oversized;
+	};
+
+	FWorldGrid& GetOrBuildGrid(UWorld* World);
+	FWorldGrid* FindGridForActor(const AActor* Actor);
+
+	static FBox GetActorBounds(const AActor* Actor);
+	static FIntVector ToCell(const FVector& Location);
+	static void AddActor(FWorldGrid& Grid, AActor* Actor);
+	static void RemoveActor(FWorldGrid& Grid, const AActor* Actor);
+
+	/** Visit every live entry in cells overlapping Box plus all oversized entries (each at most once) */
+	static void ForEachCandidate(FWorldGrid& Grid, const FBox& Box, TFunctionRef<void(AActor*, const FBox&)> Visitor);
+
+	static void SortHits(TArray<FMCPSpatialHit>& Hits);
+
+	// Delegate handlers
+	void OnActorAdded(AActor* Actor);
+	void OnActorDeleted(AActor* Actor);
+	void OnLevelChanged(ULevel* Level, UWorld* World);
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+	TMap<TObjectKey<UWorld>, FWorldGrid> WorldGrids;
+
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle ActorMovedHandle;
+	FDelegateHandle ActorListChangedHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+	FDelegateHandle WorldCleanupHandle;
+	FDelegateHandle MapChangeHandle;
+	FDelegateHandle UndoRedoHandle;
+
+	bool bInitialized = false;
+};
@@ -2,6 +2,7 @@
 
 #include "MCPTaskQueue.h"
 #include "MCPToolRegistry.h"
+#include "MCPAssetPreloader.h"
 #include "UnrealClaudeModule.h"
 #include "Async/Async.h"
 
@@ -353,13 +354,45 @@ void FMCPTaskQueue::ExecuteTask(TSharedPtr<FMCPAsyncTask> Task)
 	// with the task's own timeout instead of the registry's 30-second default.
 	// This allows permission dialogs + Live Coding compilation to take their time.
 	IMCPTool* Tool = ToolRegistry->FindTool(Task->ToolName);
+
+	// Stream in the assets the tool declared while this worker waits, so the
+	// game-thread part runs with everything resident instead of loading inline
+	FMCPAssetPreloadResult Preload;
+	if (Tool)
+	{
+		Preload = FMCPAssetPreloader::Preload(Tool, Params, Task->TimeoutMs, Task->bCancellationRequested);
+		if (Preload.bCancelled)
+		{
+			Task->Status.Store(EMCPTaskStatus::Cancelled);
+			Task->CompletedTime = FDateTime::UtcNow();
+			Task->Result = FMCPToolResult::Error(TEXT("Task cancelled while loading assets"));
+			return;
+		}
+		if (Preload.Requested > 0)
+		{
+			UE_LOG(LogUnrealClaude, Log, TEXT("Task %s: preloaded %d/%d assets in %.2fs (%d already loaded, %d failed%s)"),
+				*Task->TaskId.ToString(), Preload.Loaded, Preload.Requested, Preload.Seconds,
+				Preload.AlreadyLoaded, Preload.Failed.Num(), Preload.bTimedOut ? TEXT(", timed out") : TEXT(""));
+		}
+	}
+
+	// The preload and the execution share the task's timeout
+	const uint32 PreloadMs = FMath::Min(static_cast<uint32>(Preload.Seconds * 1000.0), Task->TimeoutMs);
+	const uint32 ExecutionTimeoutMs = Task->TimeoutMs - PreloadMs;
+
 	if (!Tool)
 	{
 		Result = FMCPToolResult::Error(FString::Printf(TEXT("Tool '%s' not found"), *Task->ToolName));
 	}
-	else if (Task->TimeoutMs > 30000)
+	else if (Preload.bTimedOut || ExecutionTimeoutMs == 0)
+	{
+		Result = FMCPToolResult::Error(FString::Printf(
+			TEXT("Task timed out after %d seconds while loading assets"), Task->TimeoutMs / 1000));
+	}
+	else if (Task->TimeoutMs > 30000 || PreloadMs > 0)
 	{
-		// Long-running task: bypass registry's 30s game thread timeout
+		// Long-running task, or one whose preload used part of its budget:
+		// bypass registry's 30s game thread timeout and wait only for the time left
 		TSharedPtr<FMCPToolResult> SharedResult = MakeShared<FMCPToolResult>();
 		TSharedPtr<FEvent, ESPMode::ThreadSafe> CompletionEvent = MakeShareable(
 			FPlatformProcess::GetSynchEventFromPool(),
@@ -373,11 +406,11 @@ void FMCPTaskQueue::ExecuteTask(TSharedPtr<FMCPAsyncTask> Task)
 			CompletionEvent->Trigger();
 		});
 
-		const bool bSignaled = CompletionEvent->Wait(Task->TimeoutMs);
+		const bool bSignaled = CompletionEvent->Wait(ExecutionTimeoutMs);
 		if (!bSignaled || !(*bCompleted))
 		{
-			UE_LOG(LogUnrealClaude, Error, TEXT("Task '%s' timed out after %d ms on game thread"),
-				*Task->ToolName, Task->TimeoutMs);
+			UE_LOG(LogUnrealClaude, Error, TEXT("Task '%s' timed out after %d ms on game thread (%d ms spent loading assets)"),
+				*Task->ToolName, ExecutionTimeoutMs, PreloadMs);
 			Result = FMCPToolResult::Error(FString::Printf(
 				TEXT("Task execution timed out after %d seconds"), Task->TimeoutMs / 1000));
 		}
@@ -392,6 +425,16 @@ void FMCPTaskQueue::ExecuteTask(TSharedPtr<FMCPAsyncTask> Task)
 		Result = ToolRegistry->ExecuteTool(Task->ToolName, Params);
 	}
 
+	if (TSharedPtr<FJsonObject> PreloadJson = Preload.ToJson())
+	{
+		if (!Result.Data.IsValid())
+		{
+			Result.Data = MakeShared<FJsonObject>();
+		}
+		Result.Data->SetObjectField(TEXT("preload"), PreloadJson);
+	}
+	FMCPAssetPreloader::Release(Preload);
+
 	// Check for cancellation after execution
 	if (Task->bCancellationRequested)
 	{
@@ -1,10 +1,11 @@
 // Copyright Natali Caggiano. All Rights Reserved.
 
 #include "MCPToolBase.h"
+#include "MCPActorIndex.h"
+#include "MCPWorldPartitionActors.h"
 #include "Editor.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
-#include "EngineUtils.h"
 
 TOptional<FMCPToolResult> FMCPToolBase::ValidateEditorContext(UWorld*& OutWorld) const
 {
@@ -26,20 +27,21 @@ TOptional<FMCPToolResult> FMCPToolBase::ValidateEditorContext(UWorld*& OutWorld)
 
 AActor* FMCPToolBase::FindActorByNameOrLabel(UWorld* World, const FString& NameOrLabel) const
 {
-	if (!World || NameOrLabel.IsEmpty())
+	return FMCPActorIndex::Get().FindActor(World, NameOrLabel);
+}
+
+AActor* FMCPToolBase::FindOrLoadActorByNameOrLabel(UWorld* World, const FString& NameOrLabel) const
+{
+	if (AActor* Actor = FindActorByNameOrLabel(World, NameOrLabel))
 	{
-		return nullptr;
+		return Actor;
 	}
 
-	for (TActorIterator<AActor> It(World); It; ++It)
+	FMCPUnloadedActorInfo Unloaded;
+	if (FMCPWorldPartitionActors::FindUnloaded(World, NameOrLabel, Unloaded))
 	{
-		AActor* Actor = *It;
-		if (Actor && (Actor->GetName() == NameOrLabel || Actor->GetActorLabel() == NameOrLabel))
-		{
-			return Actor;
-		}
+		return FMCPWorldPartitionActors::LoadActor(World, Unloaded.Guid);
 	}
-
 	return nullptr;
 }
 
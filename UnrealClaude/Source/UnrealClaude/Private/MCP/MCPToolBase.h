@@ -5,7 +5,10 @@
 #include "CoreMinimal.h"
 #include "MCPToolRegistry.h"
 #include "MCPParamValidator.h"
+#include "MCPFieldSet.h"
+#include "MCPClassResolver.h"
 #include "UnrealClaudeUtils.h"
+#include "Misc/PackageName.h"
 
 // Forward declarations
 class UWorld;
@@ -29,12 +32,22 @@ protected:
 
 	/**
 	 * Find an actor by name or label in the given world
+	 * Served from the shared per-world actor index (see FMCPActorIndex)
 	 * @param World - The world to search in
 	 * @param NameOrLabel - The actor name or label to search for
 	 * @return The found actor, or nullptr if not found
 	 */
 	AActor* FindActorByNameOrLabel(UWorld* World, const FString& NameOrLabel) const;
 
+	/**
+	 * Find an actor to modify by name or label, loading it if it is an unloaded World Partition actor
+	 * Only the actor itself is pinned, not its cells (see FMCPWorldPartitionActors)
+	 * @param World - The world to search in
+	 * @param NameOrLabel - The actor name or label to search for
+	 * @return The found actor, or nullptr if not found
+	 */
+	AActor* FindOrLoadActorByNameOrLabel(UWorld* World, const FString& NameOrLabel) const;
+
 	/**
 	 * Mark the world as dirty after modifications
 	 * @param World - The world to mark dirty
@@ -145,6 +158,37 @@ protected:
 		return DefaultValue;
 	}
 
+	/**
+	 * Add an asset path parameter to a GetRequiredAssets list
+	 * Package paths (/Game/Folder/BP_Name) are expanded to object paths (/Game/Folder/BP_Name.BP_Name);
+	 * missing or non-content paths are ignored, so Execute still reports them
+	 * @param Params - The JSON parameters
+	 * @param ParamName - The parameter holding the asset path
+	 * @param OutAssets - List to append to
+	 */
+	static void AddRequiredAssetParam(const TSharedRef<FJsonObject>& Params, const FString& ParamName,
+		TArray<FSoftObjectPath>& OutAssets)
+	{
+		FString Path;
+		if (!Params->TryGetStringField(ParamName, Path) || !Path.StartsWith(TEXT("/")))
+		{
+			return;
+		}
+		if (!Path.Contains(TEXT(".")))
+		{
+			if (!FPackageName::IsValidLongPackageName(Path))
+			{
+				return;
+			}
+			Path = FString::Printf(TEXT("%s.%s"), *Path, *FPackageName::GetShortName(Path));
+		}
+		FSoftObjectPath AssetPath(Path);
+		if (AssetPath.IsValid())
+		{
+			OutAssets.AddUnique(AssetPath);
+		}
+	}
+
 	// ===== Transform Extraction Helpers =====
 	// These consolidate vector/rotator/scale extraction from JSON parameters
 	// to eliminate duplicate code across MCP tools
@@ -437,39 +481,16 @@ protected:
 	// ===== Class Loading Helpers =====
 
 	/**
-	 * Load an actor class by path with fallback prefixes
-	 * Tries: full path, /Script/Engine., /Script/CoreUObject., FindObject
-	 * For Blueprint paths (/Game/...), automatically tries with _C suffix
+	 * Load an actor class by short name or path via FMCPClassResolver
+	 * Accepts short names ("PointLight"), script paths ("/Script/Engine.PointLight")
+	 * and Blueprint paths (/Game/..., with or without the _C suffix)
 	 * @param ClassPath - Class path or short name
 	 * @param OutError - Optional error result if class not found
 	 * @return Actor class or nullptr
 	 */
 	UClass* LoadActorClass(const FString& ClassPath, TOptional<FMCPToolResult>& OutError) const
 	{
-		UClass* ActorClass = LoadClass<AActor>(nullptr, *ClassPath);
-
-		// For Blueprint paths, try with _C suffix if not already present
-		if (!ActorClass && ClassPath.StartsWith(TEXT("/Game/")) && !ClassPath.EndsWith(TEXT("_C")))
-		{
-			FString BlueprintClassPath = ClassPath + TEXT("_C");
-			ActorClass = LoadClass<AActor>(nullptr, *BlueprintClassPath);
-		}
-
-		if (!ActorClass)
-		{
-			ActorClass = LoadClass<AActor>(nullptr, *FString::Printf(TEXT("/Script/Engine.%s"), *ClassPath));
-		}
-
-		if (!ActorClass)
-		{
-			ActorClass = LoadClass<AActor>(nullptr, *FString::Printf(TEXT("/Script/CoreUObject.%s"), *ClassPath));
-		}
-
-		if (!ActorClass)
-		{
-			ActorClass = FindObject<UClass>(nullptr, *ClassPath);
-		}
-
+		UClass* ActorClass = FMCPClassResolver::Get().FindClass(ClassPath, AActor::StaticClass());
 		if (!ActorClass)
 		{
 			OutError = FMCPToolResult::Error(FString::Printf(TEXT("Could not find actor class: %s"), *ClassPath));
@@ -524,6 +545,76 @@ protected:
 		return ActorJson;
 	}
 
+	/** Field names understood by BuildActorInfoJson(Actor, Fields) */
+	static const TArray<const TCHAR*>& GetActorInfoFieldNames()
+	{
+		static const TArray<const TCHAR*> Names = {
+			TEXT("name"), TEXT("label"), TEXT("class"), TEXT("folder"),
+			TEXT("location"), TEXT("rotation"), TEXT("scale"), TEXT("hidden"), TEXT("tags")
+		};
+		return Names;
+	}
+
+	/**
+	 * Build JSON object with the selected actor fields
+	 * Only selected fields are read from the actor.
+	 * @param Actor - Actor to serialize
+	 * @param Fields - Fields to emit (see GetActorInfoFieldNames)
+	 * @return JSON object with the selected fields
+	 */
+	TSharedPtr<FJsonObject> BuildActorInfoJson(AActor* Actor, const FMCPFieldSet& Fields) const
+	{
+		TSharedPtr<FJsonObject> ActorJson = MakeShared<FJsonObject>();
+		if (!Actor)
+		{
+			return ActorJson;
+		}
+
+		if (Fields.Has(TEXT("name")))
+		{
+			ActorJson->SetStringField(TEXT("name"), Actor->GetName());
+		}
+		if (Fields.Has(TEXT("label")))
+		{
+			ActorJson->SetStringField(TEXT("label"), Actor->GetActorLabel());
+		}
+		if (Fields.Has(TEXT("class")))
+		{
+			ActorJson->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
+		}
+		if (Fields.Has(TEXT("folder")))
+		{
+			ActorJson->SetStringField(TEXT("folder"), Actor->GetFolderPath().ToString());
+		}
+		if (Fields.Has(TEXT("location")))
+		{
+			ActorJson->SetObjectField(TEXT("location"), UnrealClaudeJsonUtils::VectorToJson(Actor->GetActorLocation()));
+		}
+		if (Fields.Has(TEXT("rotation")))
+		{
+			ActorJson->SetObjectField(TEXT("rotation"), UnrealClaudeJsonUtils::RotatorToJson(Actor->GetActorRotation()));
+		}
+		if (Fields.Has(TEXT("scale")))
+		{
+			ActorJson->SetObjectField(TEXT("scale"), UnrealClaudeJsonUtils::VectorToJson(Actor->GetActorScale3D()));
+		}
+		if (Fields.Has(TEXT("hidden")))
+		{
+			ActorJson->SetBoolField(TEXT("hidden"), Actor->IsHidden());
+		}
+		if (Fields.Has(TEXT("tags")) && Actor->Tags.Num() > 0)
+		{
+			TArray<FString> TagStrings;
+			for (const FName& Tag : Actor->Tags)
+			{
+				TagStrings.Add(Tag.ToString());
+			}
+			ActorJson->SetArrayField(TEXT("tags"), StringArrayToJsonArray(TagStrings));
+		}
+
+		return ActorJson;
+	}
+
 	/**
 	 * Build JSON array from string array
 	 * @param Strings - Array of strings to convert
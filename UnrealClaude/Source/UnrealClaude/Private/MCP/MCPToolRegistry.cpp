@@ -7,11 +7,21 @@
 
 // Include all tool implementations
 #include "Tools/MCPTool_SpawnActor.h"
+#include "Tools/MCPTool_SpawnActorsBulk.h"
+#include "Tools/MCPTool_BatchEditActors.h"
+#include "Tools/MCPTool_UnloadActors.h"
 #include "Tools/MCPTool_GetLevelActors.h"
 #include "Tools/MCPTool_SetProperty.h"
+#include "Tools/MCPTool_GetProperties.h"
+#include "Tools/MCPTool_ExportTable.h"
 #include "Tools/MCPTool_RunConsoleCommand.h"
 #include "Tools/MCPTool_DeleteActors.h"
 #include "Tools/MCPTool_MoveActor.h"
+#include "Tools/MCPTool_QueryActorsSpatial.h"
+#include "Tools/MCPTool_GetLevelChanges.h"
+#include "Tools/MCPTool_LevelSnapshot.h"
+#include "Tools/MCPTool_LevelDiff.h"
+#include "Tools/MCPTool_LevelRestore.h"
 #include "Tools/MCPTool_GetOutputLog.h"
 #include "Tools/MCPTool_ExecuteScript.h"
 #include "Tools/MCPTool_CleanupScripts.h"
@@ -20,9 +30,13 @@
 #include "Tools/MCPTool_BlueprintQuery.h"
 #include "Tools/MCPTool_BlueprintModify.h"
 #include "Tools/MCPTool_AnimBlueprintModify.h"
+#include "Tools/MCPTool_CompileBlueprints.h"
 #include "Tools/MCPTool_AssetSearch.h"
 #include "Tools/MCPTool_AssetDependencies.h"
 #include "Tools/MCPTool_AssetReferencers.h"
+#include "Tools/MCPTool_AssetGraph.h"
+#include "Tools/MCPTool_AnalyzeHardReferences.h"
+#include "Tools/MCPTool_SaveAssets.h"
 #include "Tools/MCPTool_EnhancedInput.h"
 #include "Tools/MCPTool_Character.h"
 #include "Tools/MCPTool_CharacterData.h"
@@ -70,11 +84,21 @@ void FMCPToolRegistry::RegisterBuiltinTools()
 
 	// Register all built-in tools
 	RegisterTool(MakeShared<FMCPTool_SpawnActor>());
+	RegisterTool(MakeShared<FMCPTool_SpawnActorsBulk>());
+	RegisterTool(MakeShared<FMCPTool_BatchEditActors>());
 	RegisterTool(MakeShared<FMCPTool_GetLevelActors>());
+	RegisterTool(MakeShared<FMCPTool_UnloadActors>());
 	RegisterTool(MakeShared<FMCPTool_SetProperty>());
+	RegisterTool(MakeShared<FMCPTool_GetProperties>());
+	RegisterTool(MakeShared<FMCPTool_ExportTable>());
 	RegisterTool(MakeShared<FMCPTool_RunConsoleCommand>());
 	RegisterTool(MakeShared<FMCPTool_DeleteActors>());
 	RegisterTool(MakeShared<FMCPTool_MoveActor>());
+	RegisterTool(MakeShared<FMCPTool_QueryActorsSpatial>());
+	RegisterTool(MakeShared<FMCPTool_GetLevelChanges>());
+	RegisterTool(MakeShared<FMCPTool_LevelSnapshot>());
+	RegisterTool(MakeShared<FMCPTool_LevelDiff>());
+	RegisterTool(MakeShared<FMCPTool_LevelRestore>());
 	RegisterTool(MakeShared<FMCPTool_GetOutputLog>());
 
 	// Script execution tools
@@ -89,11 +113,15 @@ void FMCPToolRegistry::RegisterBuiltinTools()
 	RegisterTool(MakeShared<FMCPTool_BlueprintQuery>());
 	RegisterTool(MakeShared<FMCPTool_BlueprintModify>());
 	RegisterTool(MakeShared<FMCPTool_AnimBlueprintModify>());
+	RegisterTool(MakeShared<FMCPTool_CompileBlueprints>());
 
 	// Asset tools
 	RegisterTool(MakeShared<FMCPTool_AssetSearch>());
 	RegisterTool(MakeShared<FMCPTool_AssetDependencies>());
 	RegisterTool(MakeShared<FMCPTool_AssetReferencers>());
+	RegisterTool(MakeShared<FMCPTool_AssetGraph>());
+	RegisterTool(MakeShared<FMCPTool_AnalyzeHardReferences>());
+	RegisterTool(MakeShared<FMCPTool_SaveAssets>());
 
 	// Enhanced Input tools
 	RegisterTool(MakeShared<FMCPTool_EnhancedInput>());
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
+#include "UObject/SoftObjectPath.h"
 
 // Forward declarations
 class FMCPTaskQueue;
@@ -169,6 +170,18 @@ public:
 
 	/** Execute the tool with given parameters */
 	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) = 0;
+
+	/**
+	 * Assets this call is going to load (called on the game thread before Execute)
+	 * The task queue streams them in asynchronously so Execute does not block on disk I/O;
+	 * anything not declared is still loaded synchronously by Execute. The preload shares the
+	 * task's timeout: if it runs out before the assets are loaded, the task fails without
+	 * Execute being called
+	 */
+	virtual void GetRequiredAssets(const TSharedRef<FJsonObject>& Params, TArray<FSoftObjectPath>& OutAssets) const {}
+
+	/** Whether GetRequiredAssets is overridden; tools without it skip the preload's game-thread round trip */
+	virtual bool HasRequiredAssets() const { return false; }
 };
 
 /**
@@ -0,0 +1,337 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPWorldPartitionActors.h"
+#include "MCPFieldSet.h"
+#include "UnrealClaudeModule.h"
+#include "UnrealClaudeUtils.h"
+#include "Engine/World.h"
+#include "UObject/ObjectKey.h"
+#include "GameFramework/Actor.h"
+#include "WorldPartition/WorldPartition.h"
+#include "WorldPartition/WorldPartitionHelpers.h"
+#include "WorldPartition/WorldPartitionActorDescInstance.h"
+
+const TCHAR* FMCPWorldPartitionActors::IdPrefix = TEXT("wp:");
+
+namespace
+{
+	UWorldPartition* GetWorldPartition(const UWorld* World)
+	{
+		return World ? World->GetWorldPartition() : nullptr;
+	}
+
+	/** Actors pinned by LoadActor, per world; pins the user made are never recorded */
+	struct FPinnedActors
+	{
+		TMap<TObjectKey<UWorld>, TSet<FGuid>> ByWorld;
+		FDelegateHandle WorldCleanupHandle;
+	};
+
+	FPinnedActors& GetPinnedActorState()
+	{
+		static FPinnedActors State;
+		return State;
+	}
+
+	void UnpinAll(UWorld* World)
+	{
+		TSet<FGuid> Guids;
+		if (!GetPinnedActorState().ByWorld.RemoveAndCopyValue(World, Guids))
+		{
+			return;
+		}
+
+		UWorldPartition* WorldPartition = GetWorldPartition(World);
+		if (WorldPartition && WorldPartition->IsInitialized())
+		{
+			WorldPartition->UnpinActors(Guids.Array());
+			UE_LOG(LogUnrealClaude, Log, TEXT("Unpinned %d World Partition actors loaded for editing"), Guids.Num());
+		}
+	}
+
+	void FillInfo(const FWorldPartitionActorDescInstance* Desc, FMCPUnloadedActorInfo& OutInfo)
+	{
+		OutInfo.Guid = Desc->GetGuid();
+		OutInfo.Name = Desc->GetActorName().ToString();
+		OutInfo.Label = Desc->GetActorLabel().ToString();
+		if (OutInfo.Label.IsEmpty())
+		{
+			OutInfo.Label = OutInfo.Name;
+		}
+
+		// Base class is the Blueprint class for Blueprint actors; fall back to the native class
+		const FTopLevelAssetPath BaseClass = Desc->GetBaseClass();
+		if (BaseClass.IsValid())
+		{
+			OutInfo.ClassName = BaseClass.GetAssetName().ToString();
+			OutInfo.ClassName.RemoveFromEnd(TEXT("_C"));
+		}
+		else if (const UClass* NativeClass = Desc->GetActorNativeClass())
+		{
+			OutInfo.ClassName = NativeClass->GetName();
+		}
+
+		OutInfo.ActorPath = Desc->GetActorSoftPath().ToString();
+		OutInfo.Bounds = Desc->GetEditorBounds();
+
+		OutInfo.DataLayers.Reset();
+		for (const FName& DataLayer : Desc->GetDataLayerInstanceNames().ToArray())
+		{
+			OutInfo.DataLayers.Add(DataLayer.ToString());
+		}
+	}
+}
+
+bool FMCPWorldPartitionActors::IsPartitioned(const UWorld* World)
+{
+	return GetWorldPartition(World) != nullptr;
+}
+
+void FMCPWorldPartitionActors::GatherUnloaded(UWorld* World, TArray<FMCPUnloadedActorInfo>& OutActors)
+{
+	UWorldPartition* WorldPartition = GetWorldPartition(World);
+	if (!WorldPartition)
+	{
+		return;
+	}
+
+	FWorldPartitionHelpers::ForEachActorDescInstance(WorldPartition, [&OutActors](const FWorldPartitionActorDescInstance* Desc)
+	{
+		if (!Desc->IsLoaded())
+		{
+			FillInfo(Desc, OutActors.AddDefaulted_GetRef());
+		}
+		return true;
+	});
+}
+
+int32 FMCPWorldPartitionActors::CountUnloaded(UWorld* World)
+{
+	UWorldPartition* WorldPartition = GetWorldPartition(World);
+	if (!WorldPartition)
+	{
+		return 0;
+	}
+
+	int32 Count = 0;
+	FWorldPartitionHelpers::ForEachActorDescInstance(WorldPartition, [&Count](const FWorldPartitionActorDescInstance* Desc)
+	{
+		Count += Desc->IsLoaded() ? 0 : 1;
+		return true;
+	});
+	return Count;
+}
+
+bool FMCPWorldPartitionActors::FindUnloaded(UWorld* World, const FString& NameOrLabel, FMCPUnloadedActorInfo& OutInfo)
+{
+	UWorldPartition* WorldPartition = GetWorldPartition(World);
+	if (!WorldPartition || NameOrLabel.IsEmpty())
+	{
+		return false;
+	}
+
+	// Names are unique, so a name match wins over an earlier label match
+	const FWorldPartitionActorDescInstance* LabelMatch = nullptr;
+	const FWorldPartitionActorDescInstance* NameMatch = nullptr;
+	FWorldPartitionHelpers::ForEachActorDescInstance(WorldPartition, [&](const FWorldPartitionActorDescInstance* Desc)
+	{
+		if (Desc->IsLoaded())
+		{
+			return true;
+		}
+		if (Desc->GetActorName().ToString() == NameOrLabel)
+		{
+			NameMatch = Desc;
+			return false;
+		}
+		if (!LabelMatch && Desc->GetActorLabel().ToString() == NameOrLabel)
+		{
+			LabelMatch = Desc;
+		}
+		return true;
+	});
+
+	const FWorldPartitionActorDescInstance* Match = NameMatch ? NameMatch : LabelMatch;
+	if (!Match)
+	{
+		return false;
+	}
+	FillInfo(Match, OutInfo);
+	return true;
+}
+
+bool FMCPWorldPartitionActors::FindByGuid(UWorld* World, const FGuid& Guid, FMCPUnloadedActorInfo& OutInfo, AActor*& OutLoadedActor)
+{
+	OutLoadedActor = nullptr;
+
+	UWorldPartition* WorldPartition = GetWorldPartition(World);
+	const FWorldPartitionActorDescInstance* Desc = WorldPartition ? WorldPartition->GetActorDescInstance(Guid) : nullptr;
+	if (!Desc)
+	{
+		return false;
+	}
+
+	FillInfo(Desc, OutInfo);
+	if (Desc->IsLoaded())
+	{
+		OutLoadedActor = Desc->GetActor();
+	}
+	return true;
+}
+
+void FMCPWorldPartitionActors::Initialize()
+{
+	FPinnedActors& State = GetPinnedActorState();
+	if (State.WorldCleanupHandle.IsValid())
+	{
+		return;
+	}
+
+	State.WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddLambda([](UWorld* World, bool bSessionEnded, bool bCleanupResources)
+	{
+		UnpinAll(World);
+	});
+}
+
+void FMCPWorldPartitionActors::Shutdown()
+{
+	FPinnedActors& State = GetPinnedActorState();
+	FWorldDelegates::OnWorldCleanup.Remove(State.WorldCleanupHandle);
+	State.WorldCleanupHandle.Reset();
+
+	TArray<TObjectKey<UWorld>> Worlds;
+	State.ByWorld.GetKeys(Worlds);
+	for (const TObjectKey<UWorld>& World : Worlds)
+	{
+		if (UWorld* LiveWorld = World.ResolveObjectPtr())
+		{
+			UnpinAll(LiveWorld);
+		}
+	}
+	State.ByWorld.Empty();
+}
+
+AActor* FMCPWorldPartitionActors::LoadActor(UWorld* World, const FGuid& Guid)
+{
+	UWorldPartition* WorldPartition = GetWorldPartition(World);
+	if (!WorldPartition)
+	{
+		return nullptr;
+	}
+
+	// Only pins made here are released later; an actor the user already pinned stays theirs
+	if (!WorldPartition->IsActorPinned(Guid))
+	{
+		WorldPartition->PinActors({ Guid });
+		GetPinnedActorState().ByWorld.FindOrAdd(World).Add(Guid);
+	}
+
+	const FWorldPartitionActorDescInstance* Desc = WorldPartition->GetActorDescInstance(Guid);
+	AActor* Actor = Desc ? Desc->GetActor() : nullptr;
+	if (Actor)
+	{
+		UE_LOG(LogUnrealClaude, Log, TEXT("Pinned World Partition actor %s for editing"), *Actor->GetActorLabel());
+	}
+	return Actor;
+}
+
+void FMCPWorldPartitionActors::GetPinnedActors(UWorld* World, TArray<FGuid>& OutGuids)
+{
+	OutGuids.Reset();
+	UWorldPartition* WorldPartition = GetWorldPartition(World);
+	const TSet<FGuid>* Pinned = GetPinnedActorState().ByWorld.Find(World);
+	if (!WorldPartition || !Pinned)
+	{
+		return;
+	}
+
+	// The user may have unpinned some from the outliner since
+	for (const FGuid& Guid : *Pinned)
+	{
+		if (WorldPartition->IsActorPinned(Guid))
+		{
+			OutGuids.Add(Guid);
+		}
+	}
+}
+
+int32 FMCPWorldPartitionActors::UnpinActors(UWorld* World, const TArray<FGuid>& Guids)
+{
+	UWorldPartition* WorldPartition = GetWorldPartition(World);
+	TSet<FGuid>* Pinned = GetPinnedActorState().ByWorld.Find(World);
+	if (!WorldPartition || !Pinned)
+	{
+		return 0;
+	}
+
+	TArray<FGuid> ToUnpin;
+	for (const FGuid& Guid : Guids)
+	{
+		if (Pinned->Remove(Guid) > 0)
+		{
+			ToUnpin.Add(Guid);
+		}
+	}
+	if (Pinned->Num() == 0)
+	{
+		GetPinnedActorState().ByWorld.Remove(World);
+	}
+
+	if (ToUnpin.Num() > 0)
+	{
+		WorldPartition->UnpinActors(ToUnpin);
+	}
+	return ToUnpin.Num();
+}
+
+TSharedPtr<FJsonObject> FMCPWorldPartitionActors::ToJson(const FMCPUnloadedActorInfo& Info, const FMCPFieldSet& Fields)
+{
+	TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+	if (Fields.Has(TEXT("name")))
+	{
+		Json->SetStringField(TEXT("name"), Info.Name);
+	}
+	if (Fields.Has(TEXT("label")))
+	{
+		Json->SetStringField(TEXT("label"), Info.Label);
+	}
+	if (Fields.Has(TEXT("class")))
+	{
+		Json->SetStringField(TEXT("class"), Info.ClassName);
+	}
+	if (Fields.Has(TEXT("location")) && Info.Bounds.IsValid)
+	{
+		Json->SetObjectField(TEXT("location"), UnrealClaudeJsonUtils::VectorToJson(Info.Bounds.GetCenter()));
+	}
+
+	// Descriptor-only details are always included so callers can tell these entries apart
+	Json->SetBoolField(TEXT("loaded"), false);
+	if (Info.Bounds.IsValid)
+	{
+		TSharedPtr<FJsonObject> BoundsJson = MakeShared<FJsonObject>();
+		BoundsJson->SetObjectField(TEXT("min"), UnrealClaudeJsonUtils::VectorToJson(Info.Bounds.Min));
+		BoundsJson->SetObjectField(TEXT("max"), UnrealClaudeJsonUtils::VectorToJson(Info.Bounds.Max));
+		Json->SetObjectField(TEXT("bounds"), BoundsJson);
+	}
+	if (Info.DataLayers.Num() > 0)
+	{
+		TArray<TSharedPtr<FJsonValue>> LayersArray;
+		for (const FString& Layer : Info.DataLayers)
+		{
+			LayersArray.Add(MakeShared<FJsonValueString>(Layer));
+		}
+		Json->SetArrayField(TEXT("dataLayers"), LayersArray);
+	}
+	return Json;
+}
+
+FString FMCPWorldPartitionActors::MakeId(const FGuid& Guid)
+{
+	return FString(IdPrefix) + Guid.ToString(EGuidFormats::Digits);
+}
+
+bool FMCPWorldPartitionActors::ParseId(const FString& Id, FGuid& OutGuid)
+{
+	return Id.StartsWith(IdPrefix, ESearchCase::CaseSensitive) &&
+		FGuid::ParseExact(Id.RightChop(FCString::Strlen(IdPrefix)), EGuidFormats::Digits, OutGuid);
+}
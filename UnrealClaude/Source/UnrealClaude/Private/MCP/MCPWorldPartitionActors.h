@@ -0,0 +1,85 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+class AActor;
+class UWorld;
+class FMCPFieldSet;
+
+/**
+ * Actor known only from its World Partition descriptor (not loaded)
+ */
+struct FMCPUnloadedActorInfo
+{
+	FGuid Guid;
+	FString Name;
+	FString Label;
+	FString ClassName;
+	FString ActorPath;
+	FBox Bounds = FBox(ForceInit);
+	TArray<FString> DataLayers;
+};
+
+/**
+ * Access to unloaded World Partition actors through their descriptors
+ *
+ * Descriptors carry class, label, bounds and data layers without loading
+ * the actor, so listings can cover the whole world cheaply. Tools that
+ * modify an actor use LoadActor, which pins just that actor (visible and
+ * unpinnable in the outliner) instead of loading its cells. Pins made here
+ * are tracked and released by UnpinActors (the unload_actors tool), when
+ * their world is cleaned up, and at module shutdown.
+ *
+ * On non-partitioned worlds every query returns nothing. Game thread only.
+ */
+class FMCPWorldPartitionActors
+{
+public:
+	/** Prefix for descriptor-backed ids in cursor snapshots */
+	static const TCHAR* IdPrefix;
+
+	/** Whether World uses World Partition */
+	static bool IsPartitioned(const UWorld* World);
+
+	/** Descriptors of actors that are not currently loaded */
+	static void GatherUnloaded(UWorld* World, TArray<FMCPUnloadedActorInfo>& OutActors);
+
+	/** Number of actors that are not currently loaded */
+	static int32 CountUnloaded(UWorld* World);
+
+	/** Find an unloaded actor's descriptor by name or label */
+	static bool FindUnloaded(UWorld* World, const FString& NameOrLabel, FMCPUnloadedActorInfo& OutInfo);
+
+	/** Find a descriptor by guid; OutLoadedActor is set if the actor has since been loaded */
+	static bool FindByGuid(UWorld* World, const FGuid& Guid, FMCPUnloadedActorInfo& OutInfo, AActor*& OutLoadedActor);
+
+	/** Bind world cleanup (call once at module startup) */
+	static void Initialize();
+
+	/** Unpin every actor LoadActor pinned and unbind (call at module shutdown) */
+	static void Shutdown();
+
+	/** Pin (load) a single actor by guid */
+	static AActor* LoadActor(UWorld* World, const FGuid& Guid);
+
+	/** Actors in World that LoadActor pinned and that are still pinned by it */
+	static void GetPinnedActors(UWorld* World, TArray<FGuid>& OutGuids);
+
+	/**
+	 * Unpin actors LoadActor pinned; guids it did not pin are ignored
+	 * @return Number of actors unpinned
+	 */
+	static int32 UnpinActors(UWorld* World, const TArray<FGuid>& Guids);
+
+	/** Serialize a descriptor using the shared actor field names, plus loaded/bounds/dataLayers */
+	static TSharedPtr<FJsonObject> ToJson(const FMCPUnloadedActorInfo& Info, const FMCPFieldSet& Fields);
+
+	/** Cursor id for a descriptor */
+	static FString MakeId(const FGuid& Guid);
+
+	/** Parse a cursor id made by MakeId */
+	static bool ParseId(const FString& Id, FGuid& OutGuid);
+};
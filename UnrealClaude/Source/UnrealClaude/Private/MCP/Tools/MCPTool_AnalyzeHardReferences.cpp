@@ -0,0 +1,344 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTool_AnalyzeHardReferences.h"
+#include "UnrealClaudeConstants.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Algo/Reverse.h"
+
+using namespace UnrealClaudeConstants::HardReferenceAnalysis;
+
+namespace
+{
+	struct FHardRefNode
+	{
+		FName PackageName;
+		int32 Depth = 0;
+		int64 DiskSize = 0;
+		FName ClassName;
+
+		TArray<int32> Dependencies;
+		TArray<int32> Referencers;
+
+		/** Immediate dominator (the root dominates itself) */
+		int32 Dominator = INDEX_NONE;
+		int32 PostOrder = INDEX_NONE;
+
+		/** Size and count of this node plus everything it dominates */
+		int64 RetainedSize = 0;
+		int32 RetainedNodes = 0;
+	};
+
+	bool IsSkippedPackage(FName PackageName, bool bIncludeEngine)
+	{
+		const FString Name = PackageName.ToString();
+		return Name.StartsWith(TEXT("/Script/")) || (!bIncludeEngine && Name.StartsWith(TEXT("/Engine/")));
+	}
+
+	/** Packages whose hard references are authored by hand and could be made soft */
+	bool IsAuthoredReferencer(FName ClassName)
+	{
+		return ClassName == TEXT("World") || ClassName.ToString().EndsWith(TEXT("Blueprint"));
+	}
+
+	/** Root-first reverse postorder over dependency edges */
+	TArray<int32> ComputeReversePostOrder(TArray<FHardRefNode>& Nodes)
+	{
+		TArray<int32> PostOrder;
+		PostOrder.Reserve(Nodes.Num());
+
+		TArray<bool> Visited;
+		Visited.Init(false, Nodes.Num());
+
+		// (node, next dependency to visit)
+		TArray<TPair<int32, int32>> Stack;
+		Stack.Emplace(0, 0);
+		Visited[0] = true;
+		while (Stack.Num() > 0)
+		{
+			TPair<int32, int32>& Top = Stack.Last();
+			const TArray<int32>& Dependencies = Nodes[Top.Key].Dependencies;
+			if (Top.Value < Dependencies.Num())
+			{
+				const int32 Next = Dependencies[Top.Value++];
+				if (!Visited[Next])
+				{
+					Visited[Next] = true;
+					Stack.Emplace(Next, 0);
+				}
+				continue;
+			}
+
+			Nodes[Top.Key].PostOrder = PostOrder.Num();
+			PostOrder.Add(Top.Key);
+			Stack.Pop(EAllowShrinking::No);
+		}
+
+		Algo::Reverse(PostOrder);
+		return PostOrder;
+	}
+
+	/** Iterative dominator computation (Cooper, Harvey and Kennedy) */
+	void ComputeDominators(TArray<FHardRefNode>& Nodes, const TArray<int32>& ReversePostOrder)
+	{
+		auto Intersect = [&Nodes](int32 A, int32 B)
+		{
+			while (A != B)
+			{
+				while (Nodes[A].PostOrder < Nodes[B].PostOrder)
+				{
+					A = Nodes[A].Dominator;
+				}
+				while (Nodes[B].PostOrder < Nodes[A].PostOrder)
+				{
+					B = Nodes[B].Dominator;
+				}
+			}
+			return A;
+		};
+
+		Nodes[0].Dominator = 0;
+		bool bChanged = true;
+		while (bChanged)
+		{
+			bChanged = false;
+			for (const int32 NodeIndex : ReversePostOrder)
+			{
+				if (NodeIndex == 0)
+				{
+					continue;
+				}
+
+				int32 NewDominator = INDEX_NONE;
+				for (const int32 Referencer : Nodes[NodeIndex].Referencers)
+				{
+					if (Nodes[Referencer].Dominator == INDEX_NONE)
+					{
+						continue;
+					}
+					NewDominator = NewDominator == INDEX_NONE ? Referencer : Intersect(Referencer, NewDominator);
+				}
+
+				if (NewDominator != Nodes[NodeIndex].Dominator)
+				{
+					Nodes[NodeIndex].Dominator = NewDominator;
+					bChanged = true;
+				}
+			}
+		}
+	}
+}
+
+FMCPToolResult FMCPTool_AnalyzeHardReferences::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	FString AssetPath;
+	TOptional<FMCPToolResult> Error;
+	if (!ExtractRequiredString(Params, TEXT("asset_path"), AssetPath, Error))
+	{
+		return Error.GetValue();
+	}
+
+	const bool bIncludeEngine = ExtractOptionalBool(Params, TEXT("include_engine"), false);
+	const bool bIncludeEditorOnly = ExtractOptionalBool(Params, TEXT("include_editor_only"), false);
+	const int64 MinSize = FMath::Max<int64>(0, ExtractOptionalNumber<int64>(Params, TEXT("min_size"), DefaultMinSize));
+	const int32 Limit = FMath::Clamp(ExtractOptionalNumber<int32>(Params, TEXT("limit"), DefaultLimit), 1, MaxLimit);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	// Accept both package paths and full object paths (e.g., /Game/BP.BP_C -> /Game/BP)
+	const FName RootPackage(*(AssetPath.Contains(TEXT(".")) ? FPackageName::ObjectPathToPackageName(AssetPath) : AssetPath));
+	TArray<FAssetData> RootAssets;
+	AssetRegistry.GetAssetsByPackageName(RootPackage, RootAssets);
+	if (RootAssets.Num() == 0)
+	{
+		return FMCPToolResult::Error(FString::Printf(TEXT("Asset not found: %s"), *AssetPath));
+	}
+
+	// Hard-reference closure of the root, with edges in both directions
+	TArray<FHardRefNode> Nodes;
+	TMap<FName, int32> NodeIndexByPackage;
+	Nodes.AddDefaulted_GetRef().PackageName = RootPackage;
+	NodeIndexByPackage.Add(RootPackage, 0);
+
+	// Editor-only references (e.g. thumbnails, editor utility data) are not loaded in a cooked game
+	const UE::AssetRegistry::FDependencyQuery HardOnly(bIncludeEditorOnly
+		? UE::AssetRegistry::EDependencyQuery::Hard
+		: UE::AssetRegistry::EDependencyQuery::Hard | UE::AssetRegistry::EDependencyQuery::Game);
+	TArray<FName> Dependencies;
+	bool bTruncated = false;
+
+	for (int32 Current = 0; Current < Nodes.Num(); ++Current)
+	{
+		Dependencies.Reset();
+		AssetRegistry.GetDependencies(Nodes[Current].PackageName, Dependencies,
+			UE::AssetRegistry::EDependencyCategory::Package, HardOnly);
+
+		for (const FName& Dependency : Dependencies)
+		{
+			if (Dependency.IsNone() || IsSkippedPackage(Dependency, bIncludeEngine))
+			{
+				continue;
+			}
+
+			int32 DependencyIndex = INDEX_NONE;
+			if (const int32* Existing = NodeIndexByPackage.Find(Dependency))
+			{
+				DependencyIndex = *Existing;
+			}
+			else if (Nodes.Num() >= MaxNodes)
+			{
+				bTruncated = true;
+				continue;
+			}
+			else
+			{
+				DependencyIndex = Nodes.Num();
+				FHardRefNode& Node = Nodes.AddDefaulted_GetRef();
+				Node.PackageName = Dependency;
+				Node.Depth = Nodes[Current].Depth + 1;
+				NodeIndexByPackage.Add(Dependency, DependencyIndex);
+			}
+
+			if (DependencyIndex != Current && DependencyIndex != 0)
+			{
+				Nodes[Current].Dependencies.Add(DependencyIndex);
+				Nodes[DependencyIndex].Referencers.Add(Current);
+			}
+		}
+	}
+
+	// Sizes and classes for the whole closure in one registry query each
+	TArray<FName> PackageNames;
+	PackageNames.Reserve(Nodes.Num());
+	for (const FHardRefNode& Node : Nodes)
+	{
+		PackageNames.Add(Node.PackageName);
+	}
+
+	const TArray<TOptional<FAssetPackageData>> PackageDatas = AssetRegistry.GetAssetPackageDatasCopy(PackageNames);
+	for (int32 i = 0; i < PackageDatas.Num() && i < Nodes.Num(); ++i)
+	{
+		if (PackageDatas[i].IsSet())
+		{
+			Nodes[i].DiskSize = FMath::Max<int64>(PackageDatas[i]->DiskSize, 0);
+		}
+	}
+
+	FARFilter Filter;
+	Filter.PackageNames = PackageNames;
+	TArray<FAssetData> ClosureAssets;
+	AssetRegistry.GetAssets(Filter, ClosureAssets);
+	for (const FAssetData& AssetData : ClosureAssets)
+	{
+		if (const int32* NodeIndex = NodeIndexByPackage.Find(AssetData.PackageName))
+		{
+			// Prefer the package's main asset (named after the package) over other assets in it
+			FHardRefNode& Node = Nodes[*NodeIndex];
+			if (Node.ClassName.IsNone() || AssetData.AssetName == FPackageName::GetShortFName(AssetData.PackageName))
+			{
+				Node.ClassName = AssetData.AssetClassPath.GetAssetName();
+			}
+		}
+	}
+
+	// Retained sizes: accumulate each node into its dominator, deepest first
+	const TArray<int32> ReversePostOrder = ComputeReversePostOrder(Nodes);
+	ComputeDominators(Nodes, ReversePostOrder);
+	for (FHardRefNode& Node : Nodes)
+	{
+		Node.RetainedSize = Node.DiskSize;
+		Node.RetainedNodes = 1;
+	}
+	for (int32 i = ReversePostOrder.Num() - 1; i > 0; --i)
+	{
+		const FHardRefNode& Node = Nodes[ReversePostOrder[i]];
+		FHardRefNode& Dominator = Nodes[Node.Dominator];
+		Dominator.RetainedSize += Node.RetainedSize;
+		Dominator.RetainedNodes += Node.RetainedNodes;
+	}
+
+	TArray<int32> Order;
+	Order.Reserve(Nodes.Num() - 1);
+	for (int32 i = 1; i < Nodes.Num(); ++i)
+	{
+		Order.Add(i);
+	}
+	Order.Sort([&Nodes](int32 A, int32 B)
+	{
+		if (Nodes[A].RetainedSize != Nodes[B].RetainedSize)
+		{
+			return Nodes[A].RetainedSize > Nodes[B].RetainedSize;
+		}
+		return Nodes[A].Depth < Nodes[B].Depth;
+	});
+
+	int32 CandidateCount = 0;
+	TArray<TSharedPtr<FJsonValue>> CandidatesArray;
+	for (int32 i = 0; i < Order.Num() && CandidatesArray.Num() < Limit; ++i)
+	{
+		const FHardRefNode& Node = Nodes[Order[i]];
+
+		bool bAuthoredReferencer = false;
+		TArray<TSharedPtr<FJsonValue>> ReferencersArray;
+		for (const int32 Referencer : Node.Referencers)
+		{
+			bAuthoredReferencer |= IsAuthoredReferencer(Nodes[Referencer].ClassName);
+			if (ReferencersArray.Num() < MaxListedReferencers)
+			{
+				TSharedPtr<FJsonObject> ReferencerJson = MakeShared<FJsonObject>();
+				ReferencerJson->SetStringField(TEXT("path"), Nodes[Referencer].PackageName.ToString());
+				ReferencerJson->SetStringField(TEXT("class"), Nodes[Referencer].ClassName.ToString());
+				ReferencersArray.Add(MakeShared<FJsonValueObject>(ReferencerJson));
+			}
+		}
+
+		const bool bSoftCandidate = bAuthoredReferencer && Node.RetainedSize >= MinSize;
+		CandidateCount += bSoftCandidate ? 1 : 0;
+
+		TSharedPtr<FJsonObject> CandidateJson = MakeShared<FJsonObject>();
+		CandidateJson->SetStringField(TEXT("path"), Node.PackageName.ToString());
+		CandidateJson->SetStringField(TEXT("class"), Node.ClassName.ToString());
+		CandidateJson->SetNumberField(TEXT("size"), static_cast<double>(Node.DiskSize));
+		CandidateJson->SetNumberField(TEXT("retainedSize"), static_cast<double>(Node.RetainedSize));
+		CandidateJson->SetNumberField(TEXT("retainedNodes"), Node.RetainedNodes);
+		CandidateJson->SetNumberField(TEXT("depth"), Node.Depth);
+		CandidateJson->SetNumberField(TEXT("referencerCount"), Node.Referencers.Num());
+		CandidateJson->SetArrayField(TEXT("referencers"), ReferencersArray);
+		CandidateJson->SetBoolField(TEXT("softCandidate"), bSoftCandidate);
+		if (bSoftCandidate)
+		{
+			const FString Savings = FString::Printf(TEXT("%d package%s (%s)"),
+				Node.RetainedNodes, Node.RetainedNodes == 1 ? TEXT("") : TEXT("s"),
+				*FText::AsMemory(Node.RetainedSize).ToString());
+			CandidateJson->SetStringField(TEXT("reason"), Node.Referencers.Num() == 1
+				? FString::Printf(TEXT("Only hard reference is from %s; making it soft keeps %s out of memory"),
+					*Nodes[Node.Referencers[0]].PackageName.ToString(), *Savings)
+				: FString::Printf(TEXT("Hard-referenced from %d packages; all must become soft to keep %s out of memory"),
+					Node.Referencers.Num(), *Savings));
+		}
+		CandidatesArray.Add(MakeShared<FJsonValueObject>(CandidateJson));
+	}
+
+	TSharedPtr<FJsonObject> Totals = MakeShared<FJsonObject>();
+	Totals->SetNumberField(TEXT("nodes"), Nodes.Num());
+	Totals->SetNumberField(TEXT("hardSize"), static_cast<double>(Nodes[0].RetainedSize));
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetStringField(TEXT("root"), RootPackage.ToString());
+	ResultData->SetStringField(TEXT("rootClass"), Nodes[0].ClassName.ToString());
+	ResultData->SetObjectField(TEXT("totals"), Totals);
+	ResultData->SetArrayField(TEXT("candidates"), CandidatesArray);
+	ResultData->SetNumberField(TEXT("count"), CandidatesArray.Num());
+	ResultData->SetNumberField(TEXT("softCandidates"), CandidateCount);
+	ResultData->SetBoolField(TEXT("includesEditorOnly"), bIncludeEditorOnly);
+	ResultData->SetBoolField(TEXT("truncated"), bTruncated);
+
+	const FString Message = FString::Printf(TEXT("'%s' hard-loads %d package%s (%s); %d listed reference%s flagged for soft conversion%s"),
+		*RootPackage.ToString(),
+		Nodes.Num() - 1, Nodes.Num() == 2 ? TEXT("") : TEXT("s"),
+		*FText::AsMemory(Nodes[0].RetainedSize).ToString(),
+		CandidateCount, CandidateCount == 1 ? TEXT("") : TEXT("s"),
+		bTruncated ? TEXT(" [truncated]") : TEXT(""));
+
+	return FMCPToolResult::Success(Message, ResultData);
+}
@@ -0,0 +1,59 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCP/MCPToolBase.h"
+
+/**
+ * MCP Tool: Rank hard references by how much content they keep in memory
+ *
+ * Builds the hard-reference package graph of a map or Blueprint from the
+ * asset registry (nothing is loaded) and computes its dominator tree. Only
+ * references a cooked game loads are followed unless editor-only ones are
+ * requested. A package's retained size is the size of everything it
+ * dominates: the packages that stop being loaded with the root once every
+ * hard reference to it becomes soft. Packages are ranked by retained size
+ * and flagged as soft-reference candidates when they are heavy and
+ * hard-referenced from Blueprints or maps.
+ */
+class FMCPTool_AnalyzeHardReferences : public FMCPToolBase
+{
+public:
+	virtual FMCPToolInfo GetInfo() const override
+	{
+		FMCPToolInfo Info;
+		Info.Name = TEXT("analyze_hard_references");
+		Info.Description = TEXT(
+			"Find which hard references of a map or Blueprint drag the most content into memory.\n\n"
+			"Walks only hard package references from the root (casts, class references and object "
+			"properties in Blueprints all become hard references) using asset registry data, without "
+			"loading anything. Editor-only references are skipped unless include_editor_only=true, "
+			"since a cooked game does not load them. For each package it reports the retained size: "
+			"what would no longer be loaded with the root if every hard reference to that package "
+			"became a soft reference.\n\n"
+			"Packages whose retained size is at least min_size and that are hard-referenced from a "
+			"Blueprint or map are flagged with softCandidate=true and a reason. When a package has "
+			"several hard referencers, all of them must be converted to get the savings.\n\n"
+			"The registry does not record which property or node created a reference; open the listed "
+			"referencer with blueprint_query to find it.\n\n"
+			"Returns: root, totals (nodes, hardSize), candidates sorted by retainedSize."
+		);
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("asset_path"), TEXT("string"),
+				TEXT("Map or Blueprint to analyze (e.g., '/Game/Maps/MainMap' or '/Game/Blueprints/BP_Player')"), true),
+			FMCPToolParameter(TEXT("include_engine"), TEXT("boolean"),
+				TEXT("Include /Engine/ content (default: false)"), false, TEXT("false")),
+			FMCPToolParameter(TEXT("include_editor_only"), TEXT("boolean"),
+				TEXT("Also follow editor-only references, i.e. what the editor loads (default: false)"), false, TEXT("false")),
+			FMCPToolParameter(TEXT("min_size"), TEXT("number"),
+				TEXT("Retained size in bytes at which a reference is flagged (default: 1048576)"), false, TEXT("1048576")),
+			FMCPToolParameter(TEXT("limit"), TEXT("number"),
+				TEXT("Maximum packages listed (1-500, default: 25)"), false, TEXT("25"))
+		};
+		Info.Annotations = FMCPToolAnnotations::ReadOnly();
+		return Info;
+	}
+
+	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+};
@@ -134,6 +134,12 @@ FMCPToolResult FMCPTool_AnimBlueprintModify::Execute(const TSharedRef<FJsonObjec
 	return FMCPToolResult::Error(FString::Printf(TEXT("Unknown operation: %s"), *Operation));
 }
 
+void FMCPTool_AnimBlueprintModify::GetRequiredAssets(const TSharedRef<FJsonObject>& Params, TArray<FSoftObjectPath>& OutAssets) const
+{
+	AddRequiredAssetParam(Params, TEXT("blueprint_path"), OutAssets);
+	AddRequiredAssetParam(Params, TEXT("animation_path"), OutAssets);
+}
+
 FVector2D FMCPTool_AnimBlueprintModify::ExtractPosition(const TSharedRef<FJsonObject>& Params)
 {
 	FVector2D Position(0, 0);
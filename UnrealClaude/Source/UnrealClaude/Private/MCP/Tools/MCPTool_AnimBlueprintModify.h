@@ -132,6 +132,8 @@ public:
 	}
 
 	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+	virtual void GetRequiredAssets(const TSharedRef<FJsonObject>& Params, TArray<FSoftObjectPath>& OutAssets) const override;
+	virtual bool HasRequiredAssets() const override { return true; }
 
 private:
 	// Operation handlers
@@ -2,13 +2,14 @@
 
 #include "MCPTool_Asset.h"
 #include "MCP/MCPParamValidator.h"
+#include "MCP/MCPPropertyPath.h"
+#include "MCP/MCPPackageSaver.h"
 #include "UnrealClaudeModule.h"
 #include "Editor.h"
 
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetRegistry/IAssetRegistry.h"
 #include "EditorAssetLibrary.h"
-#include "UObject/SavePackage.h"
 #include "Misc/PackageName.h"
 #include "UObject/PropertyAccessUtil.h"
 #include "Engine/SkeletalMesh.h"
@@ -92,6 +93,11 @@ FMCPToolResult FMCPTool_Asset::Execute(const TSharedRef<FJsonObject>& Params)
 		*Operation));
 }
 
+void FMCPTool_Asset::GetRequiredAssets(const TSharedRef<FJsonObject>& Params, TArray<FSoftObjectPath>& OutAssets) const
+{
+	AddRequiredAssetParam(Params, TEXT("asset_path"), OutAssets);
+}
+
 FMCPToolResult FMCPTool_Asset::ExecuteSetAssetProperty(const TSharedRef<FJsonObject>& Params)
 {
 	FString AssetPath;
@@ -200,20 +206,11 @@ FMCPToolResult FMCPTool_Asset::ExecuteSaveAsset(const TSharedRef<FJsonObject>& P
 	// Save if requested
 	if (bSave)
 	{
-		UPackage* Package = Asset->GetOutermost();
-		FString PackageFileName = FPackageName::LongPackageNameToFilename(
-			Package->GetName(),
-			FPackageName::GetAssetPackageExtension()
-		);
-
-		FSavePackageArgs SaveArgs;
-		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-		FSavePackageResultStruct SaveResult = UPackage::Save(Package, Asset, *PackageFileName, SaveArgs);
-
-		bWasSaved = SaveResult.IsSuccessful();
+		FString SaveError;
+		bWasSaved = FMCPPackageSaver::SaveAsset(Asset, SaveError);
 		if (!bWasSaved)
 		{
-			return FMCPToolResult::Error(FString::Printf(TEXT("Failed to save asset: %s"), *AssetPath));
+			return FMCPToolResult::Error(FString::Printf(TEXT("Failed to save asset: %s (%s)"), *AssetPath, *SaveError));
 		}
 	}
 
@@ -373,121 +370,6 @@ UObject* FMCPTool_Asset::LoadAssetByPath(const FString& AssetPath, FString& OutE
 	return Asset;
 }
 
-bool FMCPTool_Asset::NavigateToProperty(
-	UObject* StartObject,
-	const TArray<FString>& PathParts,
-	UObject*& OutObject,
-	FProperty*& OutProperty,
-	FString& OutError)
-{
-	OutObject = StartObject;
-	OutProperty = nullptr;
-
-	for (int32 i = 0; i < PathParts.Num(); ++i)
-	{
-		const FString& PartName = PathParts[i];
-		const bool bIsLastPart = (i == PathParts.Num() - 1);
-
-		// Check for array index notation (e.g., "Materials.0")
-		int32 ArrayIndex = INDEX_NONE;
-		FString PropertyName = PartName;
-
-		// Check if this part is a numeric index
-		if (PartName.IsNumeric())
-		{
-			ArrayIndex = FCString::Atoi(*PartName);
-			// The previous property should be an array
-			if (!OutProperty)
-			{
-				OutError = FString::Printf(TEXT("Cannot index without preceding array property"));
-				return false;
-			}
-
-			FArrayProperty* ArrayProp = CastField<FArrayProperty>(OutProperty);
-			if (!ArrayProp)
-			{
-				OutError = FString::Printf(TEXT("Property is not an array, cannot use index"));
-				return false;
-			}
-
-			// Navigate into array element
-			FScriptArrayHelper ArrayHelper(ArrayProp, ArrayProp->ContainerPtrToValuePtr<void>(OutObject));
-			if (ArrayIndex < 0 || ArrayIndex >= ArrayHelper.Num())
-			{
-				OutError = FString::Printf(TEXT("Array index %d out of bounds (size: %d)"), ArrayIndex, ArrayHelper.Num());
-				return false;
-			}
-
-			// Get the inner property
-			FProperty* InnerProp = ArrayProp->Inner;
-			if (FObjectProperty* ObjProp = CastField<FObjectProperty>(InnerProp))
-			{
-				void* ElementPtr = ArrayHelper.GetRawPtr(ArrayIndex);
-				UObject* ElementObj = ObjProp->GetObjectPropertyValue(ElementPtr);
-				if (ElementObj && !bIsLastPart)
-				{
-					OutObject = ElementObj;
-					OutProperty = nullptr;
-					continue;
-				}
-			}
-
-			if (bIsLastPart)
-			{
-				// Return the inner property for setting
-				OutProperty = InnerProp;
-				return true;
-			}
-			continue;
-		}
-
-		// Find the property
-		OutProperty = OutObject->GetClass()->FindPropertyByName(FName(*PropertyName));
-
-		if (!OutProperty)
-		{
-			OutError = FString::Printf(TEXT("Property not found: %s on %s"), *PropertyName, *OutObject->GetClass()->GetName());
-			return false;
-		}
-
-		// If not the last part, navigate into nested object
-		if (!bIsLastPart)
-		{
-			if (FArrayProperty* ArrayProp = CastField<FArrayProperty>(OutProperty))
-			{
-				// Keep the array property for next iteration (index access)
-				continue;
-			}
-
-			if (FObjectProperty* ObjProp = CastField<FObjectProperty>(OutProperty))
-			{
-				UObject* NestedObj = ObjProp->GetObjectPropertyValue(ObjProp->ContainerPtrToValuePtr<void>(OutObject));
-				if (!NestedObj)
-				{
-					OutError = FString::Printf(TEXT("Nested object is null: %s"), *PropertyName);
-					return false;
-				}
-				OutObject = NestedObj;
-				OutProperty = nullptr;
-			}
-			else if (FStructProperty* StructProp = CastField<FStructProperty>(OutProperty))
-			{
-				// For structs, we need to handle differently - keep the struct property
-				// This is a limitation: we can only set entire structs, not nested struct members
-				OutError = FString::Printf(TEXT("Cannot navigate into struct property: %s. Set the entire struct instead."), *PropertyName);
-				return false;
-			}
-			else
-			{
-				OutError = FString::Printf(TEXT("Cannot navigate into property type: %s"), *PropertyName);
-				return false;
-			}
-		}
-	}
-
-	return OutProperty != nullptr;
-}
-
 bool FMCPTool_Asset::SetPropertyFromJson(UObject* Object, const FString& PropertyPath, const TSharedPtr<FJsonValue>& Value, FString& OutError)
 {
 	if (!Object || !Value.IsValid())
@@ -496,14 +378,9 @@ bool FMCPTool_Asset::SetPropertyFromJson(UObject* Object, const FString& Propert
 		return false;
 	}
 
-	// Parse property path
-	TArray<FString> PathParts;
-	PropertyPath.ParseIntoArray(PathParts, TEXT("."), true);
-
-	UObject* TargetObject = nullptr;
-	FProperty* Property = nullptr;
-
-	if (!NavigateToProperty(Object, PathParts, TargetObject, Property, OutError))
+	// Array elements resolve to the element's address, not an offset into the owning object
+	FMCPResolvedProperty Resolved;
+	if (!FMCPPropertyPathCache::Get().Resolve(Object, PropertyPath, Resolved, OutError))
 	{
 		if (OutError.IsEmpty())
 		{
@@ -512,8 +389,9 @@ bool FMCPTool_Asset::SetPropertyFromJson(UObject* Object, const FString& Propert
 		return false;
 	}
 
-	// Get property address
-	void* ValuePtr = Property->ContainerPtrToValuePtr<void>(TargetObject);
+	FProperty* Property = Resolved.Property;
+	void* ValuePtr = Resolved.ValuePtr;
+	Resolved.Object->Modify();
 
 	// Handle object property (for setting references like materials)
 	if (FObjectProperty* ObjProp = CastField<FObjectProperty>(Property))
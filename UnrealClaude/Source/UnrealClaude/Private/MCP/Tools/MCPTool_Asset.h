@@ -29,6 +29,8 @@ class FMCPTool_Asset : public FMCPToolBase
 public:
 	virtual FMCPToolInfo GetInfo() const override;
 	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+	virtual void GetRequiredAssets(const TSharedRef<FJsonObject>& Params, TArray<FSoftObjectPath>& OutAssets) const override;
+	virtual bool HasRequiredAssets() const override { return true; }
 
 private:
 	// Operation handlers
@@ -37,14 +39,7 @@ private:
 	FMCPToolResult ExecuteGetAssetInfo(const TSharedRef<FJsonObject>& Params);
 	FMCPToolResult ExecuteListAssets(const TSharedRef<FJsonObject>& Params);
 
-	// Property reflection helpers (adapted from SetProperty tool)
-	bool NavigateToProperty(
-		UObject* StartObject,
-		const TArray<FString>& PathParts,
-		UObject*& OutObject,
-		FProperty*& OutProperty,
-		FString& OutError);
-
+	// Property reflection helpers (path resolution is shared via FMCPPropertyPathCache)
 	bool SetPropertyFromJson(
 		UObject* Object,
 		const FString& PropertyPath,
@@ -82,6 +82,20 @@ FMCPToolResult FMCPTool_AssetDependencies::Execute(const TSharedRef<FJsonObject>
 	int32 Count = EndIndex - StartIndex;
 	bool bHasMore = EndIndex < Total;
 
+	// Fetch asset data for the whole slice in one registry query (an empty filter would match everything)
+	TArray<FAssetData> SliceAssets;
+	if (Count > 0)
+	{
+		FARFilter SliceFilter;
+		SliceFilter.PackageNames.Append(FilteredDeps.GetData() + StartIndex, Count);
+		AssetRegistry.GetAssets(SliceFilter, SliceAssets);
+	}
+	TMap<FName, const FAssetData*> AssetByPackage;
+	for (const FAssetData& SliceAsset : SliceAssets)
+	{
+		AssetByPackage.FindOrAdd(SliceAsset.PackageName, &SliceAsset);
+	}
+
 	// Build result array for the paginated slice
 	TArray<TSharedPtr<FJsonValue>> DependencyArray;
 	for (int32 i = StartIndex; i < EndIndex; ++i)
@@ -92,13 +106,11 @@ FMCPToolResult FMCPTool_AssetDependencies::Execute(const TSharedRef<FJsonObject>
 		TSharedPtr<FJsonObject> DepJson = MakeShared<FJsonObject>();
 		DepJson->SetStringField(TEXT("path"), PathStr);
 
-		// Try to get the asset class for this dependency
-		TArray<FAssetData> DepAssets;
-		AssetRegistry.GetAssetsByPackageName(DepPath, DepAssets);
-		if (DepAssets.Num() > 0)
+		// Asset class for this dependency, if the registry knows it
+		if (const FAssetData* const* DepAsset = AssetByPackage.Find(DepPath))
 		{
-			DepJson->SetStringField(TEXT("class"), DepAssets[0].AssetClassPath.GetAssetName().ToString());
-			DepJson->SetStringField(TEXT("name"), DepAssets[0].AssetName.ToString());
+			DepJson->SetStringField(TEXT("class"), (*DepAsset)->AssetClassPath.GetAssetName().ToString());
+			DepJson->SetStringField(TEXT("name"), (*DepAsset)->AssetName.ToString());
 		}
 
 		DependencyArray.Add(MakeShared<FJsonValueObject>(DepJson));
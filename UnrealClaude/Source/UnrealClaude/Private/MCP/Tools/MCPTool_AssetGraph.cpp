@@ -0,0 +1,405 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTool_AssetGraph.h"
+#include "UnrealClaudeConstants.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Algo/Reverse.h"
+
+using namespace UnrealClaudeConstants::AssetGraph;
+
+namespace
+{
+	struct FGraphNode
+	{
+		FName PackageName;
+
+		/** Node this one was first reached from (INDEX_NONE for the root) */
+		int32 Parent = INDEX_NONE;
+		int32 Depth = 0;
+
+		/** Reachable from the root through hard references only */
+		bool bHard = false;
+
+		/** -1 when the registry has no package data (e.g. never saved) */
+		int64 DiskSize = -1;
+
+		FName AssetName;
+		FName ClassName;
+	};
+
+	struct FClassTotal
+	{
+		int32 Count = 0;
+		int64 Size = 0;
+	};
+
+	FName ToPackageName(const FString& Path)
+	{
+		// Accept both package paths and full object paths (e.g., /Game/BP.BP_C -> /Game/BP)
+		return FName(*(Path.Contains(TEXT(".")) ? FPackageName::ObjectPathToPackageName(Path) : Path));
+	}
+
+	bool IsSkippedPackage(FName PackageName, bool bIncludeEngine)
+	{
+		const FString Name = PackageName.ToString();
+		return Name.StartsWith(TEXT("/Script/")) || (!bIncludeEngine && Name.StartsWith(TEXT("/Engine/")));
+	}
+
+	/** Whether Ancestor is NodeIndex or one of the nodes it was reached through */
+	bool IsOnChain(const TArray<FGraphNode>& Nodes, int32 NodeIndex, int32 Ancestor)
+	{
+		for (int32 i = NodeIndex; i != INDEX_NONE; i = Nodes[i].Parent)
+		{
+			if (i == Ancestor)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/** Node indices from the root down to NodeIndex */
+	TArray<int32> GetChain(const TArray<FGraphNode>& Nodes, int32 NodeIndex)
+	{
+		TArray<int32> Chain;
+		for (int32 i = NodeIndex; i != INDEX_NONE; i = Nodes[i].Parent)
+		{
+			Chain.Add(i);
+		}
+		Algo::Reverse(Chain);
+		return Chain;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> ChainToJson(const TArray<FGraphNode>& Nodes, const TArray<int32>& Chain)
+	{
+		TArray<TSharedPtr<FJsonValue>> Array;
+		Array.Reserve(Chain.Num());
+		for (const int32 NodeIndex : Chain)
+		{
+			Array.Add(MakeShared<FJsonValueString>(Nodes[NodeIndex].PackageName.ToString()));
+		}
+		return Array;
+	}
+}
+
+FMCPToolResult FMCPTool_AssetGraph::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	FString AssetPath;
+	TOptional<FMCPToolResult> Error;
+	if (!ExtractRequiredString(Params, TEXT("asset_path"), AssetPath, Error))
+	{
+		return Error.GetValue();
+	}
+
+	const FString Direction = ExtractOptionalString(Params, TEXT("direction"), TEXT("dependencies")).ToLower();
+	if (Direction != TEXT("dependencies") && Direction != TEXT("referencers"))
+	{
+		return FMCPToolResult::Error(FString::Printf(TEXT("Unknown direction: %s. Valid: dependencies, referencers"), *Direction));
+	}
+	const bool bReferencers = Direction == TEXT("referencers");
+
+	const FString SortBy = ExtractOptionalString(Params, TEXT("sort_by"), TEXT("size")).ToLower();
+	if (SortBy != TEXT("size") && SortBy != TEXT("depth"))
+	{
+		return FMCPToolResult::Error(FString::Printf(TEXT("Unknown sort_by: %s. Valid: size, depth"), *SortBy));
+	}
+
+	const int32 MaxDepthParam = FMath::Clamp(ExtractOptionalNumber<int32>(Params, TEXT("max_depth"), DefaultMaxDepth), 1, MaxDepth);
+	const bool bIncludeSoft = ExtractOptionalBool(Params, TEXT("include_soft"), true);
+	const bool bIncludeEngine = ExtractOptionalBool(Params, TEXT("include_engine"), false);
+	const FString PathTo = ExtractOptionalString(Params, TEXT("path_to"));
+	const int32 Limit = FMath::Clamp(ExtractOptionalNumber<int32>(Params, TEXT("limit"), DefaultLimit), 1, MaxLimit);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	const FName RootPackage = ToPackageName(AssetPath);
+	TArray<FAssetData> RootAssets;
+	AssetRegistry.GetAssetsByPackageName(RootPackage, RootAssets);
+	if (RootAssets.Num() == 0)
+	{
+		return FMCPToolResult::Error(FString::Printf(TEXT("Asset not found: %s"), *AssetPath));
+	}
+
+	// Breadth-first walk; each package keeps the first (shortest) route it was reached by
+	TArray<FGraphNode> Nodes;
+	TMap<FName, int32> NodeIndexByPackage;
+	TArray<TArray<int32>> HardLinks;
+
+	FGraphNode& Root = Nodes.AddDefaulted_GetRef();
+	Root.PackageName = RootPackage;
+	NodeIndexByPackage.Add(RootPackage, 0);
+	HardLinks.AddDefaulted();
+
+	const UE::AssetRegistry::FDependencyQuery Query = bIncludeSoft
+		? UE::AssetRegistry::FDependencyQuery()
+		: UE::AssetRegistry::FDependencyQuery(UE::AssetRegistry::EDependencyQuery::Hard);
+
+	TArray<TSharedPtr<FJsonValue>> CyclesArray;
+	int32 CycleCount = 0;
+	bool bTruncated = false;
+	TArray<FAssetDependency> Links;
+
+	for (int32 Current = 0; Current < Nodes.Num(); ++Current)
+	{
+		const int32 CurrentDepth = Nodes[Current].Depth;
+		if (CurrentDepth >= MaxDepthParam)
+		{
+			// Breadth-first order: every remaining node is at least this deep
+			break;
+		}
+
+		Links.Reset();
+		const FAssetIdentifier Identifier(Nodes[Current].PackageName);
+		if (bReferencers)
+		{
+			AssetRegistry.GetReferencers(Identifier, Links, UE::AssetRegistry::EDependencyCategory::Package, Query);
+		}
+		else
+		{
+			AssetRegistry.GetDependencies(Identifier, Links, UE::AssetRegistry::EDependencyCategory::Package, Query);
+		}
+
+		for (const FAssetDependency& Link : Links)
+		{
+			const FName LinkedPackage = Link.AssetId.PackageName;
+			if (LinkedPackage.IsNone() || IsSkippedPackage(LinkedPackage, bIncludeEngine))
+			{
+				continue;
+			}
+
+			const bool bHardLink = EnumHasAnyFlags(Link.Properties, UE::AssetRegistry::EDependencyProperty::Hard);
+
+			if (const int32* Existing = NodeIndexByPackage.Find(LinkedPackage))
+			{
+				if (bHardLink)
+				{
+					HardLinks[Current].Add(*Existing);
+				}
+
+				// A link back into the chain we came from closes a cycle
+				if (*Existing != Current && IsOnChain(Nodes, Current, *Existing))
+				{
+					CycleCount++;
+					if (CyclesArray.Num() < MaxReportedCycles)
+					{
+						const TArray<int32> Chain = GetChain(Nodes, Current);
+						const int32 CycleStart = Chain.Find(*Existing);
+						TArray<int32> Cycle(Chain.GetData() + CycleStart, Chain.Num() - CycleStart);
+						Cycle.Add(*Existing);
+						CyclesArray.Add(MakeShared<FJsonValueArray>(ChainToJson(Nodes, Cycle)));
+					}
+				}
+				continue;
+			}
+
+			if (Nodes.Num() >= MaxNodes)
+			{
+				bTruncated = true;
+				continue;
+			}
+
+			const int32 NewIndex = Nodes.Num();
+			FGraphNode& Node = Nodes.AddDefaulted_GetRef();
+			Node.PackageName = LinkedPackage;
+			Node.Parent = Current;
+			Node.Depth = CurrentDepth + 1;
+			NodeIndexByPackage.Add(LinkedPackage, NewIndex);
+			HardLinks.AddDefaulted();
+			if (bHardLink)
+			{
+				HardLinks[Current].Add(NewIndex);
+			}
+		}
+	}
+
+	// Second walk over the recorded hard links only, within the same depth limit
+	{
+		TArray<int32> HardDepth;
+		HardDepth.Init(INDEX_NONE, Nodes.Num());
+		HardDepth[0] = 0;
+		Nodes[0].bHard = true;
+
+		TArray<int32> Queue = { 0 };
+		for (int32 QueueIndex = 0; QueueIndex < Queue.Num(); ++QueueIndex)
+		{
+			const int32 From = Queue[QueueIndex];
+			if (HardDepth[From] >= MaxDepthParam)
+			{
+				continue;
+			}
+			for (const int32 To : HardLinks[From])
+			{
+				if (HardDepth[To] == INDEX_NONE)
+				{
+					HardDepth[To] = HardDepth[From] + 1;
+					Nodes[To].bHard = true;
+					Queue.Add(To);
+				}
+			}
+		}
+	}
+
+	// Sizes and classes for the whole closure in one registry query each
+	TArray<FName> PackageNames;
+	PackageNames.Reserve(Nodes.Num());
+	for (const FGraphNode& Node : Nodes)
+	{
+		PackageNames.Add(Node.PackageName);
+	}
+
+	const TArray<TOptional<FAssetPackageData>> PackageDatas = AssetRegistry.GetAssetPackageDatasCopy(PackageNames);
+	for (int32 i = 0; i < PackageDatas.Num() && i < Nodes.Num(); ++i)
+	{
+		if (PackageDatas[i].IsSet())
+		{
+			Nodes[i].DiskSize = PackageDatas[i]->DiskSize;
+		}
+	}
+
+	FARFilter Filter;
+	Filter.PackageNames = PackageNames;
+	TArray<FAssetData> ClosureAssets;
+	AssetRegistry.GetAssets(Filter, ClosureAssets);
+	for (const FAssetData& AssetData : ClosureAssets)
+	{
+		const int32* NodeIndex = NodeIndexByPackage.Find(AssetData.PackageName);
+		if (!NodeIndex)
+		{
+			continue;
+		}
+
+		// Prefer the package's main asset (named after the package) over other assets in it
+		FGraphNode& Node = Nodes[*NodeIndex];
+		if (Node.AssetName.IsNone() || AssetData.AssetName == FPackageName::GetShortFName(AssetData.PackageName))
+		{
+			Node.AssetName = AssetData.AssetName;
+			Node.ClassName = AssetData.AssetClassPath.GetAssetName();
+		}
+	}
+
+	// Totals over the closure (root included)
+	int64 TotalSize = 0;
+	int64 HardSize = 0;
+	int32 HardCount = 0;
+	int32 UnknownSizeCount = 0;
+	TMap<FName, FClassTotal> ClassTotals;
+	for (const FGraphNode& Node : Nodes)
+	{
+		const int64 Size = FMath::Max<int64>(Node.DiskSize, 0);
+		if (Node.DiskSize < 0)
+		{
+			UnknownSizeCount++;
+		}
+		TotalSize += Size;
+		if (Node.bHard)
+		{
+			HardSize += Size;
+			HardCount++;
+		}
+		FClassTotal& ClassTotal = ClassTotals.FindOrAdd(Node.ClassName.IsNone() ? FName(TEXT("Unknown")) : Node.ClassName);
+		ClassTotal.Count++;
+		ClassTotal.Size += Size;
+	}
+
+	ClassTotals.ValueSort([](const FClassTotal& A, const FClassTotal& B) { return A.Size > B.Size; });
+	TSharedPtr<FJsonObject> ByClass = MakeShared<FJsonObject>();
+	for (const TPair<FName, FClassTotal>& Pair : ClassTotals)
+	{
+		TSharedPtr<FJsonObject> ClassJson = MakeShared<FJsonObject>();
+		ClassJson->SetNumberField(TEXT("count"), Pair.Value.Count);
+		ClassJson->SetNumberField(TEXT("size"), static_cast<double>(Pair.Value.Size));
+		ByClass->SetObjectField(Pair.Key.ToString(), ClassJson);
+	}
+
+	// Listed nodes exclude the root, which is reported separately
+	TArray<int32> Order;
+	Order.Reserve(Nodes.Num() - 1);
+	for (int32 i = 1; i < Nodes.Num(); ++i)
+	{
+		Order.Add(i);
+	}
+	const bool bBySize = SortBy == TEXT("size");
+	Order.Sort([&Nodes, bBySize](int32 A, int32 B)
+	{
+		const FGraphNode& NodeA = Nodes[A];
+		const FGraphNode& NodeB = Nodes[B];
+		if (bBySize && NodeA.DiskSize != NodeB.DiskSize)
+		{
+			return NodeA.DiskSize > NodeB.DiskSize;
+		}
+		if (NodeA.Depth != NodeB.Depth)
+		{
+			return NodeA.Depth < NodeB.Depth;
+		}
+		return bBySize ? A < B : NodeA.DiskSize > NodeB.DiskSize;
+	});
+
+	const int32 ListedCount = FMath::Min(Limit, Order.Num());
+	TArray<TSharedPtr<FJsonValue>> NodesArray;
+	NodesArray.Reserve(ListedCount);
+	for (int32 i = 0; i < ListedCount; ++i)
+	{
+		const FGraphNode& Node = Nodes[Order[i]];
+		TSharedPtr<FJsonObject> NodeJson = MakeShared<FJsonObject>();
+		NodeJson->SetStringField(TEXT("path"), Node.PackageName.ToString());
+		if (!Node.AssetName.IsNone())
+		{
+			NodeJson->SetStringField(TEXT("name"), Node.AssetName.ToString());
+			NodeJson->SetStringField(TEXT("class"), Node.ClassName.ToString());
+		}
+		if (Node.DiskSize >= 0)
+		{
+			NodeJson->SetNumberField(TEXT("size"), static_cast<double>(Node.DiskSize));
+		}
+		NodeJson->SetNumberField(TEXT("depth"), Node.Depth);
+		NodeJson->SetBoolField(TEXT("hard"), Node.bHard);
+		NodeJson->SetStringField(TEXT("via"), Nodes[Node.Parent].PackageName.ToString());
+		NodesArray.Add(MakeShared<FJsonValueObject>(NodeJson));
+	}
+
+	TSharedPtr<FJsonObject> Totals = MakeShared<FJsonObject>();
+	Totals->SetNumberField(TEXT("nodes"), Nodes.Num());
+	Totals->SetNumberField(TEXT("hardNodes"), HardCount);
+	Totals->SetNumberField(TEXT("totalSize"), static_cast<double>(TotalSize));
+	Totals->SetNumberField(TEXT("hardSize"), static_cast<double>(HardSize));
+	Totals->SetNumberField(TEXT("unknownSize"), UnknownSizeCount);
+	Totals->SetObjectField(TEXT("byClass"), ByClass);
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetStringField(TEXT("root"), RootPackage.ToString());
+	ResultData->SetNumberField(TEXT("rootSize"), static_cast<double>(Nodes[0].DiskSize));
+	ResultData->SetStringField(TEXT("direction"), Direction);
+	ResultData->SetNumberField(TEXT("max_depth"), MaxDepthParam);
+	ResultData->SetBoolField(TEXT("include_soft"), bIncludeSoft);
+	ResultData->SetObjectField(TEXT("totals"), Totals);
+	ResultData->SetArrayField(TEXT("nodes"), NodesArray);
+	ResultData->SetNumberField(TEXT("count"), ListedCount);
+	ResultData->SetBoolField(TEXT("hasMore"), ListedCount < Order.Num());
+	ResultData->SetNumberField(TEXT("cycleCount"), CycleCount);
+	ResultData->SetArrayField(TEXT("cycles"), CyclesArray);
+	ResultData->SetBoolField(TEXT("truncated"), bTruncated);
+
+	if (!PathTo.IsEmpty())
+	{
+		if (const int32* TargetIndex = NodeIndexByPackage.Find(ToPackageName(PathTo)))
+		{
+			ResultData->SetArrayField(TEXT("pathTo"), ChainToJson(Nodes, GetChain(Nodes, *TargetIndex)));
+		}
+		else
+		{
+			ResultData->SetStringField(TEXT("pathToError"),
+				FString::Printf(TEXT("%s is not reached from the root within max_depth %d"), *PathTo, MaxDepthParam));
+		}
+	}
+
+	const FString Message = FString::Printf(TEXT("%s of '%s': %d package%s, %s total (%s through hard references)%s"),
+		bReferencers ? TEXT("Referencers") : TEXT("Dependencies"),
+		*RootPackage.ToString(),
+		Nodes.Num() - 1, Nodes.Num() == 2 ? TEXT("") : TEXT("s"),
+		*FText::AsMemory(TotalSize).ToString(),
+		*FText::AsMemory(HardSize).ToString(),
+		bTruncated ? TEXT(" [truncated]") : TEXT(""));
+
+	return FMCPToolResult::Success(Message, ResultData);
+}
@@ -0,0 +1,62 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCP/MCPToolBase.h"
+
+/**
+ * MCP Tool: Transitive dependency/referencer graph of an asset
+ *
+ * Walks the asset registry breadth-first from one package, in either
+ * direction, up to a depth limit. Every reached package records the
+ * package it was first reached from, so the chain back to the root can be
+ * reported, and edges that lead back into the current chain are reported
+ * as cycles. Class names and on-disk sizes for the whole closure are read
+ * in one batched registry query after the walk instead of per row.
+ */
+class FMCPTool_AssetGraph : public FMCPToolBase
+{
+public:
+	virtual FMCPToolInfo GetInfo() const override
+	{
+		FMCPToolInfo Info;
+		Info.Name = TEXT("asset_graph");
+		Info.Description = TEXT(
+			"Walk the transitive dependencies (or referencers) of an asset and total their on-disk size.\n\n"
+			"Answers questions like 'why does loading this map pull in 4 GB?' in one call: returns the "
+			"closure size, the heaviest packages in it, and for each one the package it was reached from.\n\n"
+			"Directions:\n"
+			"- 'dependencies': what this asset loads (default)\n"
+			"- 'referencers': what loads this asset\n\n"
+			"Sizes come from asset registry package data and are uncooked .uasset/.umap sizes. "
+			"'hardSize' counts only packages reachable through hard references, i.e. what is "
+			"loaded unconditionally with the root.\n\n"
+			"Use 'path_to' to get the full reference chain from the root to one package.\n\n"
+			"Returns: root, totals (nodes, totalSize, hardSize, byClass), nodes sorted by sort_by, "
+			"cycles, and pathTo when requested."
+		);
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("asset_path"), TEXT("string"),
+				TEXT("Root asset or package path (e.g., '/Game/Maps/MainMap')"), true),
+			FMCPToolParameter(TEXT("direction"), TEXT("string"),
+				TEXT("'dependencies' or 'referencers' (default: dependencies)"), false, TEXT("dependencies")),
+			FMCPToolParameter(TEXT("max_depth"), TEXT("number"),
+				TEXT("Maximum hops from the root (1-64, default: 8)"), false, TEXT("8")),
+			FMCPToolParameter(TEXT("include_soft"), TEXT("boolean"),
+				TEXT("Follow soft references as well as hard ones (default: true)"), false, TEXT("true")),
+			FMCPToolParameter(TEXT("include_engine"), TEXT("boolean"),
+				TEXT("Include /Engine/ content (default: false)"), false, TEXT("false")),
+			FMCPToolParameter(TEXT("sort_by"), TEXT("string"),
+				TEXT("Node order: 'size' (largest first) or 'depth' (default: size)"), false, TEXT("size")),
+			FMCPToolParameter(TEXT("path_to"), TEXT("string"),
+				TEXT("Optional package in the closure to return the full chain from the root for"), false),
+			FMCPToolParameter(TEXT("limit"), TEXT("number"),
+				TEXT("Maximum nodes listed (1-5000, default: 100); totals always cover the whole closure"), false, TEXT("100"))
+		};
+		Info.Annotations = FMCPToolAnnotations::ReadOnly();
+		return Info;
+	}
+
+	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+};
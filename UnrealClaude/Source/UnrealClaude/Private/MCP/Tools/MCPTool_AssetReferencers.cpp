@@ -82,6 +82,20 @@ FMCPToolResult FMCPTool_AssetReferencers::Execute(const TSharedRef<FJsonObject>&
 	int32 Count = EndIndex - StartIndex;
 	bool bHasMore = EndIndex < Total;
 
+	// Fetch asset data for the whole slice in one registry query (an empty filter would match everything)
+	TArray<FAssetData> SliceAssets;
+	if (Count > 0)
+	{
+		FARFilter SliceFilter;
+		SliceFilter.PackageNames.Append(FilteredRefs.GetData() + StartIndex, Count);
+		AssetRegistry.GetAssets(SliceFilter, SliceAssets);
+	}
+	TMap<FName, const FAssetData*> AssetByPackage;
+	for (const FAssetData& SliceAsset : SliceAssets)
+	{
+		AssetByPackage.FindOrAdd(SliceAsset.PackageName, &SliceAsset);
+	}
+
 	// Build result array for the paginated slice
 	TArray<TSharedPtr<FJsonValue>> ReferencerArray;
 	for (int32 i = StartIndex; i < EndIndex; ++i)
@@ -92,13 +106,11 @@ FMCPToolResult FMCPTool_AssetReferencers::Execute(const TSharedRef<FJsonObject>&
 		TSharedPtr<FJsonObject> RefJson = MakeShared<FJsonObject>();
 		RefJson->SetStringField(TEXT("path"), PathStr);
 
-		// Try to get the asset class for this referencer
-		TArray<FAssetData> RefAssets;
-		AssetRegistry.GetAssetsByPackageName(RefPath, RefAssets);
-		if (RefAssets.Num() > 0)
+		// Asset class for this referencer, if the registry knows it
+		if (const FAssetData* const* RefAsset = AssetByPackage.Find(RefPath))
 		{
-			RefJson->SetStringField(TEXT("class"), RefAssets[0].AssetClassPath.GetAssetName().ToString());
-			RefJson->SetStringField(TEXT("name"), RefAssets[0].AssetName.ToString());
+			RefJson->SetStringField(TEXT("class"), (*RefAsset)->AssetClassPath.GetAssetName().ToString());
+			RefJson->SetStringField(TEXT("name"), (*RefAsset)->AssetName.ToString());
 		}
 
 		ReferencerArray.Add(MakeShared<FJsonValueObject>(RefJson));
@@ -1,6 +1,9 @@
 // Copyright Natali Caggiano. All Rights Reserved.
 
 #include "MCPTool_AssetSearch.h"
+#include "MCP/MCPCursorStore.h"
+#include "MCP/MCPAssetNameIndex.h"
+#include "MCP/MCPClassResolver.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetRegistry/IAssetRegistry.h"
 
@@ -14,9 +17,24 @@ FMCPToolResult FMCPTool_AssetSearch::Execute(const TSharedRef<FJsonObject>& Para
 	FString ClassFilter = ExtractOptionalString(Params, TEXT("class_filter"));
 	FString PathFilter = ExtractOptionalString(Params, TEXT("path_filter"), TEXT("/Game/"));
 	FString NamePattern = ExtractOptionalString(Params, TEXT("name_pattern"));
+	const bool bFuzzy = ExtractOptionalBool(Params, TEXT("fuzzy"), false);
 	int32 Limit = FMath::Clamp(ExtractOptionalNumber<int32>(Params, TEXT("limit"), 25), 1, 1000);
 	int32 Offset = FMath::Max(0, ExtractOptionalNumber<int32>(Params, TEXT("offset"), 0));
 
+	// Continue an earlier search from its snapshot
+	const FString Cursor = ExtractOptionalString(Params, TEXT("cursor"));
+	if (!Cursor.IsEmpty())
+	{
+		return ExecuteFromCursor(AssetRegistry, Cursor, Limit);
+	}
+
+	FMCPFieldSet Fields;
+	FString FieldsError;
+	if (!FMCPFieldSet::Parse(Params, GetAssetFieldNames(), Fields, FieldsError))
+	{
+		return FMCPToolResult::Error(FieldsError);
+	}
+
 	// Build FARFilter
 	FARFilter Filter;
 	Filter.bRecursivePaths = true;
@@ -31,70 +49,55 @@ FMCPToolResult FMCPTool_AssetSearch::Execute(const TSharedRef<FJsonObject>& Para
 	// Apply class filter
 	if (!ClassFilter.IsEmpty())
 	{
-		// Try to resolve class path - handle both full paths and short names
+		// Resolve short names and paths the same way every tool does
 		FString ClassPath = ClassFilter;
-
-		// If it's a short name, try common prefixes
-		if (!ClassPath.StartsWith(TEXT("/")))
+		if (UClass* FoundClass = FMCPClassResolver::Get().FindClass(ClassFilter))
+		{
+			ClassPath = FoundClass->GetClassPathName().ToString();
+		}
+		else if (!ClassPath.StartsWith(TEXT("/")))
 		{
-			// Try /Script/Engine first (common classes like StaticMesh, Blueprint)
-			UClass* FoundClass = FindObject<UClass>(nullptr, *FString::Printf(TEXT("/Script/Engine.%s"), *ClassFilter));
-
-			if (!FoundClass)
-			{
-				// Try /Script/CoreUObject
-				FoundClass = FindObject<UClass>(nullptr, *FString::Printf(TEXT("/Script/CoreUObject.%s"), *ClassFilter));
-			}
-
-			if (!FoundClass)
-			{
-				// Try /Script/Niagara for particle systems
-				FoundClass = FindObject<UClass>(nullptr, *FString::Printf(TEXT("/Script/Niagara.%s"), *ClassFilter));
-			}
-
-			if (!FoundClass)
-			{
-				// Try direct find
-				FoundClass = FindObject<UClass>(nullptr, *ClassFilter);
-			}
-
-			if (FoundClass)
-			{
-				ClassPath = FoundClass->GetClassPathName().ToString();
-			}
-			else
-			{
-				// Build path manually as fallback
-				ClassPath = FString::Printf(TEXT("/Script/Engine.%s"), *ClassFilter);
-			}
+			// Unknown short name; let the registry report no matches
+			ClassPath = FString::Printf(TEXT("/Script/Engine.%s"), *ClassFilter);
 		}
 
 		Filter.ClassPaths.Add(FTopLevelAssetPath(ClassPath));
 	}
 
-	// Query assets
-	TArray<FAssetData> AllAssets;
-	AssetRegistry.GetAssets(Filter, AllAssets);
+	// Matching object paths in result order, plus the match tier for name searches
+	TArray<FString> MatchPaths;
+	TArray<FMCPAssetMatch> NameMatches;
 
-	// Apply name pattern filter (post-query, case-insensitive)
-	TArray<FAssetData> FilteredAssets;
 	if (!NamePattern.IsEmpty())
 	{
-		for (const FAssetData& Asset : AllAssets)
+		// Name searches go through the trigram index and come back ranked
+		TSet<FTopLevelAssetPath> ClassPaths;
+		if (Filter.ClassPaths.Num() > 0)
+		{
+			AssetRegistry.GetDerivedClassNames(Filter.ClassPaths, TSet<FTopLevelAssetPath>(), ClassPaths);
+		}
+		FMCPAssetNameIndex::Get().Search(NamePattern, ClassPaths, PathFilter, bFuzzy, NameMatches);
+
+		MatchPaths.Reserve(NameMatches.Num());
+		for (const FMCPAssetMatch& Match : NameMatches)
 		{
-			if (Asset.AssetName.ToString().Contains(NamePattern, ESearchCase::IgnoreCase))
-			{
-				FilteredAssets.Add(Asset);
-			}
+			MatchPaths.Add(Match.ObjectPath.ToString());
 		}
 	}
 	else
 	{
-		FilteredAssets = MoveTemp(AllAssets);
+		TArray<FAssetData> AllAssets;
+		AssetRegistry.GetAssets(Filter, AllAssets);
+
+		MatchPaths.Reserve(AllAssets.Num());
+		for (const FAssetData& Asset : AllAssets)
+		{
+			MatchPaths.Add(Asset.GetObjectPathString());
+		}
 	}
 
 	// Calculate pagination
-	int32 Total = FilteredAssets.Num();
+	int32 Total = MatchPaths.Num();
 	int32 StartIndex = FMath::Min(Offset, Total);
 	int32 EndIndex = FMath::Min(StartIndex + Limit, Total);
 	int32 Count = EndIndex - StartIndex;
@@ -104,7 +107,17 @@ FMCPToolResult FMCPTool_AssetSearch::Execute(const TSharedRef<FJsonObject>& Para
 	TArray<TSharedPtr<FJsonValue>> AssetsArray;
 	for (int32 i = StartIndex; i < EndIndex; ++i)
 	{
-		AssetsArray.Add(MakeShared<FJsonValueObject>(AssetDataToJson(FilteredAssets[i])));
+		const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(MatchPaths[i]));
+		if (!AssetData.IsValid())
+		{
+			continue;
+		}
+		TSharedPtr<FJsonObject> AssetJson = AssetDataToJson(AssetData, Fields);
+		if (NameMatches.IsValidIndex(i))
+		{
+			AssetJson->SetStringField(TEXT("match"), FMCPAssetNameIndex::TierToString(NameMatches[i].Tier));
+		}
+		AssetsArray.Add(MakeShared<FJsonValueObject>(AssetJson));
 	}
 
 	// Build result data
@@ -118,6 +131,15 @@ FMCPToolResult FMCPTool_AssetSearch::Execute(const TSharedRef<FJsonObject>& Para
 	if (bHasMore)
 	{
 		ResultData->SetNumberField(TEXT("nextOffset"), EndIndex);
+
+		// Snapshot the matching paths so later pages skip the registry query
+		TSharedPtr<FJsonObject> Options = MakeShared<FJsonObject>();
+		if (!Fields.IsAll())
+		{
+			Options->SetArrayField(TEXT("fields"), StringArrayToJsonArray(Fields.GetNames()));
+		}
+		ResultData->SetStringField(TEXT("nextCursor"),
+			FMCPCursorStore::Get().CreateCursor(GetInfo().Name, MoveTemp(MatchPaths), EndIndex, Options));
 	}
 
 	// Build message
@@ -125,6 +147,10 @@ FMCPToolResult FMCPTool_AssetSearch::Execute(const TSharedRef<FJsonObject>& Para
 	if (Total == 0)
 	{
 		Message = TEXT("No assets found matching the search criteria");
+		if (!NamePattern.IsEmpty() && !bFuzzy)
+		{
+			Message += TEXT(" (retry with fuzzy=true to include close spellings)");
+		}
 	}
 	else if (Count == Total)
 	{
@@ -139,21 +165,96 @@ FMCPToolResult FMCPTool_AssetSearch::Execute(const TSharedRef<FJsonObject>& Para
 	return FMCPToolResult::Success(Message, ResultData);
 }
 
-TSharedPtr<FJsonObject> FMCPTool_AssetSearch::AssetDataToJson(const FAssetData& AssetData) const
+FMCPToolResult FMCPTool_AssetSearch::ExecuteFromCursor(IAssetRegistry& AssetRegistry, const FString& Cursor, int32 Limit)
+{
+	FMCPCursorPage Page;
+	FString CursorError;
+	if (!FMCPCursorStore::Get().ReadPage(Cursor, GetInfo().Name, Limit, Page, CursorError))
+	{
+		return FMCPToolResult::Error(CursorError);
+	}
+
+	TArray<FString> FieldNames;
+	const FMCPFieldSet Fields = Page.Options.IsValid() && Page.Options->TryGetStringArrayField(TEXT("fields"), FieldNames)
+		? FMCPFieldSet(FieldNames)
+		: FMCPFieldSet();
+
+	// Assets deleted since the snapshot are skipped rather than shifting later pages
+	TArray<TSharedPtr<FJsonValue>> AssetsArray;
+	int32 MissingCount = 0;
+	for (const FString& AssetPath : Page.Ids)
+	{
+		const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(AssetPath));
+		if (!AssetData.IsValid())
+		{
+			MissingCount++;
+			continue;
+		}
+		AssetsArray.Add(MakeShared<FJsonValueObject>(AssetDataToJson(AssetData, Fields)));
+	}
+
+	const int32 PageEnd = Page.Offset + Page.Ids.Num();
+	const bool bHasMore = !Page.NextCursor.IsEmpty();
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetArrayField(TEXT("assets"), AssetsArray);
+	ResultData->SetNumberField(TEXT("count"), AssetsArray.Num());
+	ResultData->SetNumberField(TEXT("total"), Page.Total);
+	ResultData->SetNumberField(TEXT("offset"), Page.Offset);
+	ResultData->SetNumberField(TEXT("limit"), Limit);
+	ResultData->SetBoolField(TEXT("hasMore"), bHasMore);
+	if (bHasMore)
+	{
+		ResultData->SetStringField(TEXT("nextCursor"), Page.NextCursor);
+	}
+	if (MissingCount > 0)
+	{
+		ResultData->SetNumberField(TEXT("missing"), MissingCount);
+	}
+
+	FString Message = FString::Printf(TEXT("Found %d assets (showing %d-%d of %d total)"),
+		AssetsArray.Num(), Page.Offset + 1, PageEnd, Page.Total);
+	if (MissingCount > 0)
+	{
+		Message += FString::Printf(TEXT(", %d no longer exist"), MissingCount);
+	}
+
+	return FMCPToolResult::Success(Message, ResultData);
+}
+
+const TArray<const TCHAR*>& FMCPTool_AssetSearch::GetAssetFieldNames()
+{
+	static const TArray<const TCHAR*> Names = { TEXT("path"), TEXT("name"), TEXT("class"), TEXT("package_path") };
+	return Names;
+}
+
+TSharedPtr<FJsonObject> FMCPTool_AssetSearch::AssetDataToJson(const FAssetData& AssetData, const FMCPFieldSet& Fields) const
 {
 	TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
 
 	// Full object path (e.g., /Game/Characters/BP_Player.BP_Player)
-	Json->SetStringField(TEXT("path"), AssetData.GetObjectPathString());
+	if (Fields.Has(TEXT("path")))
+	{
+		Json->SetStringField(TEXT("path"), AssetData.GetObjectPathString());
+	}
 
 	// Asset name without path
-	Json->SetStringField(TEXT("name"), AssetData.AssetName.ToString());
+	if (Fields.Has(TEXT("name")))
+	{
+		Json->SetStringField(TEXT("name"), AssetData.AssetName.ToString());
+	}
 
 	// Class name (short form)
-	Json->SetStringField(TEXT("class"), AssetData.AssetClassPath.GetAssetName().ToString());
+	if (Fields.Has(TEXT("class")))
+	{
+		Json->SetStringField(TEXT("class"), AssetData.AssetClassPath.GetAssetName().ToString());
+	}
 
 	// Package path (folder containing the asset)
-	Json->SetStringField(TEXT("package_path"), AssetData.PackagePath.ToString());
+	if (Fields.Has(TEXT("package_path")))
+	{
+		Json->SetStringField(TEXT("package_path"), AssetData.PackagePath.ToString());
+	}
 
 	return Json;
 }
@@ -5,10 +5,13 @@
 #include "CoreMinimal.h"
 #include "MCP/MCPToolBase.h"
 
+class IAssetRegistry;
+
 /**
  * MCP Tool: Search for assets in the Unreal project
  *
  * Finds assets by class type, path prefix, or name pattern.
+ * Name searches use FMCPAssetNameIndex and are relevance-ranked.
  * Returns full asset paths with metadata for LLM consumption.
  */
 class FMCPTool_AssetSearch : public FMCPToolBase
@@ -25,12 +28,16 @@ public:
 			"Filter examples:\n"
 			"- class_filter='Blueprint' - Find all blueprints\n"
 			"- class_filter='StaticMesh', path_filter='/Game/Environment/' - Static meshes in folder\n"
-			"- name_pattern='Player' - Assets with 'Player' in name\n"
+			"- name_pattern='Player' - Assets with 'Player' in name, best matches first\n"
 			"- path_filter='/Game/Characters/', name_pattern='Enemy' - Combined filters\n\n"
 			"Common class types: Blueprint, StaticMesh, SkeletalMesh, Texture2D, Material, "
 			"MaterialInstance, AnimSequence, AnimBlueprint, SoundWave, ParticleSystem, NiagaraSystem\n\n"
-			"Returns: Array of assets with path, name, class, and package_path. "
-			"Use limit/offset for pagination on large result sets."
+			"Name searches return substring matches ranked exact > prefix > substring; each result's 'match' "
+			"says which. Set fuzzy=true to also get close spellings (e.g. 'Charcter'), ranked last.\n\n"
+			"Returns: Array of assets with path, name, class, and package_path "
+			"(pass 'fields' to return only some of them). "
+			"On large result sets, pass the returned nextCursor back as 'cursor' to page through "
+			"a stable snapshot of the matches (limit/offset also works)."
 		);
 		Info.Parameters = {
 			FMCPToolParameter(TEXT("class_filter"), TEXT("string"),
@@ -38,11 +45,17 @@ public:
 			FMCPToolParameter(TEXT("path_filter"), TEXT("string"),
 				TEXT("Path prefix to search within (e.g., '/Game/Characters/'). Searches recursively. Default: '/Game/'"), false, TEXT("/Game/")),
 			FMCPToolParameter(TEXT("name_pattern"), TEXT("string"),
-				TEXT("Substring to match in asset names (case-insensitive)"), false),
+				TEXT("Text to match in asset names (case-insensitive, ranked)"), false),
+			FMCPToolParameter(TEXT("fuzzy"), TEXT("boolean"),
+				TEXT("Also return near matches for name_pattern (default: false)"), false, TEXT("false")),
+			FMCPToolParameter(TEXT("fields"), TEXT("array"),
+				TEXT("Fields to return per asset: path, name, class, package_path (default: all)"), false),
 			FMCPToolParameter(TEXT("limit"), TEXT("number"),
 				TEXT("Maximum results to return (1-1000, default: 25)"), false, TEXT("25")),
 			FMCPToolParameter(TEXT("offset"), TEXT("number"),
-				TEXT("Number of results to skip for pagination (default: 0)"), false, TEXT("0"))
+				TEXT("Number of results to skip for pagination (default: 0)"), false, TEXT("0")),
+			FMCPToolParameter(TEXT("cursor"), TEXT("string"),
+				TEXT("nextCursor from a previous page; filters are taken from the original search"), false)
 		};
 		Info.Annotations = FMCPToolAnnotations::ReadOnly();
 		return Info;
@@ -51,6 +64,12 @@ public:
 	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
 
 private:
-	/** Convert FAssetData to JSON object with full path information */
-	TSharedPtr<FJsonObject> AssetDataToJson(const FAssetData& AssetData) const;
+	/** Serve a page from a cursor snapshot */
+	FMCPToolResult ExecuteFromCursor(IAssetRegistry& AssetRegistry, const FString& Cursor, int32 Limit);
+
+	/** Field names understood by AssetDataToJson */
+	static const TArray<const TCHAR*>& GetAssetFieldNames();
+
+	/** Convert FAssetData to a JSON object with the selected fields */
+	TSharedPtr<FJsonObject> AssetDataToJson(const FAssetData& AssetData, const FMCPFieldSet& Fields) const;
 };
@@ -0,0 +1,238 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTool_BatchEditActors.h"
+#include "MCP/MCPParamValidator.h"
+#include "UnrealClaudeModule.h"
+#include "UnrealClaudeConstants.h"
+#include "Editor.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "AI/NavigationSystemBase.h"
+#include "ScopedTransaction.h"
+
+FMCPToolResult FMCPTool_BatchEditActors::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	using namespace UnrealClaudeConstants::BatchEdit;
+
+	UWorld* World = nullptr;
+	if (auto Error = ValidateEditorContext(World))
+	{
+		return Error.GetValue();
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* EditsArray;
+	if (!Params->TryGetArrayField(TEXT("edits"), EditsArray) || EditsArray->Num() == 0)
+	{
+		return FMCPToolResult::Error(TEXT("Missing required parameter: edits (non-empty array)"));
+	}
+	if (EditsArray->Num() > MaxEdits)
+	{
+		return FMCPToolResult::Error(FString::Printf(TEXT("Too many edits: %d (max %d)"), EditsArray->Num(), MaxEdits));
+	}
+
+	TArray<TSharedPtr<FJsonValue>> ErrorsArray;
+	int32 FailedCount = 0;
+	auto AddError = [&ErrorsArray, &FailedCount](int32 Index, const FString& ActorName, const FString& Message)
+	{
+		FailedCount++;
+		if (ErrorsArray.Num() < MaxReportedErrors)
+		{
+			TSharedPtr<FJsonObject> ErrorJson = MakeShared<FJsonObject>();
+			ErrorJson->SetNumberField(TEXT("index"), Index);
+			ErrorJson->SetStringField(TEXT("actor"), ActorName);
+			ErrorJson->SetStringField(TEXT("error"), Message);
+			ErrorsArray.Add(MakeShared<FJsonValueObject>(ErrorJson));
+		}
+	};
+
+	TArray<AActor*> MovedActors;
+	TArray<AActor*> EditedActors;
+	// Final transform of each moved actor; applied once after the batch, however many edits moved it
+	TMap<AActor*, FTransform> PendingTransforms;
+	// Every (object, property) written; each gets one PostEditChangeProperty after the batch
+	TArray<TPair<UObject*, FProperty*>> PendingPostEdits;
+	int32 AppliedCount = 0;
+	int32 PropertiesSet = 0;
+
+	{
+		const FScopedTransaction Transaction(NSLOCTEXT("UnrealClaude", "BatchEditActors", "Batch Edit Actors"));
+
+		// Navigation octree/rebuild updates are queued until the lock is released
+		FNavigationLockContext NavigationLock(World, ENavigationLockReason::Unspecified);
+
+		for (int32 Index = 0; Index < EditsArray->Num(); ++Index)
+		{
+			const TSharedPtr<FJsonObject>* EditObj;
+			if (!(*EditsArray)[Index].IsValid() || !(*EditsArray)[Index]->TryGetObject(EditObj) || !EditObj->IsValid())
+			{
+				AddError(Index, FString(), TEXT("Edit must be an object"));
+				continue;
+			}
+			const TSharedRef<FJsonObject> Edit = EditObj->ToSharedRef();
+
+			FString ActorName;
+			FString ValidationError;
+			if (!Edit->TryGetStringField(TEXT("actor"), ActorName) || ActorName.IsEmpty())
+			{
+				AddError(Index, FString(), TEXT("Missing 'actor'"));
+				continue;
+			}
+			if (!FMCPParamValidator::ValidateActorName(ActorName, ValidationError))
+			{
+				AddError(Index, ActorName, ValidationError);
+				continue;
+			}
+
+			AActor* Actor = FindOrLoadActorByNameOrLabel(World, ActorName);
+			if (!Actor)
+			{
+				AddError(Index, ActorName, FString::Printf(TEXT("Actor not found: %s"), *ActorName));
+				continue;
+			}
+
+			FString PropertyPath;
+			const bool bHasProperty = Edit->TryGetStringField(TEXT("property"), PropertyPath) && !PropertyPath.IsEmpty();
+			if (bHasProperty)
+			{
+				if (!FMCPParamValidator::ValidatePropertyPath(PropertyPath, ValidationError))
+				{
+					AddError(Index, ActorName, ValidationError);
+					continue;
+				}
+				if (!Edit->HasField(TEXT("value")))
+				{
+					AddError(Index, ActorName, TEXT("'property' requires 'value'"));
+					continue;
+				}
+			}
+
+			const FTransform* PendingTransform = PendingTransforms.Find(Actor);
+			FTransform Transform = PendingTransform ? *PendingTransform : Actor->GetActorTransform();
+			const bool bMoved = ApplyTransformEdit(Edit, Transform);
+			if (bMoved)
+			{
+				PendingTransforms.Add(Actor, Transform);
+				MovedActors.AddUnique(Actor);
+			}
+
+			if (bHasProperty)
+			{
+				UObject* TargetObject = nullptr;
+				FProperty* Property = nullptr;
+				FString PropertyError;
+				if (!PropertySetter.SetPropertyFromJson(Actor, PropertyPath, Edit->TryGetField(TEXT("value")),
+					PropertyError, &TargetObject, &Property))
+				{
+					AddError(Index, ActorName, PropertyError);
+					if (!bMoved)
+					{
+						continue;
+					}
+				}
+				else
+				{
+					PendingPostEdits.AddUnique(TPair<UObject*, FProperty*>(TargetObject, Property));
+					PropertiesSet++;
+				}
+			}
+			else if (!bMoved)
+			{
+				AddError(Index, ActorName, TEXT("No changes specified. Provide location, rotation, scale, or property + value."));
+				continue;
+			}
+
+			EditedActors.AddUnique(Actor);
+			AppliedCount++;
+		}
+
+		// One component-hierarchy and render transform update per moved actor
+		for (const TPair<AActor*, FTransform>& Pending : PendingTransforms)
+		{
+			Pending.Key->Modify();
+			Pending.Key->SetActorTransform(Pending.Value, false, nullptr, ETeleportType::None);
+		}
+
+		for (const TPair<UObject*, FProperty*>& Pending : PendingPostEdits)
+		{
+			FPropertyChangedEvent ChangedEvent(Pending.Value, EPropertyChangeType::ValueSet);
+			Pending.Key->PostEditChangeProperty(ChangedEvent);
+		}
+	}
+
+	for (AActor* Actor : EditedActors)
+	{
+		Actor->MarkPackageDirty();
+	}
+
+	// Notify listeners once per actor, as an editor gizmo move would (keeps spatial index current)
+	for (AActor* Actor : MovedActors)
+	{
+		GEngine->BroadcastOnActorMoved(Actor);
+	}
+
+	if (AppliedCount > 0)
+	{
+		MarkWorldDirty(World);
+	}
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetNumberField(TEXT("applied"), AppliedCount);
+	ResultData->SetNumberField(TEXT("moved"), MovedActors.Num());
+	ResultData->SetNumberField(TEXT("propertiesSet"), PropertiesSet);
+	ResultData->SetNumberField(TEXT("failed"), FailedCount);
+	if (ErrorsArray.Num() > 0)
+	{
+		ResultData->SetArrayField(TEXT("errors"), ErrorsArray);
+	}
+
+	if (AppliedCount == 0)
+	{
+		// Keep the per-edit errors so the caller can see why
+		FMCPToolResult Result = FMCPToolResult::Error(FString::Printf(TEXT("No edits applied (%d failed)"), FailedCount));
+		Result.Data = ResultData;
+		return Result;
+	}
+
+	FString Message = FString::Printf(TEXT("Applied %d edits (%d actors moved, %d properties set)"),
+		AppliedCount, MovedActors.Num(), PropertiesSet);
+	if (FailedCount > 0)
+	{
+		Message += FString::Printf(TEXT(", %d failed"), FailedCount);
+	}
+
+	return FMCPToolResult::Success(Message, ResultData);
+}
+
+bool FMCPTool_BatchEditActors::ApplyTransformEdit(const TSharedRef<FJsonObject>& Edit, FTransform& InOutTransform) const
+{
+	const bool bRelative = ExtractOptionalBool(Edit, TEXT("relative"), false);
+
+	FVector NewLocation = InOutTransform.GetLocation();
+	const bool bLocationChanged = ExtractVectorComponents(Edit, TEXT("location"), NewLocation, bRelative);
+
+	FRotator NewRotation = InOutTransform.Rotator();
+	const bool bRotationChanged = ExtractRotatorComponents(Edit, TEXT("rotation"), NewRotation, bRelative);
+
+	// Scale uses multiplicative relative mode, as in move_actor
+	FVector NewScale = InOutTransform.GetScale3D();
+	const bool bScaleChanged = HasVectorParam(Edit, TEXT("scale"));
+	if (bScaleChanged)
+	{
+		if (bRelative)
+		{
+			NewScale *= ExtractVectorParam(Edit, TEXT("scale"), FVector::OneVector);
+		}
+		else
+		{
+			ExtractVectorComponents(Edit, TEXT("scale"), NewScale, false);
+		}
+	}
+
+	if (!bLocationChanged && !bRotationChanged && !bScaleChanged)
+	{
+		return false;
+	}
+
+	InOutTransform = FTransform(NewRotation, NewLocation, NewScale);
+	return true;
+}
@@ -0,0 +1,51 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCP/MCPToolBase.h"
+#include "MCPTool_SetProperty.h"
+
+/**
+ * MCP Tool: Apply many transform and property edits in one call
+ *
+ * All edits share one undo transaction. Navigation rebuilds are held until
+ * the batch finishes. Transform edits are accumulated per actor and applied
+ * with one SetActorTransform after the batch, so each moved actor updates its
+ * component hierarchy and render transform once. Each property gets
+ * PreEditChange before it is written and one PostEditChangeProperty after
+ * the batch, however often it was set.
+ */
+class FMCPTool_BatchEditActors : public FMCPToolBase
+{
+public:
+	virtual FMCPToolInfo GetInfo() const override
+	{
+		FMCPToolInfo Info;
+		Info.Name = TEXT("batch_edit_actors");
+		Info.Description = TEXT(
+			"Move and/or set properties on many actors in one call (one undo step for the whole batch).\n\n"
+			"Each edit is an object with 'actor' plus any of:\n"
+			"- location {x, y, z}, rotation {pitch, yaw, roll}, scale {x, y, z}, relative (same rules as move_actor)\n"
+			"- property + value (same paths and value formats as set_property)\n\n"
+			"Prefer this over repeated move_actor/set_property calls when editing more than a few actors.\n\n"
+			"Example: edits=[{actor:'Rock_1', location:{z:0}}, {actor:'Lamp_2', property:'LightComponent.Intensity', value:5000}]\n\n"
+			"Edits that fail (unknown actor, bad property) are skipped and listed in 'errors'; the rest are applied.\n\n"
+			"Returns: applied, moved, propertiesSet, failed, errors [{index, actor, error}]."
+		);
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("edits"), TEXT("array"), TEXT("Edits [{actor, location?, rotation?, scale?, relative?, property?, value?}]"), true)
+		};
+		Info.Annotations = FMCPToolAnnotations::Modifying();
+		return Info;
+	}
+
+	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+
+private:
+	/** Apply the transform part of an edit to an actor's pending transform; returns false if the edit has none */
+	bool ApplyTransformEdit(const TSharedRef<FJsonObject>& Edit, FTransform& InOutTransform) const;
+
+	/** Reuses set_property's path navigation and value conversion */
+	FMCPTool_SetProperty PropertySetter;
+};
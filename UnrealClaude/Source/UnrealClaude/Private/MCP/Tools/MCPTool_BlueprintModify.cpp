@@ -4,6 +4,7 @@
 #include "BlueprintUtils.h"
 #include "MCP/MCPParamValidator.h"
 #include "MCP/MCPBlueprintLoadContext.h"
+#include "BlueprintGraphText.h"
 #include "UnrealClaudeModule.h"
 #include "Engine/Blueprint.h"
 
@@ -21,6 +22,9 @@ namespace BlueprintModifyOps
 	static const FString ConnectPins = TEXT("connect_pins");
 	static const FString DisconnectPins = TEXT("disconnect_pins");
 	static const FString SetPinValue = TEXT("set_pin_value");
+	static const FString BeginEdit = TEXT("begin_edit");
+	static const FString CommitEdit = TEXT("commit_edit");
+	static const FString AbortEdit = TEXT("abort_edit");
 }
 
 FMCPToolResult FMCPTool_BlueprintModify::Execute(const TSharedRef<FJsonObject>& Params)
@@ -83,11 +87,30 @@ FMCPToolResult FMCPTool_BlueprintModify::Execute(const TSharedRef<FJsonObject>&
 		return ExecuteSetPinValue(Params);
 	}
 
+	// Edit sessions (deferred compile)
+	if (Operation == BlueprintModifyOps::BeginEdit)
+	{
+		return ExecuteBeginEdit(Params);
+	}
+	if (Operation == BlueprintModifyOps::CommitEdit)
+	{
+		return ExecuteCommitEdit(Params);
+	}
+	if (Operation == BlueprintModifyOps::AbortEdit)
+	{
+		return ExecuteAbortEdit(Params);
+	}
+
 	return FMCPToolResult::Error(FString::Printf(
-		TEXT("Unknown operation: '%s'. Valid: create, add_variable, remove_variable, add_function, remove_function, add_node, add_nodes, delete_node, connect_pins, disconnect_pins, set_pin_value"),
+		TEXT("Unknown operation: '%s'. Valid: create, add_variable, remove_variable, add_function, remove_function, add_node, add_nodes, delete_node, connect_pins, disconnect_pins, set_pin_value, begin_edit, commit_edit, abort_edit"),
 		*Operation));
 }
 
+void FMCPTool_BlueprintModify::GetRequiredAssets(const TSharedRef<FJsonObject>& Params, TArray<FSoftObjectPath>& OutAssets) const
+{
+	AddRequiredAssetParam(Params, TEXT("blueprint_path"), OutAssets);
+}
+
 FMCPToolResult FMCPTool_BlueprintModify::ExecuteCreate(const TSharedRef<FJsonObject>& Params)
 {
 	// Extract parameters
@@ -469,11 +492,23 @@ FMCPToolResult FMCPTool_BlueprintModify::ExecuteAddNodes(const TSharedRef<FJsonO
 	FString GraphName = ExtractOptionalString(Params, TEXT("graph_name"), TEXT(""));
 	bool bFunctionGraph = ExtractOptionalBool(Params, TEXT("is_function_graph"), false);
 
-	// Get nodes array
-	const TArray<TSharedPtr<FJsonValue>>* NodesArray;
-	if (!Params->TryGetArrayField(TEXT("nodes"), NodesArray))
+	// Get nodes array, or parse it from compact text
+	const TArray<TSharedPtr<FJsonValue>>* NodesArray = nullptr;
+	TArray<TSharedPtr<FJsonValue>> ParsedNodes;
+	TArray<TSharedPtr<FJsonValue>> Connections;
+	FString NodesText;
+	if (Params->TryGetStringField(TEXT("text"), NodesText) && !NodesText.IsEmpty())
+	{
+		FString ParseError;
+		if (!FBlueprintGraphText::Parse(NodesText, ParsedNodes, Connections, ParseError))
+		{
+			return FMCPToolResult::Error(FString::Printf(TEXT("Invalid 'text': %s"), *ParseError));
+		}
+		NodesArray = &ParsedNodes;
+	}
+	else if (!Params->TryGetArrayField(TEXT("nodes"), NodesArray))
 	{
-		return FMCPToolResult::Error(TEXT("'nodes' array is required"));
+		return FMCPToolResult::Error(TEXT("'nodes' array or compact 'text' is required"));
 	}
 
 	// Load and validate Blueprint
@@ -500,11 +535,15 @@ FMCPToolResult FMCPTool_BlueprintModify::ExecuteAddNodes(const TSharedRef<FJsonO
 		return FMCPToolResult::Error(CreateError);
 	}
 
-	// Process connections using helper
+	// Process connections (links from text first, then explicit ones) using helper
 	const TArray<TSharedPtr<FJsonValue>>* ConnectionsArray;
 	if (Params->TryGetArrayField(TEXT("connections"), ConnectionsArray))
 	{
-		ProcessNodeConnections(Graph, *ConnectionsArray, CreatedNodeIds);
+		Connections.Append(*ConnectionsArray);
+	}
+	if (Connections.Num() > 0)
+	{
+		ProcessNodeConnections(Graph, Connections, CreatedNodeIds);
 	}
 
 	// Compile and finalize
@@ -914,3 +953,103 @@ FMCPToolResult FMCPTool_BlueprintModify::ExecuteSetPinValue(const TSharedRef<FJs
 		ResultData
 	);
 }
+
+FMCPToolResult FMCPTool_BlueprintModify::ExecuteBeginEdit(const TSharedRef<FJsonObject>& Params)
+{
+	FMCPBlueprintLoadContext Context;
+	if (auto LoadError = Context.LoadAndValidate(Params))
+	{
+		return LoadError.GetValue();
+	}
+
+	FMCPBlueprintEditSessions& Sessions = FMCPBlueprintEditSessions::Get();
+	const bool bOpened = Sessions.Begin(Context.Blueprint);
+	const FMCPBlueprintEditSession* Session = Sessions.Find(Context.Blueprint);
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetStringField(TEXT("blueprint_path"), Context.Blueprint->GetPathName());
+	ResultData->SetBoolField(TEXT("already_open"), !bOpened);
+	ResultData->SetNumberField(TEXT("pending_changes"), Session ? Session->PendingOperations.Num() : 0);
+
+	return FMCPToolResult::Success(
+		bOpened
+			? FString::Printf(TEXT("Edit session opened for %s; changes compile on commit_edit"), *Context.Blueprint->GetName())
+			: FString::Printf(TEXT("Edit session already open for %s"), *Context.Blueprint->GetName()),
+		ResultData);
+}
+
+FMCPToolResult FMCPTool_BlueprintModify::ExecuteCommitEdit(const TSharedRef<FJsonObject>& Params)
+{
+	FMCPBlueprintLoadContext Context;
+	if (auto LoadError = Context.LoadAndValidate(Params))
+	{
+		return LoadError.GetValue();
+	}
+
+	// Close first so CompileAndFinalize runs the real compile; committing
+	// without a session still compiles, which is harmless
+	FMCPBlueprintEditSession Session;
+	const bool bHadSession = FMCPBlueprintEditSessions::Get().End(Context.Blueprint, Session);
+
+	TArray<TSharedPtr<FJsonValue>> OperationsArray;
+	for (const FString& Operation : Session.PendingOperations)
+	{
+		OperationsArray.Add(MakeShared<FJsonValueString>(Operation));
+	}
+
+	auto AddSessionFields = [&](const TSharedPtr<FJsonObject>& ResultData)
+	{
+		ResultData->SetBoolField(TEXT("had_session"), bHadSession);
+		ResultData->SetNumberField(TEXT("committed_changes"), Session.PendingOperations.Num());
+		ResultData->SetArrayField(TEXT("operations"), OperationsArray);
+	};
+
+	if (auto CompileError = Context.CompileAndFinalize(TEXT("Edit session")))
+	{
+		FMCPToolResult Result = CompileError.GetValue();
+		Result.Data = Context.BuildResultJson();
+		AddSessionFields(Result.Data);
+		return Result;
+	}
+
+	TSharedPtr<FJsonObject> ResultData = Context.BuildResultJson();
+	AddSessionFields(ResultData);
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Committed %d change%s to %s with one compile"),
+			Session.PendingOperations.Num(), Session.PendingOperations.Num() == 1 ? TEXT("") : TEXT("s"),
+			*Context.Blueprint->GetName()),
+		ResultData);
+}
+
+FMCPToolResult FMCPTool_BlueprintModify::ExecuteAbortEdit(const TSharedRef<FJsonObject>& Params)
+{
+	FMCPBlueprintLoadContext Context;
+	if (auto LoadError = Context.LoadAndValidate(Params))
+	{
+		return LoadError.GetValue();
+	}
+
+	FMCPBlueprintEditSession Session;
+	const bool bHadSession = FMCPBlueprintEditSessions::Get().End(Context.Blueprint, Session);
+
+	TArray<TSharedPtr<FJsonValue>> OperationsArray;
+	for (const FString& Operation : Session.PendingOperations)
+	{
+		OperationsArray.Add(MakeShared<FJsonValueString>(Operation));
+	}
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetStringField(TEXT("blueprint_path"), Context.Blueprint->GetPathName());
+	ResultData->SetBoolField(TEXT("had_session"), bHadSession);
+	ResultData->SetNumberField(TEXT("uncompiled_changes"), Session.PendingOperations.Num());
+	ResultData->SetArrayField(TEXT("operations"), OperationsArray);
+
+	// The changes were applied as they were made; only their compile is skipped
+	return FMCPToolResult::Success(
+		bHadSession
+			? FString::Printf(TEXT("Edit session for %s closed without compiling; %d applied change%s compile with the next modification or compile_blueprints"),
+				*Context.Blueprint->GetName(), Session.PendingOperations.Num(), Session.PendingOperations.Num() == 1 ? TEXT("") : TEXT("s"))
+			: FString::Printf(TEXT("No edit session was open for %s"), *Context.Blueprint->GetName()),
+		ResultData);
+}
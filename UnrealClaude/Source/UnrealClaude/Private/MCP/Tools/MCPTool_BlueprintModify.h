@@ -25,7 +25,13 @@
  *   - disconnect_pins: Disconnect two pins
  *   - set_pin_value: Set default value for an input pin
  *
- * All modification operations auto-compile the Blueprint after changes.
+ * Edit Sessions:
+ *   - begin_edit: Defer compiles for a Blueprint
+ *   - commit_edit: Compile once and close the session
+ *   - abort_edit: Close the session without compiling
+ *
+ * All modification operations auto-compile the Blueprint after changes,
+ * unless an edit session is open for it (see FMCPBlueprintEditSessions).
  */
 class FMCPTool_BlueprintModify : public FMCPToolBase
 {
@@ -39,11 +45,19 @@ public:
 			"Complexity Levels:\n"
 			"Level 2 (Structure): 'create', 'add_variable', 'remove_variable', 'add_function', 'remove_function'\n"
 			"Level 3 (Nodes): 'add_node', 'add_nodes' (batch), 'delete_node'\n"
-			"Level 4 (Wiring): 'connect_pins', 'disconnect_pins', 'set_pin_value'\n\n"
+			"Level 4 (Wiring): 'connect_pins', 'disconnect_pins', 'set_pin_value'\n"
+			"Edit sessions: 'begin_edit' defers compiles for a Blueprint, 'commit_edit' compiles once. "
+			"Use them around several changes to the same Blueprint (e.g., 20 variables and 5 functions "
+			"compile once instead of 25 times). 'abort_edit' closes a session without compiling. "
+			"Sessions idle for 10 minutes, or open when the map changes or PIE starts, are committed automatically.\n\n"
 			"Workflow: Use blueprint_query first to understand existing structure, then modify.\n\n"
 			"Node types: CallFunction, Branch, Event, VariableGet, VariableSet, Sequence, "
 			"PrintString, Add, Subtract, Multiply, Divide\n\n"
 			"Variable types: bool, int32, float, FString, FVector, FRotator, AActor*, UObject*, etc.\n\n"
+			"add_nodes also accepts 'text' in the compact format blueprint_query get_graph returns with "
+			"format='compact' (one line per node: 'n0 CallFunction function=PrintString @300,0 .InString=Hi then->n1.execute'). "
+			"Labels link nodes within the text; existing node IDs can be used as link targets. "
+			"The text must cover one graph (get_graph with graph_name).\n\n"
 			"Returns: Operation result with created node IDs (for subsequent connections)."
 		);
 		Info.Parameters = {
@@ -94,6 +108,8 @@ public:
 			// For batch add_nodes operation
 			FMCPToolParameter(TEXT("nodes"), TEXT("array"),
 				TEXT("Array of node specs: [{type, params, pos_x, pos_y, pin_values}]"), false),
+			FMCPToolParameter(TEXT("text"), TEXT("string"),
+				TEXT("add_nodes: nodes and links in compact graph format instead of 'nodes'"), false),
 			FMCPToolParameter(TEXT("connections"), TEXT("array"),
 				TEXT("Array of connections: [{from_node, from_pin, to_node, to_pin}] (use indices or node IDs)"), false),
 
@@ -118,6 +134,8 @@ public:
 	}
 
 	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+	virtual void GetRequiredAssets(const TSharedRef<FJsonObject>& Params, TArray<FSoftObjectPath>& OutAssets) const override;
+	virtual bool HasRequiredAssets() const override { return true; }
 
 private:
 	// Level 2 Operations
@@ -137,6 +155,11 @@ private:
 	FMCPToolResult ExecuteDisconnectPins(const TSharedRef<FJsonObject>& Params);
 	FMCPToolResult ExecuteSetPinValue(const TSharedRef<FJsonObject>& Params);
 
+	// Edit sessions (deferred compile)
+	FMCPToolResult ExecuteBeginEdit(const TSharedRef<FJsonObject>& Params);
+	FMCPToolResult ExecuteCommitEdit(const TSharedRef<FJsonObject>& Params);
+	FMCPToolResult ExecuteAbortEdit(const TSharedRef<FJsonObject>& Params);
+
 	// Helpers
 	EBlueprintType ParseBlueprintType(const FString& TypeString);
 
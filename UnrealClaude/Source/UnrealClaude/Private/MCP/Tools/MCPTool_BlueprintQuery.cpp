@@ -3,6 +3,9 @@
 #include "MCPTool_BlueprintQuery.h"
 #include "BlueprintUtils.h"
 #include "MCP/MCPParamValidator.h"
+#include "MCP/MCPCursorStore.h"
+#include "MCP/MCPBlueprintSerializationCache.h"
+#include "BlueprintGraphText.h"
 #include "UnrealClaudeModule.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Engine/Blueprint.h"
@@ -36,6 +39,11 @@ FMCPToolResult FMCPTool_BlueprintQuery::Execute(const TSharedRef<FJsonObject>& P
 		TEXT("Unknown operation: '%s'. Valid operations: 'list', 'inspect', 'get_graph'"), *Operation));
 }
 
+void FMCPTool_BlueprintQuery::GetRequiredAssets(const TSharedRef<FJsonObject>& Params, TArray<FSoftObjectPath>& OutAssets) const
+{
+	AddRequiredAssetParam(Params, TEXT("blueprint_path"), OutAssets);
+}
+
 FMCPToolResult FMCPTool_BlueprintQuery::ExecuteList(const TSharedRef<FJsonObject>& Params)
 {
 	// Extract filters
@@ -47,6 +55,17 @@ FMCPToolResult FMCPTool_BlueprintQuery::ExecuteList(const TSharedRef<FJsonObject
 	// Clamp limit
 	Limit = FMath::Clamp(Limit, 1, 1000);
 
+	// Query AssetRegistry
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+	// Continue an earlier listing from its snapshot
+	const FString Cursor = ExtractOptionalString(Params, TEXT("cursor"));
+	if (!Cursor.IsEmpty())
+	{
+		return ExecuteListFromCursor(AssetRegistry, Cursor, Limit);
+	}
+
 	// Validate path filter
 	FString ValidationError;
 	if (!PathFilter.IsEmpty() && !FMCPParamValidator::ValidateBlueprintPath(PathFilter, ValidationError))
@@ -54,9 +73,11 @@ FMCPToolResult FMCPTool_BlueprintQuery::ExecuteList(const TSharedRef<FJsonObject
 		return FMCPToolResult::Error(ValidationError);
 	}
 
-	// Query AssetRegistry
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+	FMCPFieldSet Fields;
+	if (!FMCPFieldSet::Parse(Params, GetListFieldNames(), Fields, ValidationError))
+	{
+		return FMCPToolResult::Error(ValidationError);
+	}
 
 	// Build filter
 	FARFilter Filter;
@@ -75,22 +96,20 @@ FMCPToolResult FMCPTool_BlueprintQuery::ExecuteList(const TSharedRef<FJsonObject
 
 	// Process results
 	TArray<TSharedPtr<FJsonValue>> ResultsArray;
-	int32 Count = 0;
-	int32 TotalMatching = 0;
+	TArray<FString> MatchingPaths;
 
 	for (const FAssetData& AssetData : AssetDataList)
 	{
-		// Get parent class name for filtering
-		FString ParentClassName;
-		FAssetDataTagMapSharedView::FFindTagResult ParentClassTag = AssetData.TagsAndValues.FindTag(FName("ParentClass"));
-		if (ParentClassTag.IsSet())
-		{
-			ParentClassName = ParentClassTag.GetValue();
-		}
-
 		// Apply type filter
 		if (!TypeFilter.IsEmpty())
 		{
+			FString ParentClassName;
+			FAssetDataTagMapSharedView::FFindTagResult ParentClassTag = AssetData.TagsAndValues.FindTag(FName("ParentClass"));
+			if (ParentClassTag.IsSet())
+			{
+				ParentClassName = ParentClassTag.GetValue();
+			}
+
 			if (!ParentClassName.Contains(TypeFilter, ESearchCase::IgnoreCase))
 			{
 				continue;
@@ -106,32 +125,133 @@ FMCPToolResult FMCPTool_BlueprintQuery::ExecuteList(const TSharedRef<FJsonObject
 			}
 		}
 
-		TotalMatching++;
+		MatchingPaths.Add(AssetData.GetObjectPathString());
 
 		// Check limit
-		if (Count >= Limit)
+		if (ResultsArray.Num() < Limit)
+		{
+			ResultsArray.Add(MakeShared<FJsonValueObject>(BlueprintAssetToJson(AssetData, Fields)));
+		}
+	}
+
+	const int32 Count = ResultsArray.Num();
+	const int32 TotalMatching = MatchingPaths.Num();
+
+	// Build response
+	TSharedPtr<FJsonObject> ResponseData = MakeShared<FJsonObject>();
+	ResponseData->SetArrayField(TEXT("blueprints"), ResultsArray);
+	ResponseData->SetNumberField(TEXT("count"), Count);
+	ResponseData->SetNumberField(TEXT("total_matching"), TotalMatching);
+
+	if (TotalMatching > Count)
+	{
+		ResponseData->SetBoolField(TEXT("truncated"), true);
+
+		// Snapshot the matching paths so later pages skip the registry query
+		TSharedPtr<FJsonObject> Options = MakeShared<FJsonObject>();
+		if (!Fields.IsAll())
+		{
+			Options->SetArrayField(TEXT("fields"), StringArrayToJsonArray(Fields.GetNames()));
+		}
+		ResponseData->SetStringField(TEXT("next_cursor"),
+			FMCPCursorStore::Get().CreateCursor(TEXT("blueprint_query.list"), MoveTemp(MatchingPaths), Count, Options));
+	}
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Found %d Blueprints (showing %d)"), TotalMatching, Count),
+		ResponseData
+	);
+}
+
+FMCPToolResult FMCPTool_BlueprintQuery::ExecuteListFromCursor(IAssetRegistry& AssetRegistry, const FString& Cursor, int32 Limit)
+{
+	FMCPCursorPage Page;
+	FString CursorError;
+	if (!FMCPCursorStore::Get().ReadPage(Cursor, TEXT("blueprint_query.list"), Limit, Page, CursorError))
+	{
+		return FMCPToolResult::Error(CursorError);
+	}
+
+	TArray<FString> FieldNames;
+	const FMCPFieldSet Fields = Page.Options.IsValid() && Page.Options->TryGetStringArrayField(TEXT("fields"), FieldNames)
+		? FMCPFieldSet(FieldNames)
+		: FMCPFieldSet();
+
+	// Blueprints deleted since the snapshot are skipped rather than shifting later pages
+	TArray<TSharedPtr<FJsonValue>> ResultsArray;
+	int32 MissingCount = 0;
+	for (const FString& BlueprintPath : Page.Ids)
+	{
+		const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(BlueprintPath));
+		if (!AssetData.IsValid())
 		{
+			MissingCount++;
 			continue;
 		}
+		ResultsArray.Add(MakeShared<FJsonValueObject>(BlueprintAssetToJson(AssetData, Fields)));
+	}
+
+	TSharedPtr<FJsonObject> ResponseData = MakeShared<FJsonObject>();
+	ResponseData->SetArrayField(TEXT("blueprints"), ResultsArray);
+	ResponseData->SetNumberField(TEXT("count"), ResultsArray.Num());
+	ResponseData->SetNumberField(TEXT("total_matching"), Page.Total);
+	ResponseData->SetNumberField(TEXT("offset"), Page.Offset);
 
-		// Get Blueprint type
+	if (!Page.NextCursor.IsEmpty())
+	{
+		ResponseData->SetBoolField(TEXT("truncated"), true);
+		ResponseData->SetStringField(TEXT("next_cursor"), Page.NextCursor);
+	}
+	if (MissingCount > 0)
+	{
+		ResponseData->SetNumberField(TEXT("missing"), MissingCount);
+	}
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Found %d Blueprints (showing %d-%d)"),
+			Page.Total, Page.Offset + 1, Page.Offset + Page.Ids.Num()),
+		ResponseData
+	);
+}
+
+const TArray<const TCHAR*>& FMCPTool_BlueprintQuery::GetListFieldNames()
+{
+	static const TArray<const TCHAR*> Names = { TEXT("name"), TEXT("path"), TEXT("blueprint_type"), TEXT("parent_class") };
+	return Names;
+}
+
+TSharedPtr<FJsonObject> FMCPTool_BlueprintQuery::BlueprintAssetToJson(const FAssetData& AssetData, const FMCPFieldSet& Fields) const
+{
+	// Build result object
+	TSharedPtr<FJsonObject> BPJson = MakeShared<FJsonObject>();
+	if (Fields.Has(TEXT("name")))
+	{
+		BPJson->SetStringField(TEXT("name"), AssetData.AssetName.ToString());
+	}
+	if (Fields.Has(TEXT("path")))
+	{
+		BPJson->SetStringField(TEXT("path"), AssetData.GetObjectPathString());
+	}
+
+	// Get Blueprint type
+	if (Fields.Has(TEXT("blueprint_type")))
+	{
 		FString BlueprintType = TEXT("Normal");
 		FAssetDataTagMapSharedView::FFindTagResult TypeTag = AssetData.TagsAndValues.FindTag(FName("BlueprintType"));
 		if (TypeTag.IsSet())
 		{
 			BlueprintType = TypeTag.GetValue();
 		}
-
-		// Build result object
-		TSharedPtr<FJsonObject> BPJson = MakeShared<FJsonObject>();
-		BPJson->SetStringField(TEXT("name"), AssetData.AssetName.ToString());
-		BPJson->SetStringField(TEXT("path"), AssetData.GetObjectPathString());
 		BPJson->SetStringField(TEXT("blueprint_type"), BlueprintType);
+	}
 
-		// Clean up parent class name (remove prefix)
-		if (!ParentClassName.IsEmpty())
+	// Clean up parent class name (remove prefix)
+	if (Fields.Has(TEXT("parent_class")))
+	{
+		FAssetDataTagMapSharedView::FFindTagResult ParentClassTag = AssetData.TagsAndValues.FindTag(FName("ParentClass"));
+		if (ParentClassTag.IsSet() && !ParentClassTag.GetValue().IsEmpty())
 		{
-			FString CleanParentName = ParentClassName;
+			FString CleanParentName = ParentClassTag.GetValue();
 			int32 LastDotIndex;
 			if (CleanParentName.FindLastChar(TEXT('.'), LastDotIndex))
 			{
@@ -144,26 +264,9 @@ FMCPToolResult FMCPTool_BlueprintQuery::ExecuteList(const TSharedRef<FJsonObject
 			}
 			BPJson->SetStringField(TEXT("parent_class"), CleanParentName);
 		}
-
-		ResultsArray.Add(MakeShared<FJsonValueObject>(BPJson));
-		Count++;
 	}
 
-	// Build response
-	TSharedPtr<FJsonObject> ResponseData = MakeShared<FJsonObject>();
-	ResponseData->SetArrayField(TEXT("blueprints"), ResultsArray);
-	ResponseData->SetNumberField(TEXT("count"), Count);
-	ResponseData->SetNumberField(TEXT("total_matching"), TotalMatching);
-
-	if (TotalMatching > Count)
-	{
-		ResponseData->SetBoolField(TEXT("truncated"), true);
-	}
-
-	return FMCPToolResult::Success(
-		FString::Printf(TEXT("Found %d Blueprints (showing %d)"), TotalMatching, Count),
-		ResponseData
-	);
+	return BPJson;
 }
 
 FMCPToolResult FMCPTool_BlueprintQuery::ExecuteInspect(const TSharedRef<FJsonObject>& Params)
@@ -183,6 +286,12 @@ FMCPToolResult FMCPTool_BlueprintQuery::ExecuteInspect(const TSharedRef<FJsonObj
 		return FMCPToolResult::Error(ValidationError);
 	}
 
+	FMCPFieldSet Fields;
+	if (!FMCPFieldSet::Parse(Params, FBlueprintUtils::GetBlueprintInfoFieldNames(), Fields, ValidationError))
+	{
+		return FMCPToolResult::Error(ValidationError);
+	}
+
 	// Load Blueprint
 	FString LoadError;
 	UBlueprint* Blueprint = FBlueprintUtils::LoadBlueprint(BlueprintPath, LoadError);
@@ -196,18 +305,29 @@ FMCPToolResult FMCPTool_BlueprintQuery::ExecuteInspect(const TSharedRef<FJsonObj
 	bool bIncludeFunctions = ExtractOptionalBool(Params, TEXT("include_functions"), false);
 	bool bIncludeGraphs = ExtractOptionalBool(Params, TEXT("include_graphs"), false);
 
-	// Serialize Blueprint info
-	TSharedPtr<FJsonObject> BlueprintInfo = FBlueprintUtils::SerializeBlueprintInfo(
-		Blueprint,
-		bIncludeVariables,
-		bIncludeFunctions,
-		bIncludeGraphs
-	);
+	// Serialize Blueprint info (an explicit field list overrides the include_* flags)
+	FString CacheKey;
+	if (Fields.IsAll())
+	{
+		CacheKey = FString::Printf(TEXT("inspect:%d%d%d"), bIncludeVariables ? 1 : 0, bIncludeFunctions ? 1 : 0, bIncludeGraphs ? 1 : 0);
+	}
+	else
+	{
+		TArray<FString> FieldNames = Fields.GetNames();
+		for (FString& Name : FieldNames)
+		{
+			Name.ToLowerInline();
+		}
+		FieldNames.Sort();
+		CacheKey = TEXT("inspect:") + FString::Join(FieldNames, TEXT(","));
+	}
 
-	return FMCPToolResult::Success(
-		FString::Printf(TEXT("Blueprint info for: %s"), *Blueprint->GetName()),
-		BlueprintInfo
-	);
+	return MakeCachedResult(Blueprint, CacheKey, [&]()
+	{
+		return Fields.IsAll()
+			? FBlueprintUtils::SerializeBlueprintInfo(Blueprint, bIncludeVariables, bIncludeFunctions, bIncludeGraphs)
+			: FBlueprintUtils::SerializeBlueprintInfo(Blueprint, Fields);
+	}, Params, FString::Printf(TEXT("Blueprint info for: %s"), *Blueprint->GetName()));
 }
 
 FMCPToolResult FMCPTool_BlueprintQuery::ExecuteGetGraph(const TSharedRef<FJsonObject>& Params)
@@ -235,15 +355,106 @@ FMCPToolResult FMCPTool_BlueprintQuery::ExecuteGetGraph(const TSharedRef<FJsonOb
 		return FMCPToolResult::Error(LoadError);
 	}
 
-	// Get graph info
-	TSharedPtr<FJsonObject> GraphInfo = FBlueprintUtils::GetGraphInfo(Blueprint);
+	const FString Format = ExtractOptionalString(Params, TEXT("format"), TEXT("summary")).ToLower();
+	if (Format == TEXT("compact"))
+	{
+		const FString GraphName = ExtractOptionalString(Params, TEXT("graph_name"));
 
-	// Add Blueprint name for context
-	GraphInfo->SetStringField(TEXT("blueprint_name"), Blueprint->GetName());
-	GraphInfo->SetStringField(TEXT("blueprint_path"), Blueprint->GetPathName());
+		TArray<UEdGraph*> Graphs;
+		if (GraphName.IsEmpty())
+		{
+			Graphs.Append(Blueprint->UbergraphPages);
+			Graphs.Append(Blueprint->FunctionGraphs);
+		}
+		else
+		{
+			TArray<UEdGraph*> AllGraphs;
+			Blueprint->GetAllGraphs(AllGraphs);
+			UEdGraph* const* Found = AllGraphs.FindByPredicate([&GraphName](const UEdGraph* Graph)
+			{
+				return Graph && Graph->GetName().Equals(GraphName, ESearchCase::IgnoreCase);
+			});
+			if (!Found)
+			{
+				return FMCPToolResult::Error(FString::Printf(TEXT("Graph '%s' not found in %s"), *GraphName, *Blueprint->GetName()));
+			}
+			Graphs.Add(*Found);
+		}
 
-	return FMCPToolResult::Success(
-		FString::Printf(TEXT("Graph info for: %s"), *Blueprint->GetName()),
-		GraphInfo
-	);
+		return MakeCachedResult(Blueprint, TEXT("get_graph:compact:") + GraphName.ToLower(), [Blueprint, &Graphs]()
+		{
+			int32 NodeCount = 0;
+			FString Text;
+			for (UEdGraph* Graph : Graphs)
+			{
+				Text += FBlueprintGraphText::SerializeGraph(Graph, NodeCount);
+			}
+
+			TSharedPtr<FJsonObject> GraphText = MakeShared<FJsonObject>();
+			GraphText->SetStringField(TEXT("blueprint_name"), Blueprint->GetName());
+			GraphText->SetStringField(TEXT("blueprint_path"), Blueprint->GetPathName());
+			GraphText->SetStringField(TEXT("format"), TEXT("compact"));
+			GraphText->SetNumberField(TEXT("node_count"), NodeCount);
+			GraphText->SetStringField(TEXT("graph"), Text);
+			return GraphText;
+		}, Params, FString::Printf(TEXT("Compact graph for: %s"), *Blueprint->GetName()));
+	}
+	if (Format != TEXT("summary"))
+	{
+		return FMCPToolResult::Error(FString::Printf(TEXT("Unknown format '%s'. Valid: summary, compact"), *Format));
+	}
+
+	return MakeCachedResult(Blueprint, TEXT("get_graph"), [Blueprint]()
+	{
+		TSharedPtr<FJsonObject> GraphInfo = FBlueprintUtils::GetGraphInfo(Blueprint);
+
+		// Add Blueprint name for context
+		GraphInfo->SetStringField(TEXT("blueprint_name"), Blueprint->GetName());
+		GraphInfo->SetStringField(TEXT("blueprint_path"), Blueprint->GetPathName());
+		return GraphInfo;
+	}, Params, FString::Printf(TEXT("Graph info for: %s"), *Blueprint->GetName()));
+}
+
+FMCPToolResult FMCPTool_BlueprintQuery::MakeCachedResult(UBlueprint* Blueprint, const FString& CacheKey,
+	TFunctionRef<TSharedPtr<FJsonObject>()> Build, const TSharedRef<FJsonObject>& Params, const FString& Message) const
+{
+	FMCPBlueprintSerializationCache& Cache = FMCPBlueprintSerializationCache::Get();
+
+	uint64 Version = 0;
+	TSharedPtr<FJsonObject> Cached = Cache.FindOrBuild(Blueprint, CacheKey, Build, Version);
+
+	// Version 0 means caching is off; always return the full result then
+	double SinceVersionValue = 0.0;
+	if (Version != 0 && Params->TryGetNumberField(TEXT("since_version"), SinceVersionValue) && SinceVersionValue > 0.0)
+	{
+		const uint64 SinceVersion = static_cast<uint64>(SinceVersionValue);
+		if (SinceVersion == Version)
+		{
+			TSharedPtr<FJsonObject> Unchanged = MakeShared<FJsonObject>();
+			Unchanged->SetBoolField(TEXT("unchanged"), true);
+			Unchanged->SetNumberField(TEXT("version"), static_cast<double>(Version));
+			return FMCPToolResult::Success(Message + TEXT(" (unchanged)"), Unchanged);
+		}
+
+		if (TSharedPtr<FJsonObject> Previous = Cache.FindPrevious(Blueprint, CacheKey, SinceVersion))
+		{
+			TSharedPtr<FJsonObject> DiffResult = MakeShared<FJsonObject>();
+			DiffResult->SetNumberField(TEXT("version"), static_cast<double>(Version));
+			DiffResult->SetNumberField(TEXT("since_version"), static_cast<double>(SinceVersion));
+			DiffResult->SetObjectField(TEXT("diff"), FMCPBlueprintSerializationCache::Diff(Previous, Cached));
+			return FMCPToolResult::Success(Message + TEXT(" (changes only)"), DiffResult);
+		}
+	}
+
+	// Shallow copy: the cached object is shared and must not pick up fields added downstream
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	if (Cached.IsValid())
+	{
+		Result->Values = Cached->Values;
+	}
+	if (Version != 0)
+	{
+		Result->SetNumberField(TEXT("version"), static_cast<double>(Version));
+	}
+	return FMCPToolResult::Success(Message, Result);
 }
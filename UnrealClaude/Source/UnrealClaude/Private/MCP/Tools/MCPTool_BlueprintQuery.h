@@ -5,13 +5,21 @@
 #include "CoreMinimal.h"
 #include "MCP/MCPToolBase.h"
 
+class IAssetRegistry;
+class UBlueprint;
+struct FAssetData;
+
 /**
  * MCP Tool: Query Blueprint information (read-only operations)
  *
  * Operations:
  *   - list: List all Blueprints in project (with optional filters)
  *   - inspect: Get detailed Blueprint info (variables, functions, parent class)
- *   - get_graph: Get graph information (node count, events)
+ *   - get_graph: Get graph information (node count, events), or every node in
+ *     compact text form (FBlueprintGraphText)
+ *
+ * inspect and get_graph are served from FMCPBlueprintSerializationCache, so
+ * repeated queries between edits do not re-walk the Blueprint.
  */
 class FMCPTool_BlueprintQuery : public FMCPToolBase
 {
@@ -26,7 +34,15 @@ public:
 			"- 'list': Find Blueprints in project with optional filters\n"
 			"- 'inspect': Get detailed Blueprint info (variables, functions, parent class)\n"
 			"- 'get_graph': Get graph structure (node count, events, connections)\n\n"
-			"Use 'list' first to discover Blueprints, then 'inspect' or 'get_graph' for details.\n\n"
+			"get_graph with format='compact' lists every node as one line of text (type, params, position, "
+			"non-default pin values and links as 'Pin->n3.Pin', node ID as a trailing comment), a fraction of "
+			"the size of JSON. Output for one graph (set graph_name) can be passed to blueprint_modify add_nodes "
+			"as 'text'; output covering several graphs is rejected there.\n\n"
+			"Use 'list' first to discover Blueprints, then 'inspect' or 'get_graph' for details. "
+			"When 'list' is truncated, pass the returned next_cursor back as 'cursor' for the next page.\n\n"
+			"'inspect' and 'get_graph' results include a 'version' that changes whenever the Blueprint does. "
+			"Pass it back as 'since_version' to get {unchanged: true} if nothing changed, or only a 'diff' "
+			"against the result you already have.\n\n"
 			"Example paths:\n"
 			"- '/Game/Blueprints/BP_Character'\n"
 			"- '/Game/UI/WBP_MainMenu'\n"
@@ -44,28 +60,57 @@ public:
 				TEXT("Name substring filter"), false),
 			FMCPToolParameter(TEXT("limit"), TEXT("number"),
 				TEXT("Maximum results to return (1-1000, default: 25)"), false, TEXT("25")),
+			FMCPToolParameter(TEXT("cursor"), TEXT("string"),
+				TEXT("next_cursor from a previous 'list' page; filters are taken from the original query"), false),
 			FMCPToolParameter(TEXT("blueprint_path"), TEXT("string"),
 				TEXT("Full Blueprint asset path (required for inspect/get_graph)"), false),
+			FMCPToolParameter(TEXT("fields"), TEXT("array"),
+				TEXT("Fields to return. list: name, path, blueprint_type, parent_class. inspect (overrides include_*): "
+					"name, path, blueprint_type, parent_class, parent_class_name, generated_class, variables, functions, graph_info"), false),
 			FMCPToolParameter(TEXT("include_variables"), TEXT("boolean"),
 				TEXT("Include variable list in inspect result (default: false)"), false, TEXT("false")),
 			FMCPToolParameter(TEXT("include_functions"), TEXT("boolean"),
 				TEXT("Include function list in inspect result (default: false)"), false, TEXT("false")),
 			FMCPToolParameter(TEXT("include_graphs"), TEXT("boolean"),
-				TEXT("Include graph info in inspect result"), false, TEXT("false"))
+				TEXT("Include graph info in inspect result"), false, TEXT("false")),
+			FMCPToolParameter(TEXT("format"), TEXT("string"),
+				TEXT("get_graph: 'summary' (counts) or 'compact' (one line per node)"), false, TEXT("summary")),
+			FMCPToolParameter(TEXT("graph_name"), TEXT("string"),
+				TEXT("get_graph compact: only this graph (default: event graphs and function graphs)"), false),
+			FMCPToolParameter(TEXT("since_version"), TEXT("number"),
+				TEXT("inspect/get_graph: 'version' from an earlier identical query; returns only what changed since"), false)
 		};
 		Info.Annotations = FMCPToolAnnotations::ReadOnly();
 		return Info;
 	}
 
 	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+	virtual void GetRequiredAssets(const TSharedRef<FJsonObject>& Params, TArray<FSoftObjectPath>& OutAssets) const override;
+	virtual bool HasRequiredAssets() const override { return true; }
 
 private:
 	/** List Blueprints matching filters */
 	FMCPToolResult ExecuteList(const TSharedRef<FJsonObject>& Params);
 
+	/** Serve a 'list' page from a cursor snapshot */
+	FMCPToolResult ExecuteListFromCursor(IAssetRegistry& AssetRegistry, const FString& Cursor, int32 Limit);
+
+	/** Field names understood by BlueprintAssetToJson */
+	static const TArray<const TCHAR*>& GetListFieldNames();
+
+	/** Convert a Blueprint's registry entry to its list JSON */
+	TSharedPtr<FJsonObject> BlueprintAssetToJson(const FAssetData& AssetData, const FMCPFieldSet& Fields) const;
+
 	/** Get detailed Blueprint info */
 	FMCPToolResult ExecuteInspect(const TSharedRef<FJsonObject>& Params);
 
 	/** Get graph information */
 	FMCPToolResult ExecuteGetGraph(const TSharedRef<FJsonObject>& Params);
+
+	/**
+	 * Serve inspect/get_graph through the serialization cache
+	 * Returns the full result, {unchanged} or a diff depending on since_version.
+	 */
+	FMCPToolResult MakeCachedResult(UBlueprint* Blueprint, const FString& CacheKey,
+		TFunctionRef<TSharedPtr<FJsonObject>()> Build, const TSharedRef<FJsonObject>& Params, const FString& Message) const;
 };
@@ -1,6 +1,8 @@
 // Copyright Natali Caggiano. All Rights Reserved.
 
 #include "MCPTool_Character.h"
+#include "MCP/MCPActorIndex.h"
+#include "MCP/MCPCursorStore.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Components/SkeletalMeshComponent.h"
@@ -57,10 +59,14 @@ FMCPToolResult FMCPTool_Character::ExecuteListCharacters(const TSharedRef<FJsonO
 	int32 Limit = FMath::Clamp(ExtractOptionalNumber<int32>(Params, TEXT("limit"), 100), 1, 1000);
 	int32 Offset = FMath::Max(0, ExtractOptionalNumber<int32>(Params, TEXT("offset"), 0));
 
-	TArray<TSharedPtr<FJsonValue>> CharacterArray;
-	int32 TotalCount = 0;
-	int32 SkippedCount = 0;
+	// Continue an earlier listing from its snapshot
+	const FString Cursor = ExtractOptionalString(Params, TEXT("cursor"));
+	if (!Cursor.IsEmpty())
+	{
+		return ExecuteListCharactersFromCursor(World, Cursor, Limit);
+	}
 
+	TArray<ACharacter*> MatchingCharacters;
 	for (TActorIterator<ACharacter> It(World); It; ++It)
 	{
 		ACharacter* Character = *It;
@@ -79,33 +85,87 @@ FMCPToolResult FMCPTool_Character::ExecuteListCharacters(const TSharedRef<FJsonO
 			}
 		}
 
-		TotalCount++;
+		MatchingCharacters.Add(Character);
+	}
+
+	// Apply pagination
+	const int32 TotalCount = MatchingCharacters.Num();
+	const int32 StartIndex = FMath::Min(Offset, TotalCount);
+	const int32 EndIndex = FMath::Min(StartIndex + Limit, TotalCount);
+
+	TArray<TSharedPtr<FJsonValue>> CharacterArray;
+	for (int32 i = StartIndex; i < EndIndex; ++i)
+	{
+		CharacterArray.Add(MakeShared<FJsonValueObject>(CharacterToJson(MatchingCharacters[i])));
+	}
 
-		// Apply pagination
-		if (SkippedCount < Offset)
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetArrayField(TEXT("characters"), CharacterArray);
+	ResultData->SetNumberField(TEXT("count"), CharacterArray.Num());
+	ResultData->SetNumberField(TEXT("total"), TotalCount);
+	ResultData->SetNumberField(TEXT("offset"), Offset);
+	ResultData->SetNumberField(TEXT("limit"), Limit);
+
+	if (EndIndex < TotalCount)
+	{
+		// Snapshot the matches so later pages skip the world scan
+		TArray<FString> CharacterPaths;
+		CharacterPaths.Reserve(TotalCount);
+		for (const ACharacter* Character : MatchingCharacters)
 		{
-			SkippedCount++;
-			continue;
+			CharacterPaths.Add(Character->GetPathName());
 		}
+		ResultData->SetStringField(TEXT("next_cursor"),
+			FMCPCursorStore::Get().CreateCursor(TEXT("character.list_characters"), MoveTemp(CharacterPaths), EndIndex));
+	}
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Found %d characters (showing %d-%d of %d)"),
+			TotalCount, Offset + 1, Offset + CharacterArray.Num(), TotalCount),
+		ResultData);
+}
+
+FMCPToolResult FMCPTool_Character::ExecuteListCharactersFromCursor(UWorld* World, const FString& Cursor, int32 Limit)
+{
+	FMCPCursorPage Page;
+	FString CursorError;
+	if (!FMCPCursorStore::Get().ReadPage(Cursor, TEXT("character.list_characters"), Limit, Page, CursorError))
+	{
+		return FMCPToolResult::Error(CursorError);
+	}
 
-		if (CharacterArray.Num() >= Limit)
+	// Characters deleted since the snapshot are skipped rather than shifting later pages
+	TArray<TSharedPtr<FJsonValue>> CharacterArray;
+	int32 MissingCount = 0;
+	for (const FString& CharacterPath : Page.Ids)
+	{
+		ACharacter* Character = FindObject<ACharacter>(nullptr, *CharacterPath);
+		if (!IsValid(Character) || Character->GetWorld() != World)
 		{
-			continue; // Still count but don't add
+			MissingCount++;
+			continue;
 		}
-
 		CharacterArray.Add(MakeShared<FJsonValueObject>(CharacterToJson(Character)));
 	}
 
 	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
 	ResultData->SetArrayField(TEXT("characters"), CharacterArray);
 	ResultData->SetNumberField(TEXT("count"), CharacterArray.Num());
-	ResultData->SetNumberField(TEXT("total"), TotalCount);
-	ResultData->SetNumberField(TEXT("offset"), Offset);
+	ResultData->SetNumberField(TEXT("total"), Page.Total);
+	ResultData->SetNumberField(TEXT("offset"), Page.Offset);
 	ResultData->SetNumberField(TEXT("limit"), Limit);
+	if (!Page.NextCursor.IsEmpty())
+	{
+		ResultData->SetStringField(TEXT("next_cursor"), Page.NextCursor);
+	}
+	if (MissingCount > 0)
+	{
+		ResultData->SetNumberField(TEXT("missing"), MissingCount);
+	}
 
 	return FMCPToolResult::Success(
 		FString::Printf(TEXT("Found %d characters (showing %d-%d of %d)"),
-			TotalCount, Offset + 1, Offset + CharacterArray.Num(), TotalCount),
+			Page.Total, Page.Offset + 1, Page.Offset + Page.Ids.Num(), Page.Total),
 		ResultData);
 }
 
@@ -389,16 +449,9 @@ ACharacter* FMCPTool_Character::FindCharacterByName(UWorld* World, const FString
 		return nullptr;
 	}
 
-	for (TActorIterator<ACharacter> It(World); It; ++It)
+	if (AActor* Actor = FMCPActorIndex::Get().FindActor(World, NameOrLabel, ACharacter::StaticClass()))
 	{
-		ACharacter* Character = *It;
-		if (IsValid(Character))
-		{
-			if (Character->GetName() == NameOrLabel || Character->GetActorLabel() == NameOrLabel)
-			{
-				return Character;
-			}
-		}
+		return CastChecked<ACharacter>(Actor);
 	}
 
 	OutError = FString::Printf(TEXT("Character not found: %s"), *NameOrLabel);
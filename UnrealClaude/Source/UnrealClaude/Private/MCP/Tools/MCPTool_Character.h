@@ -64,6 +64,8 @@ public:
 				TEXT("Max results to return (default: 100)"), false, TEXT("100")),
 			FMCPToolParameter(TEXT("offset"), TEXT("number"),
 				TEXT("Skip first N results (default: 0)"), false, TEXT("0")),
+			FMCPToolParameter(TEXT("cursor"), TEXT("string"),
+				TEXT("next_cursor from a previous list_characters page"), false),
 
 			// Movement parameter modifications
 			FMCPToolParameter(TEXT("max_walk_speed"), TEXT("number"),
@@ -105,6 +107,7 @@ private:
 	FMCPToolResult ExecuteGetMovementParams(const TSharedRef<FJsonObject>& Params);
 	FMCPToolResult ExecuteSetMovementParams(const TSharedRef<FJsonObject>& Params);
 	FMCPToolResult ExecuteGetComponents(const TSharedRef<FJsonObject>& Params);
+	FMCPToolResult ExecuteListCharactersFromCursor(UWorld* World, const FString& Cursor, int32 Limit);
 
 	// Helper methods
 	ACharacter* FindCharacterByName(UWorld* World, const FString& NameOrLabel, FString& OutError);
@@ -1,6 +1,8 @@
 // Copyright Natali Caggiano. All Rights Reserved.
 
 #include "MCPTool_CharacterData.h"
+#include "MCP/MCPActorIndex.h"
+#include "MCP/MCPPackageSaver.h"
 #include "CharacterDataTypes.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -8,9 +10,56 @@
 #include "Components/CapsuleComponent.h"
 #include "Engine/DataTable.h"
 #include "AssetRegistry/AssetRegistryModule.h"
-#include "UObject/SavePackage.h"
 #include "Engine/World.h"
-#include "EngineUtils.h"
+
+namespace
+{
+	/** Searchable fields of a character config */
+	struct FConfigSearchFields
+	{
+		FString ConfigId;
+		FString DisplayName;
+		TArray<FString> GameplayTags;
+		bool bIsPlayerCharacter = false;
+
+		/** Read from the loaded asset rather than registry tags */
+		bool bFromAsset = false;
+	};
+
+	/** Read the fields from registry tags; false for configs saved before the tags were added */
+	bool ReadSearchFieldsFromTags(const FAssetData& AssetData, FConfigSearchFields& OutFields)
+	{
+		if (!AssetData.GetTagValue(UCharacterConfigDataAsset::ConfigIdTag, OutFields.ConfigId))
+		{
+			return false;
+		}
+		AssetData.GetTagValue(UCharacterConfigDataAsset::DisplayNameTag, OutFields.DisplayName);
+
+		FString TagsValue;
+		if (AssetData.GetTagValue(UCharacterConfigDataAsset::GameplayTagsTag, TagsValue))
+		{
+			TagsValue.ParseIntoArray(OutFields.GameplayTags, UCharacterConfigDataAsset::GameplayTagsSeparator, true);
+		}
+
+		FString IsPlayerValue;
+		OutFields.bIsPlayerCharacter = AssetData.GetTagValue(UCharacterConfigDataAsset::IsPlayerCharacterTag, IsPlayerValue)
+			&& IsPlayerValue.ToBool();
+		return true;
+	}
+
+	void ReadSearchFieldsFromAsset(const UCharacterConfigDataAsset* Config, FConfigSearchFields& OutFields)
+	{
+		OutFields.ConfigId = Config->ConfigId.ToString();
+		OutFields.DisplayName = Config->DisplayName;
+		OutFields.GameplayTags.Reset(Config->GameplayTags.Num());
+		for (const FName& Tag : Config->GameplayTags)
+		{
+			OutFields.GameplayTags.Add(Tag.ToString());
+		}
+		OutFields.bIsPlayerCharacter = Config->bIsPlayerCharacter;
+		OutFields.bFromAsset = true;
+	}
+}
 
 FMCPToolResult FMCPTool_CharacterData::Execute(const TSharedRef<FJsonObject>& Params)
 {
@@ -72,6 +121,44 @@ FMCPToolResult FMCPTool_CharacterData::Execute(const TSharedRef<FJsonObject>& Pa
 		*Operation));
 }
 
+void FMCPTool_CharacterData::GetRequiredAssets(const TSharedRef<FJsonObject>& Params, TArray<FSoftObjectPath>& OutAssets) const
+{
+	AddRequiredAssetParam(Params, TEXT("asset_path"), OutAssets);
+	AddRequiredAssetParam(Params, TEXT("table_path"), OutAssets);
+
+	if (ExtractOptionalString(Params, TEXT("operation")) != TEXT("query_character_data"))
+	{
+		return;
+	}
+
+	// Mirrors ExecuteQueryCharacterData: only configs without registry tags are loaded,
+	// every name match when filtering by tag, otherwise just the returned page
+	const FString SearchName = ExtractOptionalString(Params, TEXT("search_name"));
+	const int32 Limit = FMath::Clamp(ExtractOptionalNumber<int32>(Params, TEXT("limit"), 25), 1, 1000);
+	const int32 Offset = FMath::Max(0, ExtractOptionalNumber<int32>(Params, TEXT("offset"), 0));
+	const TArray<TSharedPtr<FJsonValue>>* TagsArray = nullptr;
+	const bool bFilterByTags = Params->TryGetArrayField(TEXT("search_tags"), TagsArray) && TagsArray->Num() > 0;
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	TArray<FAssetData> AssetList;
+	AssetRegistry.GetAssetsByClass(UCharacterConfigDataAsset::StaticClass()->GetClassPathName(), AssetList);
+
+	int32 Matched = 0;
+	for (const FAssetData& AssetData : AssetList)
+	{
+		if (!SearchName.IsEmpty() && !AssetData.AssetName.ToString().Contains(SearchName))
+		{
+			continue;
+		}
+		const bool bHasTags = AssetData.FindTag(UCharacterConfigDataAsset::ConfigIdTag);
+		if (!bHasTags && (bFilterByTags || (Matched >= Offset && Matched < Offset + Limit)))
+		{
+			OutAssets.Add(AssetData.GetSoftObjectPath());
+		}
+		++Matched;
+	}
+}
+
 FMCPToolResult FMCPTool_CharacterData::ExecuteCreateCharacterData(const TSharedRef<FJsonObject>& Params)
 {
 	FString AssetName;
@@ -114,7 +201,7 @@ FMCPToolResult FMCPTool_CharacterData::ExecuteCreateCharacterData(const TSharedR
 	// Mark dirty and save
 	Package->MarkPackageDirty();
 	FString SaveError;
-	if (!SaveAsset(Config, SaveError))
+	if (!SaveAsset(Config, Params, SaveError))
 	{
 		return FMCPToolResult::Error(SaveError);
 	}
@@ -164,6 +251,8 @@ FMCPToolResult FMCPTool_CharacterData::ExecuteQueryCharacterData(const TSharedRe
 	int32 TotalMatches = 0;
 	int32 SkippedCount = 0;
 
+	int32 LoadedCount = 0;
+
 	for (const FAssetData& AssetData : AssetList)
 	{
 		// Filter by name if specified
@@ -176,35 +265,47 @@ FMCPToolResult FMCPTool_CharacterData::ExecuteQueryCharacterData(const TSharedRe
 			}
 		}
 
-		// Filter by tags if specified (requires loading asset)
+		// Searchable fields come from registry tags; only configs saved before
+		// the tags existed have to be loaded
+		FConfigSearchFields Fields;
+		const bool bHasTags = ReadSearchFieldsFromTags(AssetData, Fields);
+
+		// Filter by tags if specified
 		if (SearchTags.Num() > 0)
 		{
-			UCharacterConfigDataAsset* Config = Cast<UCharacterConfigDataAsset>(AssetData.GetAsset());
-			if (Config)
+			if (!bHasTags)
 			{
-				bool bHasAllTags = true;
-				for (const FString& SearchTag : SearchTags)
+				UCharacterConfigDataAsset* Config = Cast<UCharacterConfigDataAsset>(AssetData.GetAsset());
+				if (!Config)
 				{
-					bool bFound = false;
-					for (const FName& Tag : Config->GameplayTags)
-					{
-						if (Tag.ToString().Contains(SearchTag))
-						{
-							bFound = true;
-							break;
-						}
-					}
-					if (!bFound)
+					continue;
+				}
+				ReadSearchFieldsFromAsset(Config, Fields);
+				LoadedCount++;
+			}
+
+			bool bHasAllTags = true;
+			for (const FString& SearchTag : SearchTags)
+			{
+				bool bFound = false;
+				for (const FString& Tag : Fields.GameplayTags)
+				{
+					if (Tag.Contains(SearchTag))
 					{
-						bHasAllTags = false;
+						bFound = true;
 						break;
 					}
 				}
-				if (!bHasAllTags)
+				if (!bFound)
 				{
-					continue;
+					bHasAllTags = false;
+					break;
 				}
 			}
+			if (!bHasAllTags)
+			{
+				continue;
+			}
 		}
 
 		TotalMatches++;
@@ -226,12 +327,22 @@ FMCPToolResult FMCPTool_CharacterData::ExecuteQueryCharacterData(const TSharedRe
 		Entry->SetStringField(TEXT("asset_path"), AssetData.GetObjectPathString());
 		Entry->SetStringField(TEXT("asset_name"), AssetData.AssetName.ToString());
 
-		// Load to get details
-		if (UCharacterConfigDataAsset* Config = Cast<UCharacterConfigDataAsset>(AssetData.GetAsset()))
+		// Untagged configs not already loaded by the tag filter are loaded for their details
+		bool bHasDetails = bHasTags || Fields.bFromAsset;
+		if (!bHasDetails)
+		{
+			if (UCharacterConfigDataAsset* Config = Cast<UCharacterConfigDataAsset>(AssetData.GetAsset()))
+			{
+				ReadSearchFieldsFromAsset(Config, Fields);
+				LoadedCount++;
+				bHasDetails = true;
+			}
+		}
+		if (bHasDetails)
 		{
-			Entry->SetStringField(TEXT("config_id"), Config->ConfigId.ToString());
-			Entry->SetStringField(TEXT("display_name"), Config->DisplayName);
-			Entry->SetBoolField(TEXT("is_player_character"), Config->bIsPlayerCharacter);
+			Entry->SetStringField(TEXT("config_id"), Fields.ConfigId);
+			Entry->SetStringField(TEXT("display_name"), Fields.DisplayName);
+			Entry->SetBoolField(TEXT("is_player_character"), Fields.bIsPlayerCharacter);
 		}
 
 		ResultArray.Add(MakeShared<FJsonValueObject>(Entry));
@@ -243,6 +354,7 @@ FMCPToolResult FMCPTool_CharacterData::ExecuteQueryCharacterData(const TSharedRe
 	ResultData->SetNumberField(TEXT("total"), TotalMatches);
 	ResultData->SetNumberField(TEXT("offset"), Offset);
 	ResultData->SetNumberField(TEXT("limit"), Limit);
+	ResultData->SetNumberField(TEXT("assets_loaded"), LoadedCount);
 
 	return FMCPToolResult::Success(
 		FString::Printf(TEXT("Found %d character configs (showing %d-%d of %d)"),
@@ -296,7 +408,7 @@ FMCPToolResult FMCPTool_CharacterData::ExecuteUpdateCharacterData(const TSharedR
 
 	// Save
 	FString SaveError;
-	if (!SaveAsset(Config, SaveError))
+	if (!SaveAsset(Config, Params, SaveError))
 	{
 		return FMCPToolResult::Error(SaveError);
 	}
@@ -348,7 +460,7 @@ FMCPToolResult FMCPTool_CharacterData::ExecuteCreateStatsTable(const TSharedRef<
 
 	Package->MarkPackageDirty();
 	FString SaveError;
-	if (!SaveAsset(Table, SaveError))
+	if (!SaveAsset(Table, Params, SaveError))
 	{
 		return FMCPToolResult::Error(SaveError);
 	}
@@ -468,7 +580,7 @@ FMCPToolResult FMCPTool_CharacterData::ExecuteAddStatsRow(const TSharedRef<FJson
 	Table->MarkPackageDirty();
 
 	FString SaveError;
-	if (!SaveAsset(Table, SaveError))
+	if (!SaveAsset(Table, Params, SaveError))
 	{
 		return FMCPToolResult::Error(SaveError);
 	}
@@ -515,7 +627,7 @@ FMCPToolResult FMCPTool_CharacterData::ExecuteUpdateStatsRow(const TSharedRef<FJ
 
 	Table->MarkPackageDirty();
 	FString SaveError;
-	if (!SaveAsset(Table, SaveError))
+	if (!SaveAsset(Table, Params, SaveError))
 	{
 		return FMCPToolResult::Error(SaveError);
 	}
@@ -560,7 +672,7 @@ FMCPToolResult FMCPTool_CharacterData::ExecuteRemoveStatsRow(const TSharedRef<FJ
 	Table->MarkPackageDirty();
 
 	FString SaveError;
-	if (!SaveAsset(Table, SaveError))
+	if (!SaveAsset(Table, Params, SaveError))
 	{
 		return FMCPToolResult::Error(SaveError);
 	}
@@ -603,15 +715,8 @@ FMCPToolResult FMCPTool_CharacterData::ExecuteApplyCharacterData(const TSharedRe
 	}
 
 	// Find character
-	ACharacter* Character = nullptr;
-	for (TActorIterator<ACharacter> It(World); It; ++It)
-	{
-		if ((*It)->GetName() == CharacterName || (*It)->GetActorLabel() == CharacterName)
-		{
-			Character = *It;
-			break;
-		}
-	}
+	ACharacter* Character = Cast<ACharacter>(
+		FMCPActorIndex::Get().FindActor(World, CharacterName, ACharacter::StaticClass()));
 
 	if (!Character)
 	{
@@ -713,36 +818,19 @@ UDataTable* FMCPTool_CharacterData::LoadStatsTable(const FString& Path, FString&
 	return Table;
 }
 
-bool FMCPTool_CharacterData::SaveAsset(UObject* Asset, FString& OutError)
+bool FMCPTool_CharacterData::SaveAsset(UObject* Asset, const TSharedRef<FJsonObject>& Params, FString& OutError)
 {
-	if (!Asset)
-	{
-		OutError = TEXT("Cannot save null asset");
-		return false;
-	}
-
-	UPackage* Package = Asset->GetOutermost();
-	if (!Package)
+	if (!ExtractOptionalBool(Params, TEXT("save"), true))
 	{
-		OutError = TEXT("Asset has no package");
-		return false;
-	}
-
-	FString PackageFileName = FPackageName::LongPackageNameToFilename(
-		Package->GetName(), FPackageName::GetAssetPackageExtension());
-
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-
-	FSavePackageResultStruct Result = UPackage::Save(Package, Asset, *PackageFileName, SaveArgs);
-
-	if (Result.Result != ESavePackageResult::Success)
-	{
-		OutError = FString::Printf(TEXT("Failed to save asset: %s"), *PackageFileName);
-		return false;
+		// Left dirty for a batched save_assets call
+		if (Asset)
+		{
+			Asset->MarkPackageDirty();
+		}
+		return true;
 	}
 
-	return true;
+	return FMCPPackageSaver::SaveAsset(Asset, OutError);
 }
 
 TSharedPtr<FJsonObject> FMCPTool_CharacterData::ConfigToJson(UCharacterConfigDataAsset* Config)
@@ -63,6 +63,8 @@ public:
 			// Operation selector
 			FMCPToolParameter(TEXT("operation"), TEXT("string"),
 				TEXT("Operation to perform (see description)"), true),
+			FMCPToolParameter(TEXT("save"), TEXT("boolean"),
+				TEXT("Save modified assets immediately; false leaves them dirty for one save_assets call later (default: true)"), false, TEXT("true")),
 
 			// Asset paths
 			FMCPToolParameter(TEXT("package_path"), TEXT("string"),
@@ -175,6 +177,8 @@ public:
 	}
 
 	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+	virtual void GetRequiredAssets(const TSharedRef<FJsonObject>& Params, TArray<FSoftObjectPath>& OutAssets) const override;
+	virtual bool HasRequiredAssets() const override { return true; }
 
 private:
 	// DataAsset operations
@@ -196,7 +200,7 @@ private:
 	// Helper methods
 	UCharacterConfigDataAsset* LoadCharacterConfig(const FString& Path, FString& OutError);
 	UDataTable* LoadStatsTable(const FString& Path, FString& OutError);
-	bool SaveAsset(UObject* Asset, FString& OutError);
+	bool SaveAsset(UObject* Asset, const TSharedRef<FJsonObject>& Params, FString& OutError);
 
 	// JSON conversion
 	TSharedPtr<FJsonObject> ConfigToJson(UCharacterConfigDataAsset* Config);
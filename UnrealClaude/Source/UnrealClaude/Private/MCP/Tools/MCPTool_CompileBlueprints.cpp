@@ -0,0 +1,412 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTool_CompileBlueprints.h"
+#include "BlueprintLoader.h"
+#include "MCP/MCPParamValidator.h"
+#include "MCP/MCPBlueprintEditSession.h"
+#include "UnrealClaudeConstants.h"
+#include "UnrealClaudeModule.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "BlueprintCompilationManager.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Misc/PackageName.h"
+
+using namespace UnrealClaudeConstants::CompileBlueprints;
+
+namespace
+{
+	TSharedPtr<FJsonObject> MakeCompileResultJson(const FString& Path, const FBlueprintCompileResult& CompileResult)
+	{
+		TSharedPtr<FJsonObject> ResultJson = MakeShared<FJsonObject>();
+		ResultJson->SetStringField(TEXT("path"), Path);
+		ResultJson->SetStringField(TEXT("status"), CompileResult.StatusString);
+		ResultJson->SetNumberField(TEXT("errors"), CompileResult.ErrorCount);
+		ResultJson->SetNumberField(TEXT("warnings"), CompileResult.WarningCount);
+
+		if (CompileResult.Messages.Num() > 0)
+		{
+			TArray<TSharedPtr<FJsonValue>> MessagesArray;
+			for (const FBlueprintCompileMessage& Msg : CompileResult.Messages)
+			{
+				if (MessagesArray.Num() >= MaxMessagesPerBlueprint)
+				{
+					ResultJson->SetBoolField(TEXT("messagesTruncated"), true);
+					break;
+				}
+				TSharedPtr<FJsonObject> MsgJson = MakeShared<FJsonObject>();
+				MsgJson->SetStringField(TEXT("severity"), Msg.Severity);
+				MsgJson->SetStringField(TEXT("message"), Msg.Message);
+				if (!Msg.NodeName.IsEmpty())
+				{
+					MsgJson->SetStringField(TEXT("node"), Msg.NodeName);
+				}
+				MessagesArray.Add(MakeShared<FJsonValueObject>(MsgJson));
+			}
+			ResultJson->SetArrayField(TEXT("messages"), MessagesArray);
+		}
+		return ResultJson;
+	}
+}
+
+bool FMCPTool_CompileBlueprints::GatherBlueprints(const TSharedRef<FJsonObject>& Params, TArray<FAssetData>& OutAssets, FString& OutError) const
+{
+	const FString Path = ExtractOptionalString(Params, TEXT("path"));
+	const FString NameFilter = ExtractOptionalString(Params, TEXT("name_filter"));
+
+	const TArray<TSharedPtr<FJsonValue>>* PathsArray = nullptr;
+	const bool bHasPaths = Params->TryGetArrayField(TEXT("asset_paths"), PathsArray) && PathsArray->Num() > 0;
+	if (Path.IsEmpty() == !bHasPaths)
+	{
+		OutError = TEXT("Pass either path (a folder) or asset_paths (non-empty array)");
+		return false;
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	if (!Path.IsEmpty())
+	{
+		if (!FMCPParamValidator::ValidateBlueprintPath(Path, OutError))
+		{
+			return false;
+		}
+
+		FString Folder = Path;
+		Folder.RemoveFromEnd(TEXT("/"));
+
+		// Recursive classes pick up Widget, Animation and other Blueprint subclasses
+		FARFilter Filter;
+		Filter.PackagePaths.Add(FName(*Folder));
+		Filter.bRecursivePaths = true;
+		Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+		Filter.bRecursiveClasses = true;
+		AssetRegistry.GetAssets(Filter, OutAssets);
+
+		if (!NameFilter.IsEmpty())
+		{
+			OutAssets.RemoveAll([&NameFilter](const FAssetData& Asset)
+			{
+				return !Asset.AssetName.ToString().Contains(NameFilter);
+			});
+		}
+
+		if (OutAssets.Num() == 0)
+		{
+			OutError = FString::Printf(TEXT("No Blueprints found under %s"), *Folder);
+			return false;
+		}
+	}
+	else
+	{
+		TSet<FName> SeenPackages;
+		for (const TSharedPtr<FJsonValue>& PathValue : *PathsArray)
+		{
+			FString AssetPath;
+			if (!PathValue->TryGetString(AssetPath) || AssetPath.IsEmpty())
+			{
+				OutError = TEXT("asset_paths must be an array of non-empty strings");
+				return false;
+			}
+
+			FString ValidationError;
+			if (!FMCPParamValidator::ValidateBlueprintPath(AssetPath, ValidationError))
+			{
+				OutError = FString::Printf(TEXT("%s: %s"), *AssetPath, *ValidationError);
+				return false;
+			}
+
+			// Accept both package paths and full object paths (e.g., /Game/BP.BP_C -> /Game/BP)
+			const FName PackageName(AssetPath.Contains(TEXT("."))
+				? FPackageName::ObjectPathToPackageName(AssetPath)
+				: AssetPath);
+			if (SeenPackages.Contains(PackageName))
+			{
+				continue;
+			}
+			SeenPackages.Add(PackageName);
+
+			TArray<FAssetData> PackageAssets;
+			AssetRegistry.GetAssetsByPackageName(PackageName, PackageAssets);
+			const FAssetData* BlueprintAsset = PackageAssets.FindByPredicate([](const FAssetData& Asset)
+			{
+				return Asset.IsInstanceOf(UBlueprint::StaticClass());
+			});
+			if (!BlueprintAsset)
+			{
+				OutError = FString::Printf(TEXT("%s: no Blueprint found"), *AssetPath);
+				return false;
+			}
+			OutAssets.Add(*BlueprintAsset);
+		}
+	}
+
+	if (OutAssets.Num() > MaxBlueprints)
+	{
+		OutError = FString::Printf(TEXT("Too many Blueprints: %d (max %d per call); narrow path or name_filter"),
+			OutAssets.Num(), MaxBlueprints);
+		return false;
+	}
+
+	// Stable input order, so ties and cycles compile in a predictable order
+	OutAssets.Sort([](const FAssetData& A, const FAssetData& B)
+	{
+		return A.PackageName.LexicalLess(B.PackageName);
+	});
+	return true;
+}
+
+void FMCPTool_CompileBlueprints::GetRequiredAssets(const TSharedRef<FJsonObject>& Params, TArray<FSoftObjectPath>& OutAssets) const
+{
+	TArray<FAssetData> Assets;
+	FString Error;
+	if (GatherBlueprints(Params, Assets, Error))
+	{
+		for (const FAssetData& Asset : Assets)
+		{
+			OutAssets.Add(Asset.GetSoftObjectPath());
+		}
+	}
+}
+
+TArray<int32> FMCPTool_CompileBlueprints::SortByDependencies(const TArray<FName>& PackageNames,
+	const TArray<TArray<FName>>& Dependencies, int32& OutCycleCount)
+{
+	TMap<FName, int32> IndexOf;
+	IndexOf.Reserve(PackageNames.Num());
+	for (int32 Index = 0; Index < PackageNames.Num(); ++Index)
+	{
+		IndexOf.Add(PackageNames[Index], Index);
+	}
+
+	// Kahn's algorithm over the dependencies inside the set
+	TArray<int32> PendingDependencies;
+	PendingDependencies.Init(0, PackageNames.Num());
+	TArray<TArray<int32>> Dependents;
+	Dependents.SetNum(PackageNames.Num());
+
+	for (int32 Index = 0; Index < PackageNames.Num(); ++Index)
+	{
+		if (!Dependencies.IsValidIndex(Index))
+		{
+			continue;
+		}
+		for (const FName& Dependency : Dependencies[Index])
+		{
+			const int32* DependencyIndex = IndexOf.Find(Dependency);
+			if (!DependencyIndex || *DependencyIndex == Index || Dependents[*DependencyIndex].Contains(Index))
+			{
+				continue;
+			}
+			Dependents[*DependencyIndex].Add(Index);
+			++PendingDependencies[Index];
+		}
+	}
+
+	TArray<int32> Order;
+	Order.Reserve(PackageNames.Num());
+	for (int32 Index = 0; Index < PackageNames.Num(); ++Index)
+	{
+		if (PendingDependencies[Index] == 0)
+		{
+			Order.Add(Index);
+		}
+	}
+	for (int32 Next = 0; Next < Order.Num(); ++Next)
+	{
+		for (int32 Dependent : Dependents[Order[Next]])
+		{
+			if (--PendingDependencies[Dependent] == 0)
+			{
+				Order.Add(Dependent);
+			}
+		}
+	}
+
+	// Whatever is left is part of (or depends on) a cycle
+	OutCycleCount = PackageNames.Num() - Order.Num();
+	if (OutCycleCount > 0)
+	{
+		for (int32 Index = 0; Index < PackageNames.Num(); ++Index)
+		{
+			if (PendingDependencies[Index] > 0)
+			{
+				Order.Add(Index);
+			}
+		}
+	}
+	return Order;
+}
+
+FMCPToolResult FMCPTool_CompileBlueprints::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	const bool bPerAssetTiming = ExtractOptionalBool(Params, TEXT("per_asset_timing"), false);
+	const bool bIncludeAll = ExtractOptionalBool(Params, TEXT("include_all"), false);
+	const int32 SlowestCount = FMath::Clamp(ExtractOptionalNumber<int32>(Params, TEXT("slowest"), DefaultSlowest), 1, MaxSlowest);
+
+	TArray<FAssetData> Assets;
+	FString GatherError;
+	if (!GatherBlueprints(Params, Assets, GatherError))
+	{
+		return FMCPToolResult::Error(GatherError);
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Dependency order from registry data, before anything is loaded
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	const UE::AssetRegistry::FDependencyQuery HardOnly(UE::AssetRegistry::EDependencyQuery::Hard);
+
+	TArray<FName> PackageNames;
+	TArray<TArray<FName>> Dependencies;
+	PackageNames.Reserve(Assets.Num());
+	Dependencies.SetNum(Assets.Num());
+	for (int32 Index = 0; Index < Assets.Num(); ++Index)
+	{
+		PackageNames.Add(Assets[Index].PackageName);
+		AssetRegistry.GetDependencies(Assets[Index].PackageName, Dependencies[Index],
+			UE::AssetRegistry::EDependencyCategory::Package, HardOnly);
+	}
+
+	int32 CycleCount = 0;
+	const TArray<int32> Order = SortByDependencies(PackageNames, Dependencies, CycleCount);
+
+	// Load (usually already streamed in by the task queue preloader)
+	TArray<UBlueprint*> Blueprints;
+	TArray<FString> BlueprintPaths;
+	TArray<TSharedPtr<FJsonValue>> ResultsArray;
+	int32 LoadFailedCount = 0;
+	for (int32 Index : Order)
+	{
+		UBlueprint* Blueprint = Cast<UBlueprint>(Assets[Index].GetAsset());
+		if (!Blueprint)
+		{
+			TSharedPtr<FJsonObject> ResultJson = MakeShared<FJsonObject>();
+			ResultJson->SetStringField(TEXT("path"), Assets[Index].PackageName.ToString());
+			ResultJson->SetStringField(TEXT("status"), TEXT("LoadFailed"));
+			ResultsArray.Add(MakeShared<FJsonValueObject>(ResultJson));
+			++LoadFailedCount;
+			continue;
+		}
+		Blueprints.Add(Blueprint);
+		BlueprintPaths.Add(Assets[Index].PackageName.ToString());
+	}
+
+	// This compile covers any changes deferred by an open begin_edit session
+	int32 ClosedSessionCount = 0;
+	for (UBlueprint* Blueprint : Blueprints)
+	{
+		FMCPBlueprintEditSession ClosedSession;
+		ClosedSessionCount += FMCPBlueprintEditSessions::Get().End(Blueprint, ClosedSession) ? 1 : 0;
+	}
+
+	const double CompileStartTime = FPlatformTime::Seconds();
+
+	TArray<double> CompileSeconds;
+	CompileSeconds.Init(0.0, Blueprints.Num());
+	if (bPerAssetTiming)
+	{
+		for (int32 Index = 0; Index < Blueprints.Num(); ++Index)
+		{
+			const double BlueprintStartTime = FPlatformTime::Seconds();
+			FKismetEditorUtilities::CompileBlueprint(Blueprints[Index], EBlueprintCompileOptions::SkipGarbageCollection);
+			CompileSeconds[Index] = FPlatformTime::Seconds() - BlueprintStartTime;
+		}
+	}
+	else
+	{
+		// One queue flush compiles the batch together and reinstances once
+		for (UBlueprint* Blueprint : Blueprints)
+		{
+			FBlueprintCompilationManager::QueueForCompilation(Blueprint);
+		}
+		FBlueprintCompilationManager::FlushCompilationQueueAndReinstance();
+	}
+
+	const double EndTime = FPlatformTime::Seconds();
+
+	int32 SucceededCount = 0;
+	int32 ErrorCount = 0;
+	int32 WarningCount = 0;
+	for (int32 Index = 0; Index < Blueprints.Num(); ++Index)
+	{
+		const FBlueprintCompileResult CompileResult = FBlueprintLoader::GetCompileResult(Blueprints[Index]);
+		if (CompileResult.bSuccess)
+		{
+			++SucceededCount;
+		}
+		else
+		{
+			++ErrorCount;
+		}
+		if (CompileResult.WarningCount > 0)
+		{
+			++WarningCount;
+		}
+
+		if (bIncludeAll || !CompileResult.bSuccess || CompileResult.HasIssues())
+		{
+			TSharedPtr<FJsonObject> ResultJson = MakeCompileResultJson(BlueprintPaths[Index], CompileResult);
+			if (bPerAssetTiming)
+			{
+				ResultJson->SetNumberField(TEXT("seconds"), CompileSeconds[Index]);
+			}
+			ResultsArray.Add(MakeShared<FJsonValueObject>(ResultJson));
+		}
+	}
+
+	TSharedPtr<FJsonObject> SecondsJson = MakeShared<FJsonObject>();
+	SecondsJson->SetNumberField(TEXT("load"), CompileStartTime - StartTime);
+	SecondsJson->SetNumberField(TEXT("compile"), EndTime - CompileStartTime);
+	SecondsJson->SetNumberField(TEXT("total"), EndTime - StartTime);
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetStringField(TEXT("mode"), bPerAssetTiming ? TEXT("per_asset") : TEXT("batch"));
+	ResultData->SetNumberField(TEXT("total"), Assets.Num());
+	ResultData->SetNumberField(TEXT("compiled"), Blueprints.Num());
+	ResultData->SetNumberField(TEXT("succeeded"), SucceededCount);
+	ResultData->SetNumberField(TEXT("withErrors"), ErrorCount);
+	ResultData->SetNumberField(TEXT("withWarnings"), WarningCount);
+	ResultData->SetNumberField(TEXT("loadFailed"), LoadFailedCount);
+	if (CycleCount > 0)
+	{
+		ResultData->SetNumberField(TEXT("unorderedByCycles"), CycleCount);
+	}
+	if (ClosedSessionCount > 0)
+	{
+		ResultData->SetNumberField(TEXT("closedEditSessions"), ClosedSessionCount);
+	}
+	ResultData->SetObjectField(TEXT("seconds"), SecondsJson);
+	ResultData->SetArrayField(TEXT("results"), ResultsArray);
+
+	if (bPerAssetTiming && Blueprints.Num() > 0)
+	{
+		TArray<int32> ByTime;
+		ByTime.Reserve(Blueprints.Num());
+		for (int32 Index = 0; Index < Blueprints.Num(); ++Index)
+		{
+			ByTime.Add(Index);
+		}
+		ByTime.Sort([&CompileSeconds](int32 A, int32 B)
+		{
+			return CompileSeconds[A] > CompileSeconds[B];
+		});
+
+		TArray<TSharedPtr<FJsonValue>> SlowestArray;
+		for (int32 Rank = 0; Rank < FMath::Min(SlowestCount, ByTime.Num()); ++Rank)
+		{
+			TSharedPtr<FJsonObject> EntryJson = MakeShared<FJsonObject>();
+			EntryJson->SetStringField(TEXT("path"), BlueprintPaths[ByTime[Rank]]);
+			EntryJson->SetNumberField(TEXT("seconds"), CompileSeconds[ByTime[Rank]]);
+			SlowestArray.Add(MakeShared<FJsonValueObject>(EntryJson));
+		}
+		ResultData->SetArrayField(TEXT("slowest"), SlowestArray);
+	}
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("compile_blueprints: %d Blueprints (%s) in %.2fs, %d with errors, %d with warnings"),
+		Blueprints.Num(), bPerAssetTiming ? TEXT("per asset") : TEXT("batch"), EndTime - StartTime, ErrorCount, WarningCount);
+
+	const FString Message = FString::Printf(TEXT("Compiled %d Blueprint%s in %.1fs: %d with errors, %d with warnings, %d failed to load"),
+		Blueprints.Num(), Blueprints.Num() == 1 ? TEXT("") : TEXT("s"), EndTime - StartTime,
+		ErrorCount, WarningCount, LoadFailedCount);
+	return FMCPToolResult::Success(Message, ResultData);
+}
@@ -0,0 +1,82 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCP/MCPToolBase.h"
+
+struct FAssetData;
+
+/**
+ * MCP Tool: Recompile many Blueprints in one pass
+ *
+ * Collects Blueprints under a folder or from an explicit list using the
+ * asset registry, orders them so that each Blueprint comes after the
+ * Blueprints it hard-references (parents, components, casts), then queues
+ * them all on the Blueprint compilation manager and flushes the queue once.
+ * The manager compiles the batch phase by phase and reinstances once, which
+ * is much cheaper than compiling the same Blueprints one after another.
+ *
+ * With per_asset_timing the Blueprints are compiled one at a time in the
+ * same order instead, so each one can be timed.
+ */
+class FMCPTool_CompileBlueprints : public FMCPToolBase
+{
+public:
+	virtual FMCPToolInfo GetInfo() const override
+	{
+		FMCPToolInfo Info;
+		Info.Name = TEXT("compile_blueprints");
+		Info.Description = TEXT(
+			"Recompile many Blueprints at once, e.g. after a C++ API change.\n\n"
+			"Pass 'path' to compile every Blueprint under a folder (Widget and Animation Blueprints "
+			"included), optionally narrowed by 'name_filter', or pass 'asset_paths'. Blueprints are "
+			"ordered so dependencies compile first and are handed to the engine's compilation manager "
+			"in a single batch, which reinstances once for the whole set.\n\n"
+			"Set per_asset_timing=true to compile them one at a time instead (slower overall) and get "
+			"the time spent on each Blueprint plus a 'slowest' list.\n\n"
+			"Open blueprint_modify edit sessions for the compiled Blueprints are closed, since this compile covers them.\n\n"
+			"Large batches can take minutes; run them through task_submit. Compiling does not save; "
+			"use save_assets afterwards if needed.\n\n"
+			"Returns: counts, seconds (load/compile), and per-asset results with errors and warnings "
+			"(only Blueprints with issues unless include_all=true)."
+		);
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("path"), TEXT("string"),
+				TEXT("Folder to compile recursively (e.g., '/Game/Blueprints')"), false),
+			FMCPToolParameter(TEXT("asset_paths"), TEXT("array"),
+				TEXT("Blueprints to compile (e.g., ['/Game/Blueprints/BP_Player', '/Game/UI/WBP_HUD'])"), false),
+			FMCPToolParameter(TEXT("name_filter"), TEXT("string"),
+				TEXT("With path: only Blueprints whose name contains this text (case-insensitive)"), false),
+			FMCPToolParameter(TEXT("per_asset_timing"), TEXT("boolean"),
+				TEXT("Compile one at a time and time each Blueprint (default: false)"), false, TEXT("false")),
+			FMCPToolParameter(TEXT("include_all"), TEXT("boolean"),
+				TEXT("List every Blueprint in results, not only those with errors or warnings (default: false)"), false, TEXT("false")),
+			FMCPToolParameter(TEXT("slowest"), TEXT("number"),
+				TEXT("With per_asset_timing: how many of the slowest Blueprints to list (1-100, default: 10)"), false, TEXT("10"))
+		};
+		Info.Annotations = FMCPToolAnnotations::Modifying();
+		return Info;
+	}
+
+	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+
+	virtual void GetRequiredAssets(const TSharedRef<FJsonObject>& Params, TArray<FSoftObjectPath>& OutAssets) const override;
+	virtual bool HasRequiredAssets() const override { return true; }
+
+	/**
+	 * Order Blueprint packages so each comes after the packages it hard-depends on
+	 * Dependencies outside the set are ignored; packages in a cycle keep their
+	 * input order after everything that could be ordered.
+	 * @param PackageNames - Packages to order
+	 * @param Dependencies - Hard dependencies of each package (same indices as PackageNames)
+	 * @param OutCycleCount - Packages that could not be ordered because of cycles
+	 * @return Indices into PackageNames in compile order
+	 */
+	static TArray<int32> SortByDependencies(const TArray<FName>& PackageNames,
+		const TArray<TArray<FName>>& Dependencies, int32& OutCycleCount);
+
+private:
+	/** Resolve path / asset_paths / name_filter to Blueprint assets from the asset registry */
+	bool GatherBlueprints(const TSharedRef<FJsonObject>& Params, TArray<FAssetData>& OutAssets, FString& OutError) const;
+};
@@ -34,7 +34,7 @@ FMCPToolResult FMCPTool_DeleteActors::Execute(const TSharedRef<FJsonObject>& Par
 		}
 
 		// Use base class helper to find actor
-		if (AActor* Actor = FindActorByNameOrLabel(World, SingleActorName))
+		if (AActor* Actor = FindOrLoadActorByNameOrLabel(World, SingleActorName))
 		{
 			ActorsToDelete.Add(Actor);
 			DeletedNames.Add(Actor->GetName());
@@ -61,7 +61,7 @@ FMCPToolResult FMCPTool_DeleteActors::Execute(const TSharedRef<FJsonObject>& Par
 				}
 
 				// Use base class helper to find actor
-				if (AActor* Actor = FindActorByNameOrLabel(World, ActorName))
+				if (AActor* Actor = FindOrLoadActorByNameOrLabel(World, ActorName))
 				{
 					ActorsToDelete.AddUnique(Actor);
 					DeletedNames.AddUnique(Actor->GetName());
@@ -3,6 +3,7 @@
 #include "MCPTool_EnhancedInput.h"
 #include "UnrealClaudeModule.h"
 #include "MCP/MCPParamValidator.h"
+#include "MCP/MCPPackageSaver.h"
 
 // Enhanced Input includes
 #include "InputAction.h"
@@ -13,8 +14,6 @@
 
 // Asset management
 #include "AssetRegistry/AssetRegistryModule.h"
-#include "EditorAssetLibrary.h"
-#include "UObject/SavePackage.h"
 #include "UObject/Package.h"
 
 FMCPToolResult FMCPTool_EnhancedInput::Execute(const TSharedRef<FJsonObject>& Params)
@@ -136,7 +135,7 @@ FMCPToolResult FMCPTool_EnhancedInput::ExecuteCreateInputAction(const TSharedRef
 	// Mark package dirty and save
 	Package->MarkPackageDirty();
 	FString SaveError;
-	if (!SaveAsset(NewAction, SaveError))
+	if (!SaveAsset(NewAction, Params, SaveError))
 	{
 		return FMCPToolResult::Error(SaveError);
 	}
@@ -194,7 +193,7 @@ FMCPToolResult FMCPTool_EnhancedInput::ExecuteCreateMappingContext(const TShared
 	// Mark package dirty and save
 	Package->MarkPackageDirty();
 	FString SaveError;
-	if (!SaveAsset(NewContext, SaveError))
+	if (!SaveAsset(NewContext, Params, SaveError))
 	{
 		return FMCPToolResult::Error(SaveError);
 	}
@@ -266,7 +265,7 @@ FMCPToolResult FMCPTool_EnhancedInput::ExecuteAddMapping(const TSharedRef<FJsonO
 	// Mark dirty and save
 	Context->MarkPackageDirty();
 	FString SaveError;
-	if (!SaveAsset(Context, SaveError))
+	if (!SaveAsset(Context, Params, SaveError))
 	{
 		return FMCPToolResult::Error(SaveError);
 	}
@@ -330,7 +329,7 @@ FMCPToolResult FMCPTool_EnhancedInput::ExecuteRemoveMapping(const TSharedRef<FJs
 	// Mark dirty and save
 	Context->MarkPackageDirty();
 	FString SaveError;
-	if (!SaveAsset(Context, SaveError))
+	if (!SaveAsset(Context, Params, SaveError))
 	{
 		return FMCPToolResult::Error(SaveError);
 	}
@@ -407,7 +406,7 @@ FMCPToolResult FMCPTool_EnhancedInput::ExecuteAddTrigger(const TSharedRef<FJsonO
 	// Mark dirty and save
 	Context->MarkPackageDirty();
 	FString SaveError;
-	if (!SaveAsset(Context, SaveError))
+	if (!SaveAsset(Context, Params, SaveError))
 	{
 		return FMCPToolResult::Error(SaveError);
 	}
@@ -484,7 +483,7 @@ FMCPToolResult FMCPTool_EnhancedInput::ExecuteAddModifier(const TSharedRef<FJson
 	// Mark dirty and save
 	Context->MarkPackageDirty();
 	FString SaveError;
-	if (!SaveAsset(Context, SaveError))
+	if (!SaveAsset(Context, Params, SaveError))
 	{
 		return FMCPToolResult::Error(SaveError);
 	}
@@ -629,30 +628,19 @@ UInputMappingContext* FMCPTool_EnhancedInput::LoadMappingContext(const FString&
 	return Context;
 }
 
-bool FMCPTool_EnhancedInput::SaveAsset(UObject* Asset, FString& OutError)
+bool FMCPTool_EnhancedInput::SaveAsset(UObject* Asset, const TSharedRef<FJsonObject>& Params, FString& OutError)
 {
-	if (!Asset)
+	if (!ExtractOptionalBool(Params, TEXT("save"), true))
 	{
-		OutError = TEXT("Cannot save null asset");
-		return false;
-	}
-
-	UPackage* Package = Asset->GetOutermost();
-	if (!Package)
-	{
-		OutError = TEXT("Asset has no package");
-		return false;
-	}
-
-	// Use EditorAssetLibrary for reliable saving
-	FString PackagePath = Package->GetPathName();
-	if (!UEditorAssetLibrary::SaveAsset(PackagePath, false))
-	{
-		OutError = FString::Printf(TEXT("Failed to save asset: %s"), *PackagePath);
-		return false;
+		// Left dirty for a batched save_assets call
+		if (Asset)
+		{
+			Asset->MarkPackageDirty();
+		}
+		return true;
 	}
 
-	return true;
+	return FMCPPackageSaver::SaveAsset(Asset, OutError);
 }
 
 FKey FMCPTool_EnhancedInput::ParseKey(const FString& KeyName, FString& OutError)
@@ -32,7 +32,7 @@ struct FEnhancedActionKeyMapping;
  *   - query_context: List all mappings in a context
  *   - query_action: Get InputAction details
  *
- * All operations auto-save assets after modification.
+ * All operations save assets after modification unless save=false.
  */
 class FMCPTool_EnhancedInput : public FMCPToolBase
 {
@@ -62,6 +62,8 @@ public:
 			// Operation selector
 			FMCPToolParameter(TEXT("operation"), TEXT("string"),
 				TEXT("Operation to perform (see description)"), true),
+			FMCPToolParameter(TEXT("save"), TEXT("boolean"),
+				TEXT("Save modified assets immediately; false leaves them dirty for one save_assets call later (default: true)"), false, TEXT("true")),
 
 			// Common asset paths
 			FMCPToolParameter(TEXT("package_path"), TEXT("string"),
@@ -140,7 +142,7 @@ private:
 	// Helper methods
 	UInputAction* LoadInputAction(const FString& Path, FString& OutError);
 	UInputMappingContext* LoadMappingContext(const FString& Path, FString& OutError);
-	bool SaveAsset(UObject* Asset, FString& OutError);
+	bool SaveAsset(UObject* Asset, const TSharedRef<FJsonObject>& Params, FString& OutError);
 	FKey ParseKey(const FString& KeyName, FString& OutError);
 
 	// Trigger creation helpers
@@ -0,0 +1,405 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTool_ExportTable.h"
+#include "MCPTool_GetProperties.h"
+#include "MCP/MCPParamValidator.h"
+#include "MCP/MCPPropertyPath.h"
+#include "UnrealClaudeModule.h"
+#include "UnrealClaudeConstants.h"
+#include "JsonUtils.h"
+#include "Editor.h"
+#include "Engine/World.h"
+#include "Engine/Blueprint.h"
+#include "Engine/DataTable.h"
+#include "GameFramework/Actor.h"
+#include "EngineUtils.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "HAL/FileManager.h"
+#include "Async/ParallelFor.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	/** One exported row: an object, or a struct instance owned by an object */
+	struct FExportRow
+	{
+		FString Id;
+		UObject* Object = nullptr;
+		void* StructData = nullptr;
+	};
+}
+
+FMCPToolResult FMCPTool_ExportTable::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	using namespace UnrealClaudeConstants::ExportTable;
+
+	UWorld* World = nullptr;
+	if (auto Error = ValidateEditorContext(World))
+	{
+		return Error.GetValue();
+	}
+
+	FString Source;
+	TOptional<FMCPToolResult> Error;
+	if (!ExtractRequiredString(Params, TEXT("source"), Source, Error))
+	{
+		return Error.GetValue();
+	}
+	Source = Source.ToLower();
+	if (Source != TEXT("actors") && Source != TEXT("assets") && Source != TEXT("datatable"))
+	{
+		return FMCPToolResult::Error(FString::Printf(TEXT("Unknown source: %s. Valid: actors, assets, datatable"), *Source));
+	}
+
+	const FString Format = ExtractOptionalString(Params, TEXT("format"), TEXT("csv")).ToLower();
+	if (Format != TEXT("csv") && Format != TEXT("jsonl"))
+	{
+		return FMCPToolResult::Error(FString::Printf(TEXT("Unknown format: %s. Valid: csv, jsonl"), *Format));
+	}
+	const bool bCsv = Format == TEXT("csv");
+
+	// Columns
+	TArray<FString> Paths;
+	const TArray<TSharedPtr<FJsonValue>>* PathsArray = nullptr;
+	if (Params->TryGetArrayField(TEXT("properties"), PathsArray))
+	{
+		for (const TSharedPtr<FJsonValue>& PathValue : *PathsArray)
+		{
+			FString Path;
+			if (!PathValue->TryGetString(Path) || Path.IsEmpty())
+			{
+				return FMCPToolResult::Error(TEXT("properties must be an array of non-empty strings"));
+			}
+			if (!ValidatePropertyPathParam(Path, Error))
+			{
+				return Error.GetValue();
+			}
+			Paths.AddUnique(Path);
+		}
+	}
+	if (Paths.Num() == 0 && Source != TEXT("datatable"))
+	{
+		return FMCPToolResult::Error(TEXT("Missing required parameter: properties (non-empty array)"));
+	}
+
+	const FString ClassFilter = ExtractOptionalString(Params, TEXT("class_filter"));
+	const FString NameFilter = ExtractOptionalString(Params, TEXT("name_filter"));
+	FString ValidationError;
+	if (!ClassFilter.IsEmpty() && !FMCPParamValidator::ValidateStringLength(ClassFilter, TEXT("class_filter"), 256, ValidationError))
+	{
+		return FMCPToolResult::Error(ValidationError);
+	}
+	if (!NameFilter.IsEmpty() && !FMCPParamValidator::ValidateStringLength(NameFilter, TEXT("name_filter"), 256, ValidationError))
+	{
+		return FMCPToolResult::Error(ValidationError);
+	}
+
+	const int32 Depth = FMath::Clamp(ExtractOptionalNumber<int32>(Params, TEXT("max_depth"),
+		UnrealClaudeConstants::GetProperties::DefaultMaxDepth), 0, UnrealClaudeConstants::GetProperties::MaxDepth);
+	const int32 Limit = FMath::Clamp(ExtractOptionalNumber<int32>(Params, TEXT("limit"), MaxRows), 1, MaxRows);
+
+	// Rows
+	TArray<FExportRow> Rows;
+	const UStruct* RowStruct = nullptr;
+	bool bTruncated = false;
+
+	if (Source == TEXT("actors"))
+	{
+		for (TActorIterator<AActor> It(World); It; ++It)
+		{
+			AActor* Actor = *It;
+			if (!Actor)
+			{
+				continue;
+			}
+			if (!ClassFilter.IsEmpty() && !Actor->GetClass()->GetName().Contains(ClassFilter, ESearchCase::IgnoreCase))
+			{
+				continue;
+			}
+			if (!NameFilter.IsEmpty() &&
+				!Actor->GetName().Contains(NameFilter, ESearchCase::IgnoreCase) &&
+				!Actor->GetActorLabel().Contains(NameFilter, ESearchCase::IgnoreCase))
+			{
+				continue;
+			}
+			if (Rows.Num() >= Limit)
+			{
+				bTruncated = true;
+				break;
+			}
+			Rows.Add({ Actor->GetName(), Actor, nullptr });
+		}
+	}
+	else if (Source == TEXT("assets"))
+	{
+		const FString Directory = ExtractOptionalString(Params, TEXT("directory"), TEXT("/Game/"));
+		if (!ValidateBlueprintPathParam(Directory, Error))
+		{
+			return Error.GetValue();
+		}
+		const bool bRecursive = ExtractOptionalBool(Params, TEXT("recursive"), true);
+
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		TArray<FAssetData> Assets;
+		AssetRegistry.GetAssetsByPath(FName(*Directory), Assets, bRecursive);
+
+		for (const FAssetData& AssetData : Assets)
+		{
+			// Filter on registry data so only exported assets get loaded
+			if (!ClassFilter.IsEmpty() && !AssetData.AssetClassPath.GetAssetName().ToString().Contains(ClassFilter, ESearchCase::IgnoreCase))
+			{
+				continue;
+			}
+			if (!NameFilter.IsEmpty() && !AssetData.AssetName.ToString().Contains(NameFilter, ESearchCase::IgnoreCase))
+			{
+				continue;
+			}
+			if (Rows.Num() >= Limit)
+			{
+				bTruncated = true;
+				break;
+			}
+
+			UObject* Asset = AssetData.GetAsset();
+			if (UBlueprint* Blueprint = Cast<UBlueprint>(Asset))
+			{
+				Asset = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
+			}
+			if (Asset)
+			{
+				Rows.Add({ AssetData.GetObjectPathString(), Asset, nullptr });
+			}
+		}
+	}
+	else
+	{
+		FString TablePath;
+		if (!ExtractRequiredString(Params, TEXT("datatable"), TablePath, Error))
+		{
+			return Error.GetValue();
+		}
+		if (!ValidateBlueprintPathParam(TablePath, Error))
+		{
+			return Error.GetValue();
+		}
+
+		UDataTable* Table = LoadObject<UDataTable>(nullptr, *TablePath);
+		if (!Table || !Table->GetRowStruct())
+		{
+			return FMCPToolResult::Error(FString::Printf(TEXT("DataTable not found: %s"), *TablePath));
+		}
+		RowStruct = Table->GetRowStruct();
+
+		if (Paths.Num() == 0)
+		{
+			for (TFieldIterator<FProperty> It(RowStruct); It; ++It)
+			{
+				Paths.Add(It->GetName());
+			}
+		}
+
+		for (const TPair<FName, uint8*>& Row : Table->GetRowMap())
+		{
+			if (Rows.Num() >= Limit)
+			{
+				bTruncated = true;
+				break;
+			}
+			Rows.Add({ Row.Key.ToString(), Table, Row.Value });
+		}
+	}
+
+	if (Paths.Num() > MaxColumns)
+	{
+		return FMCPToolResult::Error(FString::Printf(TEXT("Too many columns: %d (max %d)"), Paths.Num(), MaxColumns));
+	}
+
+	// Open the output file
+	const FString ExportDir = GetExportDirectory();
+	IFileManager::Get().MakeDirectory(*ExportDir, true);
+
+	FString FileName = ExtractOptionalString(Params, TEXT("file_name"));
+	if (FileName.IsEmpty())
+	{
+		FileName = FString::Printf(TEXT("%s_%s"), *Source, *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+	}
+	FileName = FPaths::MakeValidFileName(FileName, TEXT('_'));
+	const FString FilePath = FPaths::ConvertRelativePathToFull(FPaths::Combine(ExportDir, FileName + TEXT(".") + Format));
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!Writer)
+	{
+		return FMCPToolResult::Error(FString::Printf(TEXT("Could not create export file: %s"), *FilePath));
+	}
+
+	auto WriteText = [&Writer](const FString& Text)
+	{
+		FTCHARToUTF8 Utf8(*Text);
+		Writer->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+	};
+
+	if (bCsv)
+	{
+		FString Header = TEXT("object");
+		for (const FString& Path : Paths)
+		{
+			Header += TEXT(",") + EscapeCsvField(Path);
+		}
+		WriteText(Header + TEXT("\n"));
+	}
+
+	const int32 ColumnCount = Paths.Num();
+	const int32 CellDepth = bCsv ? 0 : Depth;
+	const int32 MaxElements = UnrealClaudeConstants::GetProperties::DefaultMaxElements;
+	FMCPPropertyPathCache& PathCache = FMCPPropertyPathCache::Get();
+
+	TArray<int32> ColumnErrors;
+	ColumnErrors.SetNumZeroed(ColumnCount);
+	TArray<TSharedPtr<FJsonValue>> Cells;
+	TArray<FString> Lines;
+
+	// Work in batches so only one batch of cells is held in memory at a time
+	for (int32 ChunkStart = 0; ChunkStart < Rows.Num(); ChunkStart += RowsPerChunk)
+	{
+		const int32 ChunkRows = FMath::Min(RowsPerChunk, Rows.Num() - ChunkStart);
+
+		// Read cells on the game thread; reflection on live objects is not thread-safe
+		Cells.Reset();
+		Cells.SetNum(ChunkRows * ColumnCount);
+		for (int32 LocalIndex = 0; LocalIndex < ChunkRows; ++LocalIndex)
+		{
+			const FExportRow& Row = Rows[ChunkStart + LocalIndex];
+			for (int32 Column = 0; Column < ColumnCount; ++Column)
+			{
+				FMCPResolvedProperty Resolved;
+				FString ResolveError;
+				const bool bResolved = Row.StructData
+					? PathCache.ResolveInStruct(RowStruct, Row.StructData, Row.Object, Paths[Column], Resolved, ResolveError)
+					: PathCache.Resolve(Row.Object, Paths[Column], Resolved, ResolveError);
+
+				TSharedPtr<FJsonValue>& Cell = Cells[LocalIndex * ColumnCount + Column];
+				if (bResolved)
+				{
+					Cell = FMCPTool_GetProperties::PropertyValueToJson(Resolved.Property, Resolved.ValuePtr, Resolved.Object, CellDepth, MaxElements);
+				}
+				else
+				{
+					Cell = MakeShared<FJsonValueNull>();
+					ColumnErrors[Column]++;
+				}
+			}
+		}
+
+		// Format the batch's lines in parallel, then append them to the file
+		Lines.Reset();
+		Lines.SetNum(ChunkRows);
+		ParallelFor(ChunkRows, [&](int32 LocalIndex)
+		{
+			const int32 RowIndex = ChunkStart + LocalIndex;
+			const TSharedPtr<FJsonValue>* RowCells = &Cells[LocalIndex * ColumnCount];
+
+			if (bCsv)
+			{
+				FString Line = EscapeCsvField(Rows[RowIndex].Id);
+				for (int32 Column = 0; Column < ColumnCount; ++Column)
+				{
+					Line += TEXT(",");
+					Line += EscapeCsvField(CellToCsv(RowCells[Column]));
+				}
+				Lines[LocalIndex] = MoveTemp(Line);
+			}
+			else
+			{
+				TSharedRef<FJsonObject> RowJson = MakeShared<FJsonObject>();
+				RowJson->SetStringField(TEXT("object"), Rows[RowIndex].Id);
+				for (int32 Column = 0; Column < ColumnCount; ++Column)
+				{
+					RowJson->SetField(Paths[Column], RowCells[Column]);
+				}
+				Lines[LocalIndex] = FJsonUtils::Stringify(RowJson, false);
+			}
+		});
+
+		WriteText(FString::Join(Lines, TEXT("\n")) + TEXT("\n"));
+	}
+
+	const int64 Bytes = Writer->TotalSize();
+	if (!Writer->Close())
+	{
+		return FMCPToolResult::Error(FString::Printf(TEXT("Failed writing export file: %s"), *FilePath));
+	}
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetStringField(TEXT("path"), FilePath);
+	ResultData->SetStringField(TEXT("format"), Format);
+	ResultData->SetNumberField(TEXT("rows"), Rows.Num());
+	ResultData->SetNumberField(TEXT("columns"), ColumnCount + 1);
+	ResultData->SetNumberField(TEXT("bytes"), static_cast<double>(Bytes));
+	ResultData->SetBoolField(TEXT("truncated"), bTruncated);
+
+	// Only the columns that failed somewhere; the data itself stays in the file
+	TSharedPtr<FJsonObject> ErrorsJson = MakeShared<FJsonObject>();
+	for (int32 Column = 0; Column < ColumnCount; ++Column)
+	{
+		if (ColumnErrors[Column] > 0)
+		{
+			ErrorsJson->SetNumberField(Paths[Column], ColumnErrors[Column]);
+		}
+	}
+	if (ErrorsJson->Values.Num() > 0)
+	{
+		ResultData->SetObjectField(TEXT("unresolvedCells"), ErrorsJson);
+	}
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("export_table: wrote %d rows to %s"), Rows.Num(), *FilePath);
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Exported %d rows to %s"), Rows.Num(), *FilePath),
+		ResultData
+	);
+}
+
+FString FMCPTool_ExportTable::GetExportDirectory()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealClaude"), TEXT("exports"));
+}
+
+FString FMCPTool_ExportTable::EscapeCsvField(const FString& Field)
+{
+	int32 Index;
+	if (!Field.FindChar(TEXT(','), Index) && !Field.FindChar(TEXT('"'), Index) &&
+		!Field.FindChar(TEXT('\n'), Index) && !Field.FindChar(TEXT('\r'), Index))
+	{
+		return Field;
+	}
+	return TEXT("\"") + Field.Replace(TEXT("\""), TEXT("\"\"")) + TEXT("\"");
+}
+
+FString FMCPTool_ExportTable::CellToCsv(const TSharedPtr<FJsonValue>& Cell)
+{
+	if (!Cell.IsValid())
+	{
+		return FString();
+	}
+
+	switch (Cell->Type)
+	{
+	case EJson::Boolean:
+		return Cell->AsBool() ? TEXT("true") : TEXT("false");
+	case EJson::Number:
+	{
+		const double Number = Cell->AsNumber();
+		if (Number == FMath::RoundToDouble(Number) && FMath::Abs(Number) < 9007199254740992.0)
+		{
+			return FString::Printf(TEXT("%lld"), static_cast<int64>(Number));
+		}
+		return FString::SanitizeFloat(Number);
+	}
+	case EJson::String:
+		return Cell->AsString();
+	default:
+		// Null, or a struct/container; CSV cells are read at depth 0, which exports those as text
+		return FString();
+	}
+}
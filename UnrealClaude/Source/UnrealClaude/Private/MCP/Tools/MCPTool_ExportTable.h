@@ -0,0 +1,65 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCP/MCPToolBase.h"
+
+/**
+ * MCP Tool: Export property columns for many actors, assets or DataTable rows to a file
+ *
+ * Values are read on the game thread through FMCPPropertyPathCache; turning
+ * rows into CSV/JSONL text runs in parallel batches that are streamed to
+ * disk, so large exports never pass through the JSON response.
+ */
+class FMCPTool_ExportTable : public FMCPToolBase
+{
+public:
+	virtual FMCPToolInfo GetInfo() const override
+	{
+		FMCPToolInfo Info;
+		Info.Name = TEXT("export_table");
+		Info.Description = TEXT(
+			"Write chosen properties for many actors, assets or DataTable rows to a CSV or JSONL file "
+			"under Saved/UnrealClaude/exports. Returns only the file path and row count.\n\n"
+			"Use this instead of get_properties when the result would be too large to read inline, "
+			"then inspect the file with your own tools.\n\n"
+			"Sources:\n"
+			"- 'actors': level actors matching class_filter/name_filter\n"
+			"- 'assets': assets under 'directory' whose class matches class_filter (Blueprints use class defaults)\n"
+			"- 'datatable': every row of the 'datatable' asset; properties default to all row fields\n\n"
+			"Property paths use set_property syntax. The first column is always 'object' "
+			"(actor name, asset path or row name). CSV cells hold structs and containers as engine text; "
+			"JSONL expands them up to max_depth.\n\n"
+			"Example: source='actors', class_filter='StaticMeshActor', "
+			"properties=['StaticMeshComponent.StaticMesh', 'StaticMeshComponent.OverrideMaterials', 'RootComponent.RelativeScale3D']"
+		);
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("source"), TEXT("string"), TEXT("What to export: 'actors', 'assets' or 'datatable'"), true),
+			FMCPToolParameter(TEXT("properties"), TEXT("array"), TEXT("Property paths, one column each (optional for datatable)"), false),
+			FMCPToolParameter(TEXT("class_filter"), TEXT("string"), TEXT("Class name substring for actors/assets"), false),
+			FMCPToolParameter(TEXT("name_filter"), TEXT("string"), TEXT("Actor name/label or asset name substring"), false),
+			FMCPToolParameter(TEXT("directory"), TEXT("string"), TEXT("Asset directory for source='assets' (default: /Game/)"), false, TEXT("/Game/")),
+			FMCPToolParameter(TEXT("recursive"), TEXT("boolean"), TEXT("Include subdirectories for source='assets'"), false, TEXT("true")),
+			FMCPToolParameter(TEXT("datatable"), TEXT("string"), TEXT("DataTable asset path for source='datatable'"), false),
+			FMCPToolParameter(TEXT("format"), TEXT("string"), TEXT("'csv' or 'jsonl' (default: csv)"), false, TEXT("csv")),
+			FMCPToolParameter(TEXT("file_name"), TEXT("string"), TEXT("Output file name without extension (default: source and timestamp)"), false),
+			FMCPToolParameter(TEXT("max_depth"), TEXT("number"), TEXT("Struct/container levels expanded in JSONL (default: 2)"), false, TEXT("2")),
+			FMCPToolParameter(TEXT("limit"), TEXT("number"), TEXT("Maximum rows (default and max: 1000000)"), false)
+		};
+		Info.Annotations = FMCPToolAnnotations::ReadOnly();
+		return Info;
+	}
+
+	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+
+	/** Directory exports are written to */
+	static FString GetExportDirectory();
+
+	/** Quote a CSV field if it contains a delimiter, quote or line break */
+	static FString EscapeCsvField(const FString& Field);
+
+private:
+	/** Convert a scalar JSON cell to CSV text */
+	static FString CellToCsv(const TSharedPtr<FJsonValue>& Cell);
+};
@@ -2,6 +2,9 @@
 
 #include "MCPTool_GetLevelActors.h"
 #include "MCP/MCPParamValidator.h"
+#include "MCP/MCPCursorStore.h"
+#include "MCP/MCPLevelJournal.h"
+#include "MCP/MCPWorldPartitionActors.h"
 #include "UnrealClaudeModule.h"
 #include "UnrealClaudeUtils.h"
 #include "Editor.h"
@@ -18,6 +21,18 @@ FMCPToolResult FMCPTool_GetLevelActors::Execute(const TSharedRef<FJsonObject>& P
 		return Error.GetValue();
 	}
 
+	int32 Limit = 25;
+	Params->TryGetNumberField(TEXT("limit"), Limit);
+	if (Limit <= 0) Limit = 25;
+	if (Limit > 1000) Limit = 1000; // Cap at 1000 for performance
+
+	// Continue an earlier listing from its snapshot
+	FString Cursor;
+	if (Params->TryGetStringField(TEXT("cursor"), Cursor) && !Cursor.IsEmpty())
+	{
+		return ExecuteFromCursor(World, Cursor, Limit);
+	}
+
 	// Parse parameters
 	FString ClassFilter;
 	Params->TryGetStringField(TEXT("class_filter"), ClassFilter);
@@ -41,21 +56,21 @@ FMCPToolResult FMCPTool_GetLevelActors::Execute(const TSharedRef<FJsonObject>& P
 
 	bool bBrief = ExtractOptionalBool(Params, TEXT("brief"), true);
 
-	int32 Limit = 25;
-	Params->TryGetNumberField(TEXT("limit"), Limit);
-	if (Limit <= 0) Limit = 25;
-	if (Limit > 1000) Limit = 1000; // Cap at 1000 for performance
+	// An explicit field list overrides brief
+	FMCPFieldSet Fields = bBrief ? GetBriefFields() : GetFullFields();
+	if (!FMCPFieldSet::Parse(Params, GetActorInfoFieldNames(), Fields, ValidationError))
+	{
+		return FMCPToolResult::Error(ValidationError);
+	}
+
+	const bool bIncludeUnloaded = ExtractOptionalBool(Params, TEXT("include_unloaded"), false);
 
 	int32 Offset = 0;
 	Params->TryGetNumberField(TEXT("offset"), Offset);
 	if (Offset < 0) Offset = 0;
 
-	// Collect actors
-	TArray<TSharedPtr<FJsonValue>> ActorsArray;
-	int32 MatchIndex = 0;  // Index among matching actors
-	int32 AddedCount = 0;  // Count of actors added to result
-	int32 TotalMatching = 0;
-
+	// Collect matching actors
+	TArray<AActor*> MatchingActors;
 	for (TActorIterator<AActor> It(World); It; ++It)
 	{
 		AActor* Actor = *It;
@@ -92,47 +107,39 @@ FMCPToolResult FMCPTool_GetLevelActors::Execute(const TSharedRef<FJsonObject>& P
 			}
 		}
 
-		TotalMatching++;
-
-		// Apply offset - skip until we reach the offset
-		if (MatchIndex < Offset)
-		{
-			MatchIndex++;
-			continue;
-		}
-
-		// Apply limit - stop adding after limit reached
-		if (AddedCount >= Limit)
-		{
-			MatchIndex++;
-			continue; // Keep counting total but don't add more
-		}
-
-		// Build actor info using base class helper
-		TSharedPtr<FJsonObject> ActorJson = bBrief
-			? BuildActorInfoJson(Actor)
-			: BuildActorInfoWithTransformJson(Actor);
+		MatchingActors.Add(Actor);
+	}
 
-		if (!bBrief)
+	// Unloaded World Partition actors come from descriptors and follow the loaded ones
+	TArray<FMCPUnloadedActorInfo> MatchingUnloaded;
+	if (bIncludeUnloaded)
+	{
+		FMCPWorldPartitionActors::GatherUnloaded(World, MatchingUnloaded);
+		MatchingUnloaded.RemoveAll([&ClassFilter, &NameFilter](const FMCPUnloadedActorInfo& Info)
 		{
-			ActorJson->SetBoolField(TEXT("hidden"), Actor->IsHidden());
-
-			// Add tags if any
-			if (Actor->Tags.Num() > 0)
+			if (!ClassFilter.IsEmpty() && !Info.ClassName.Contains(ClassFilter, ESearchCase::IgnoreCase))
 			{
-				TArray<FString> TagStrings;
-				for (const FName& Tag : Actor->Tags)
-				{
-					TagStrings.Add(Tag.ToString());
-				}
-				ActorJson->SetArrayField(TEXT("tags"), StringArrayToJsonArray(TagStrings));
+				return true;
 			}
-		}
+			return !NameFilter.IsEmpty() &&
+				!Info.Name.Contains(NameFilter, ESearchCase::IgnoreCase) &&
+				!Info.Label.Contains(NameFilter, ESearchCase::IgnoreCase);
+		});
+	}
 
-		ActorsArray.Add(MakeShared<FJsonValueObject>(ActorJson));
-		AddedCount++;
-		MatchIndex++;
+	// Apply offset/limit
+	const int32 TotalMatching = MatchingActors.Num() + MatchingUnloaded.Num();
+	const int32 StartIndex = FMath::Min(Offset, TotalMatching);
+	const int32 EndIndex = FMath::Min(StartIndex + Limit, TotalMatching);
+
+	TArray<TSharedPtr<FJsonValue>> ActorsArray;
+	for (int32 i = StartIndex; i < EndIndex; ++i)
+	{
+		ActorsArray.Add(MakeShared<FJsonValueObject>(i < MatchingActors.Num()
+			? BuildActorInfoJson(MatchingActors[i], Fields)
+			: FMCPWorldPartitionActors::ToJson(MatchingUnloaded[i - MatchingActors.Num()], Fields)));
 	}
+	const int32 AddedCount = ActorsArray.Num();
 
 	// Build result with pagination metadata
 	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
@@ -141,12 +148,39 @@ FMCPToolResult FMCPTool_GetLevelActors::Execute(const TSharedRef<FJsonObject>& P
 	ResultData->SetNumberField(TEXT("total"), TotalMatching);
 	ResultData->SetNumberField(TEXT("offset"), Offset);
 	ResultData->SetNumberField(TEXT("limit"), Limit);
-	ResultData->SetBoolField(TEXT("hasMore"), (Offset + AddedCount) < TotalMatching);
-	if ((Offset + AddedCount) < TotalMatching)
+	ResultData->SetBoolField(TEXT("hasMore"), EndIndex < TotalMatching);
+	if (EndIndex < TotalMatching)
 	{
-		ResultData->SetNumberField(TEXT("nextOffset"), Offset + AddedCount);
+		ResultData->SetNumberField(TEXT("nextOffset"), EndIndex);
+
+		// Snapshot the remaining matches so later pages skip the world scan
+		TArray<FString> ActorPaths;
+		ActorPaths.Reserve(TotalMatching);
+		for (const AActor* Actor : MatchingActors)
+		{
+			ActorPaths.Add(Actor->GetPathName());
+		}
+		for (const FMCPUnloadedActorInfo& Info : MatchingUnloaded)
+		{
+			ActorPaths.Add(FMCPWorldPartitionActors::MakeId(Info.Guid));
+		}
+		TSharedPtr<FJsonObject> Options = MakeShared<FJsonObject>();
+		Options->SetArrayField(TEXT("fields"), StringArrayToJsonArray(Fields.GetNames()));
+		ResultData->SetStringField(TEXT("nextCursor"),
+			FMCPCursorStore::Get().CreateCursor(GetInfo().Name, MoveTemp(ActorPaths), EndIndex, Options));
 	}
 	ResultData->SetStringField(TEXT("levelName"), World->GetMapName());
+	if (FMCPWorldPartitionActors::IsPartitioned(World))
+	{
+		ResultData->SetBoolField(TEXT("worldPartition"), true);
+		if (bIncludeUnloaded)
+		{
+			ResultData->SetNumberField(TEXT("unloaded"), MatchingUnloaded.Num());
+		}
+	}
+
+	// Journal version this listing reflects, for follow-up get_level_changes calls
+	ResultData->SetNumberField(TEXT("version"), static_cast<double>(FMCPLevelJournal::Get().GetCurrentVersion()));
 
 	FString Message = FString::Printf(TEXT("Found %d actors"), AddedCount);
 	if (TotalMatching > AddedCount)
@@ -156,3 +190,88 @@ FMCPToolResult FMCPTool_GetLevelActors::Execute(const TSharedRef<FJsonObject>& P
 
 	return FMCPToolResult::Success(Message, ResultData);
 }
+
+FMCPToolResult FMCPTool_GetLevelActors::ExecuteFromCursor(UWorld* World, const FString& Cursor, int32 Limit)
+{
+	FMCPCursorPage Page;
+	FString CursorError;
+	if (!FMCPCursorStore::Get().ReadPage(Cursor, GetInfo().Name, Limit, Page, CursorError))
+	{
+		return FMCPToolResult::Error(CursorError);
+	}
+
+	TArray<FString> FieldNames;
+	const FMCPFieldSet Fields = Page.Options.IsValid() && Page.Options->TryGetStringArrayField(TEXT("fields"), FieldNames)
+		? FMCPFieldSet(FieldNames)
+		: GetBriefFields();
+
+	// Actors deleted since the snapshot are skipped rather than shifting later pages
+	TArray<TSharedPtr<FJsonValue>> ActorsArray;
+	int32 MissingCount = 0;
+	for (const FString& ActorPath : Page.Ids)
+	{
+		FGuid DescriptorGuid;
+		if (FMCPWorldPartitionActors::ParseId(ActorPath, DescriptorGuid))
+		{
+			FMCPUnloadedActorInfo Info;
+			AActor* LoadedActor = nullptr;
+			if (!FMCPWorldPartitionActors::FindByGuid(World, DescriptorGuid, Info, LoadedActor))
+			{
+				MissingCount++;
+			}
+			else
+			{
+				ActorsArray.Add(MakeShared<FJsonValueObject>(IsValid(LoadedActor)
+					? BuildActorInfoJson(LoadedActor, Fields)
+					: FMCPWorldPartitionActors::ToJson(Info, Fields)));
+			}
+			continue;
+		}
+
+		AActor* Actor = FindObject<AActor>(nullptr, *ActorPath);
+		if (!IsValid(Actor) || Actor->GetWorld() != World)
+		{
+			MissingCount++;
+			continue;
+		}
+		ActorsArray.Add(MakeShared<FJsonValueObject>(BuildActorInfoJson(Actor, Fields)));
+	}
+
+	const int32 PageEnd = Page.Offset + Page.Ids.Num();
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetArrayField(TEXT("actors"), ActorsArray);
+	ResultData->SetNumberField(TEXT("count"), ActorsArray.Num());
+	ResultData->SetNumberField(TEXT("total"), Page.Total);
+	ResultData->SetNumberField(TEXT("offset"), Page.Offset);
+	ResultData->SetNumberField(TEXT("limit"), Limit);
+	ResultData->SetBoolField(TEXT("hasMore"), !Page.NextCursor.IsEmpty());
+	if (!Page.NextCursor.IsEmpty())
+	{
+		ResultData->SetStringField(TEXT("nextCursor"), Page.NextCursor);
+	}
+	if (MissingCount > 0)
+	{
+		ResultData->SetNumberField(TEXT("missing"), MissingCount);
+	}
+	ResultData->SetStringField(TEXT("levelName"), World->GetMapName());
+
+	FString Message = FString::Printf(TEXT("Found %d actors (showing %d-%d of %d total)"),
+		ActorsArray.Num(), Page.Offset + 1, PageEnd, Page.Total);
+	if (MissingCount > 0)
+	{
+		Message += FString::Printf(TEXT(", %d no longer exist"), MissingCount);
+	}
+
+	return FMCPToolResult::Success(Message, ResultData);
+}
+
+FMCPFieldSet FMCPTool_GetLevelActors::GetBriefFields()
+{
+	return { TEXT("name"), TEXT("label"), TEXT("class") };
+}
+
+FMCPFieldSet FMCPTool_GetLevelActors::GetFullFields()
+{
+	return { TEXT("name"), TEXT("label"), TEXT("class"), TEXT("location"), TEXT("rotation"), TEXT("scale"), TEXT("hidden"), TEXT("tags") };
+}
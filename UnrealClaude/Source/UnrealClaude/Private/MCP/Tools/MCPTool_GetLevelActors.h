@@ -18,24 +18,42 @@ public:
 		Info.Description = TEXT(
 			"PREFERRED: Use this tool to discover what actors exist in the current level.\n\n"
 			"Query actors in the current level with optional filtering. "
-			"By default returns brief info (name, label, class). Set brief=false for full transform data.\n\n"
+			"By default returns brief info (name, label, class). Set brief=false for full transform data, "
+			"or pass 'fields' to choose exactly which properties are returned.\n\n"
 			"Filter examples:\n"
 			"- class_filter='PointLight' - Find all point lights\n"
 			"- class_filter='StaticMeshActor' - Find all static meshes\n"
 			"- name_filter='Player' - Find actors with 'Player' in name\n\n"
-			"Returns: Array of actors. Use offset/limit for pagination on large levels."
+			"Returns: Array of actors. On large levels, pass the returned nextCursor back as 'cursor' "
+			"to page through a stable snapshot of the matches (offset/limit also works). "
+			"The returned 'version' can be passed to get_level_changes to see later edits without re-listing.\n\n"
+			"On World Partition maps only loaded actors are listed unless include_unloaded=true; unloaded actors "
+			"come with loaded=false, bounds and dataLayers, and are loaded automatically only when a tool modifies them."
 		);
 		Info.Parameters = {
 			FMCPToolParameter(TEXT("class_filter"), TEXT("string"), TEXT("Optional class name to filter actors (e.g., 'StaticMeshActor', 'PointLight')"), false),
 			FMCPToolParameter(TEXT("name_filter"), TEXT("string"), TEXT("Optional substring to filter actors by name"), false),
 			FMCPToolParameter(TEXT("include_hidden"), TEXT("boolean"), TEXT("Include hidden actors in results"), false, TEXT("false")),
 			FMCPToolParameter(TEXT("brief"), TEXT("boolean"), TEXT("Return brief info (name/label/class only). Set false for full transform data (default: true)"), false, TEXT("true")),
+			FMCPToolParameter(TEXT("fields"), TEXT("array"), TEXT("Fields to return, overriding brief: name, label, class, folder, location, rotation, scale, hidden, tags"), false),
+			FMCPToolParameter(TEXT("include_unloaded"), TEXT("boolean"), TEXT("On World Partition maps, also list actors in unloaded cells (from descriptors, without loading them)"), false, TEXT("false")),
 			FMCPToolParameter(TEXT("limit"), TEXT("number"), TEXT("Maximum number of actors to return (1-1000, default: 25)"), false, TEXT("25")),
-			FMCPToolParameter(TEXT("offset"), TEXT("number"), TEXT("Number of actors to skip for pagination"), false, TEXT("0"))
+			FMCPToolParameter(TEXT("offset"), TEXT("number"), TEXT("Number of actors to skip for pagination"), false, TEXT("0")),
+			FMCPToolParameter(TEXT("cursor"), TEXT("string"), TEXT("nextCursor from a previous page; filters are taken from the original query"), false)
 		};
 		Info.Annotations = FMCPToolAnnotations::ReadOnly();
 		return Info;
 	}
 
 	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+
+private:
+	/** Serve a page from a cursor snapshot */
+	FMCPToolResult ExecuteFromCursor(UWorld* World, const FString& Cursor, int32 Limit);
+
+	/** Fields returned when brief=true */
+	static FMCPFieldSet GetBriefFields();
+
+	/** Fields returned when brief=false */
+	static FMCPFieldSet GetFullFields();
 };
@@ -0,0 +1,106 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTool_GetLevelChanges.h"
+#include "MCP/MCPLevelJournal.h"
+#include "UnrealClaudeConstants.h"
+#include "UnrealClaudeUtils.h"
+#include "GameFramework/Actor.h"
+
+FMCPToolResult FMCPTool_GetLevelChanges::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	using namespace UnrealClaudeConstants::LevelJournal;
+
+	FMCPLevelJournal& Journal = FMCPLevelJournal::Get();
+	const uint64 CurrentVersion = Journal.GetCurrentVersion();
+
+	const double SinceParam = ExtractOptionalNumber<double>(Params, TEXT("since"), 0.0);
+	if (SinceParam < 0.0)
+	{
+		return FMCPToolResult::Error(TEXT("'since' must be a non-negative journal version"));
+	}
+	const uint64 Since = static_cast<uint64>(SinceParam);
+	if (Since > CurrentVersion)
+	{
+		return FMCPToolResult::Error(FString::Printf(
+			TEXT("Version %llu is newer than the journal (current: %llu). The editor may have restarted; re-list with get_level_actors."),
+			Since, CurrentVersion));
+	}
+
+	const bool bIncludeLocation = ExtractOptionalBool(Params, TEXT("include_location"), true);
+	const int32 Limit = FMath::Clamp(ExtractOptionalNumber<int32>(Params, TEXT("limit"), DefaultChangeLimit), 1, MaxChangeLimit);
+
+	TArray<FMCPActorChangeSummary> Changes;
+	TArray<FString> ResetReasons;
+	const bool bComplete = Journal.GetChangesSince(Since, Changes, ResetReasons);
+
+	TArray<TSharedPtr<FJsonValue>> ChangesArray;
+	const int32 Count = FMath::Min(Changes.Num(), Limit);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FMCPActorChangeSummary& Summary = Changes[i];
+
+		TSharedPtr<FJsonObject> ChangeJson = MakeShared<FJsonObject>();
+		ChangeJson->SetStringField(TEXT("name"), Summary.ActorName);
+		ChangeJson->SetStringField(TEXT("label"), Summary.ActorLabel);
+		ChangeJson->SetStringField(TEXT("class"), Summary.ActorClass);
+		ChangeJson->SetStringField(TEXT("change"),
+			Summary.bCreated ? TEXT("created") : Summary.bDeleted ? TEXT("deleted") : TEXT("modified"));
+
+		if (!Summary.bCreated && !Summary.bDeleted)
+		{
+			if (Summary.bTransformed)
+			{
+				ChangeJson->SetBoolField(TEXT("transformed"), true);
+			}
+			if (Summary.bRelabeled)
+			{
+				ChangeJson->SetBoolField(TEXT("relabeled"), true);
+			}
+			if (Summary.Properties.Num() > 0)
+			{
+				ChangeJson->SetArrayField(TEXT("properties"), StringArrayToJsonArray(Summary.Properties));
+			}
+		}
+
+		if (bIncludeLocation && !Summary.bDeleted && (Summary.bCreated || Summary.bTransformed))
+		{
+			const AActor* Actor = FindObject<AActor>(nullptr, *Summary.ActorPath);
+			if (IsValid(Actor))
+			{
+				ChangeJson->SetObjectField(TEXT("location"), UnrealClaudeJsonUtils::VectorToJson(Actor->GetActorLocation()));
+			}
+		}
+
+		ChangesArray.Add(MakeShared<FJsonValueObject>(ChangeJson));
+	}
+
+	// Changes are ordered by first change, so every entry before the first omitted actor's
+	// first change is covered; resuming from there may repeat some actors but loses none
+	const uint64 ReturnedVersion = Count < Changes.Num() ? Changes[Count].FirstVersion - 1 : CurrentVersion;
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetNumberField(TEXT("version"), static_cast<double>(ReturnedVersion));
+	ResultData->SetNumberField(TEXT("since"), static_cast<double>(Since));
+	ResultData->SetArrayField(TEXT("changes"), ChangesArray);
+	ResultData->SetNumberField(TEXT("count"), Count);
+	ResultData->SetBoolField(TEXT("complete"), bComplete);
+	if (Count < Changes.Num())
+	{
+		ResultData->SetBoolField(TEXT("hasMore"), true);
+		ResultData->SetNumberField(TEXT("total"), Changes.Num());
+	}
+	if (ResetReasons.Num() > 0)
+	{
+		ResultData->SetArrayField(TEXT("resets"), StringArrayToJsonArray(ResetReasons));
+	}
+
+	FString Message = Changes.Num() == 0
+		? FString::Printf(TEXT("No actor changes since version %llu"), Since)
+		: FString::Printf(TEXT("%d actor(s) changed since version %llu"), Changes.Num(), Since);
+	if (!bComplete || ResetReasons.Num() > 0)
+	{
+		Message += TEXT(" (journal incomplete - re-list with get_level_actors)");
+	}
+
+	return FMCPToolResult::Success(Message, ResultData);
+}
@@ -0,0 +1,41 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCP/MCPToolBase.h"
+
+/**
+ * MCP Tool: Report what changed in the level since a journal version
+ *
+ * Served from FMCPLevelJournal, so agents can track edits (their own and the
+ * user's) without re-listing the whole level after every operation.
+ */
+class FMCPTool_GetLevelChanges : public FMCPToolBase
+{
+public:
+	virtual FMCPToolInfo GetInfo() const override
+	{
+		FMCPToolInfo Info;
+		Info.Name = TEXT("get_level_changes");
+		Info.Description = TEXT(
+			"Report actors created, deleted, moved, relabeled or edited since a journal version.\n\n"
+			"get_level_actors and this tool return 'version'. Call get_level_actors once, then pass the "
+			"last version you saw as 'since' to get only what changed, including edits the user made "
+			"in the editor. Multiple changes to one actor are merged into a single entry.\n\n"
+			"If the reply has 'complete'=false or lists 'resets' (map change, undo/redo), the journal "
+			"cannot account for every change: re-list with get_level_actors.\n\n"
+			"Returns: version, changes [{name, label, class, change: created|deleted|modified, "
+			"transformed, relabeled, properties, location}], resets, complete."
+		);
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("since"), TEXT("number"), TEXT("Journal version from a previous reply (default: 0 = everything retained)"), false, TEXT("0")),
+			FMCPToolParameter(TEXT("include_location"), TEXT("boolean"), TEXT("Include the current location of created/moved actors"), false, TEXT("true")),
+			FMCPToolParameter(TEXT("limit"), TEXT("number"), TEXT("Maximum number of changed actors to return (1-2000, default: 200)"), false, TEXT("200"))
+		};
+		Info.Annotations = FMCPToolAnnotations::ReadOnly();
+		return Info;
+	}
+
+	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+};
@@ -0,0 +1,384 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTool_GetProperties.h"
+#include "MCP/MCPParamValidator.h"
+#include "MCP/MCPPropertyPath.h"
+#include "UnrealClaudeModule.h"
+#include "UnrealClaudeConstants.h"
+#include "Editor.h"
+#include "Engine/World.h"
+#include "Engine/Blueprint.h"
+#include "GameFramework/Actor.h"
+#include "EngineUtils.h"
+#include "UObject/UnrealType.h"
+
+FMCPToolResult FMCPTool_GetProperties::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	using namespace UnrealClaudeConstants::GetProperties;
+
+	UWorld* World = nullptr;
+	if (auto Error = ValidateEditorContext(World))
+	{
+		return Error.GetValue();
+	}
+
+	// Columns
+	const TArray<TSharedPtr<FJsonValue>>* PathsArray;
+	if (!Params->TryGetArrayField(TEXT("properties"), PathsArray) || PathsArray->Num() == 0)
+	{
+		return FMCPToolResult::Error(TEXT("Missing required parameter: properties (non-empty array)"));
+	}
+	if (PathsArray->Num() > MaxPaths)
+	{
+		return FMCPToolResult::Error(FString::Printf(TEXT("Too many properties: %d (max %d)"), PathsArray->Num(), MaxPaths));
+	}
+
+	TArray<FString> Paths;
+	TOptional<FMCPToolResult> Error;
+	for (const TSharedPtr<FJsonValue>& PathValue : *PathsArray)
+	{
+		FString Path;
+		if (!PathValue->TryGetString(Path) || Path.IsEmpty())
+		{
+			return FMCPToolResult::Error(TEXT("properties must be an array of non-empty strings"));
+		}
+		if (!ValidatePropertyPathParam(Path, Error))
+		{
+			return Error.GetValue();
+		}
+		Paths.AddUnique(Path);
+	}
+
+	const int32 Depth = FMath::Clamp(ExtractOptionalNumber<int32>(Params, TEXT("max_depth"), DefaultMaxDepth), 0, MaxDepth);
+	const int32 MaxElementCount = FMath::Clamp(ExtractOptionalNumber<int32>(Params, TEXT("max_elements"), DefaultMaxElements), 1, MaxElements);
+	const int32 Limit = FMath::Clamp(ExtractOptionalNumber<int32>(Params, TEXT("limit"), 1000), 1, MaxObjects);
+
+	FString ClassFilter = ExtractOptionalString(Params, TEXT("class_filter"));
+	FString NameFilter = ExtractOptionalString(Params, TEXT("name_filter"));
+	FString ValidationError;
+	if (!ClassFilter.IsEmpty() && !FMCPParamValidator::ValidateStringLength(ClassFilter, TEXT("class_filter"), 256, ValidationError))
+	{
+		return FMCPToolResult::Error(ValidationError);
+	}
+	if (!NameFilter.IsEmpty() && !FMCPParamValidator::ValidateStringLength(NameFilter, TEXT("name_filter"), 256, ValidationError))
+	{
+		return FMCPToolResult::Error(ValidationError);
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* ActorsArray = nullptr;
+	const TArray<TSharedPtr<FJsonValue>>* AssetsArray = nullptr;
+	Params->TryGetArrayField(TEXT("actors"), ActorsArray);
+	Params->TryGetArrayField(TEXT("assets"), AssetsArray);
+	if (!ActorsArray && !AssetsArray && ClassFilter.IsEmpty() && NameFilter.IsEmpty())
+	{
+		return FMCPToolResult::Error(TEXT("Select objects with actors, assets, class_filter or name_filter"));
+	}
+
+	// Rows
+	TArray<UObject*> Objects;
+	TArray<FString> ObjectIds;
+	TSet<UObject*> Seen;
+	TArray<FString> NotFound;
+	bool bTruncated = false;
+
+	auto AddObject = [&](UObject* Object, const FString& Id)
+	{
+		if (Objects.Num() >= Limit)
+		{
+			bTruncated = true;
+			return;
+		}
+		bool bAlreadySeen = false;
+		Seen.Add(Object, &bAlreadySeen);
+		if (!bAlreadySeen)
+		{
+			Objects.Add(Object);
+			ObjectIds.Add(Id);
+		}
+	};
+
+	if (ActorsArray)
+	{
+		for (const TSharedPtr<FJsonValue>& NameValue : *ActorsArray)
+		{
+			FString ActorName;
+			if (!NameValue->TryGetString(ActorName))
+			{
+				continue;
+			}
+			if (!FMCPParamValidator::ValidateActorName(ActorName, ValidationError))
+			{
+				return FMCPToolResult::Error(ValidationError);
+			}
+
+			// Reads never load World Partition actors; unloaded ones are reported as not found
+			if (AActor* Actor = FindActorByNameOrLabel(World, ActorName))
+			{
+				AddObject(Actor, Actor->GetName());
+			}
+			else
+			{
+				NotFound.Add(ActorName);
+			}
+		}
+	}
+
+	if (!ClassFilter.IsEmpty() || !NameFilter.IsEmpty())
+	{
+		for (TActorIterator<AActor> It(World); It && !bTruncated; ++It)
+		{
+			AActor* Actor = *It;
+			if (!Actor)
+			{
+				continue;
+			}
+			if (!ClassFilter.IsEmpty() && !Actor->GetClass()->GetName().Contains(ClassFilter, ESearchCase::IgnoreCase))
+			{
+				continue;
+			}
+			if (!NameFilter.IsEmpty() &&
+				!Actor->GetName().Contains(NameFilter, ESearchCase::IgnoreCase) &&
+				!Actor->GetActorLabel().Contains(NameFilter, ESearchCase::IgnoreCase))
+			{
+				continue;
+			}
+			AddObject(Actor, Actor->GetName());
+		}
+	}
+
+	if (AssetsArray)
+	{
+		for (const TSharedPtr<FJsonValue>& PathValue : *AssetsArray)
+		{
+			FString AssetPath;
+			if (!PathValue->TryGetString(AssetPath))
+			{
+				continue;
+			}
+			if (!ValidateBlueprintPathParam(AssetPath, Error))
+			{
+				return Error.GetValue();
+			}
+
+			UObject* Asset = LoadObject<UObject>(nullptr, *AssetPath);
+			if (UBlueprint* Blueprint = Cast<UBlueprint>(Asset))
+			{
+				// A Blueprint's own properties are editor bookkeeping; its values live on the class defaults
+				Asset = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
+			}
+
+			if (Asset)
+			{
+				AddObject(Asset, AssetPath);
+			}
+			else
+			{
+				NotFound.Add(AssetPath);
+			}
+		}
+	}
+
+	// One column per path; cells that do not resolve are null
+	FMCPPropertyPathCache& PathCache = FMCPPropertyPathCache::Get();
+	TSharedPtr<FJsonObject> ColumnsJson = MakeShared<FJsonObject>();
+	TSharedPtr<FJsonObject> ErrorsJson = MakeShared<FJsonObject>();
+
+	for (const FString& Path : Paths)
+	{
+		TArray<TSharedPtr<FJsonValue>> Column;
+		Column.Reserve(Objects.Num());
+		int32 ErrorCount = 0;
+		FString FirstError;
+
+		for (UObject* Object : Objects)
+		{
+			FMCPResolvedProperty Resolved;
+			FString ResolveError;
+			if (PathCache.Resolve(Object, Path, Resolved, ResolveError))
+			{
+				Column.Add(PropertyValueToJson(Resolved.Property, Resolved.ValuePtr, Resolved.Object, Depth, MaxElementCount));
+				continue;
+			}
+
+			Column.Add(MakeShared<FJsonValueNull>());
+			if (ErrorCount++ == 0)
+			{
+				FirstError = ResolveError;
+			}
+		}
+
+		ColumnsJson->SetArrayField(Path, Column);
+		if (ErrorCount > 0)
+		{
+			TSharedPtr<FJsonObject> ErrorJson = MakeShared<FJsonObject>();
+			ErrorJson->SetNumberField(TEXT("count"), ErrorCount);
+			ErrorJson->SetStringField(TEXT("first"), FirstError);
+			ErrorsJson->SetObjectField(Path, ErrorJson);
+		}
+	}
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetNumberField(TEXT("count"), Objects.Num());
+	ResultData->SetArrayField(TEXT("objects"), StringArrayToJsonArray(ObjectIds));
+	ResultData->SetObjectField(TEXT("columns"), ColumnsJson);
+	if (ErrorsJson->Values.Num() > 0)
+	{
+		ResultData->SetObjectField(TEXT("errors"), ErrorsJson);
+	}
+	if (NotFound.Num() > 0)
+	{
+		ResultData->SetArrayField(TEXT("notFound"), StringArrayToJsonArray(NotFound));
+	}
+	ResultData->SetBoolField(TEXT("truncated"), bTruncated);
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Read %d properties from %d objects%s"),
+			Paths.Num(), Objects.Num(), bTruncated ? TEXT(" (limit reached)") : TEXT("")),
+		ResultData
+	);
+}
+
+TSharedPtr<FJsonValue> FMCPTool_GetProperties::PropertyValueToJson(const FProperty* Property, const void* ValuePtr, UObject* Owner, int32 Depth, int32 MaxElements)
+{
+	if (const FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
+	{
+		return MakeShared<FJsonValueBoolean>(BoolProp->GetPropertyValue(ValuePtr));
+	}
+	if (const FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
+	{
+		const int64 Value = EnumProp->GetUnderlyingProperty()->GetSignedIntPropertyValue(ValuePtr);
+		return MakeShared<FJsonValueString>(EnumProp->GetEnum()->GetNameStringByValue(Value));
+	}
+	if (const FByteProperty* ByteProp = CastField<FByteProperty>(Property))
+	{
+		if (ByteProp->Enum)
+		{
+			return MakeShared<FJsonValueString>(ByteProp->Enum->GetNameStringByValue(ByteProp->GetPropertyValue(ValuePtr)));
+		}
+	}
+	if (const FNumericProperty* NumProp = CastField<FNumericProperty>(Property))
+	{
+		return MakeShared<FJsonValueNumber>(NumProp->IsFloatingPoint()
+			? NumProp->GetFloatingPointPropertyValue(ValuePtr)
+			: static_cast<double>(NumProp->GetSignedIntPropertyValue(ValuePtr)));
+	}
+	if (const FStrProperty* StrProp = CastField<FStrProperty>(Property))
+	{
+		return MakeShared<FJsonValueString>(StrProp->GetPropertyValue(ValuePtr));
+	}
+	if (const FNameProperty* NameProp = CastField<FNameProperty>(Property))
+	{
+		return MakeShared<FJsonValueString>(NameProp->GetPropertyValue(ValuePtr).ToString());
+	}
+	if (const FTextProperty* TextProp = CastField<FTextProperty>(Property))
+	{
+		return MakeShared<FJsonValueString>(TextProp->GetPropertyValue(ValuePtr).ToString());
+	}
+	if (const FSoftObjectProperty* SoftProp = CastField<FSoftObjectProperty>(Property))
+	{
+		// Report the path without loading the target
+		const FSoftObjectPath Path = SoftProp->GetPropertyValue(ValuePtr).ToSoftObjectPath();
+		if (Path.IsNull())
+		{
+			return MakeShared<FJsonValueNull>();
+		}
+		return MakeShared<FJsonValueString>(Path.ToString());
+	}
+	if (const FObjectPropertyBase* ObjProp = CastField<FObjectPropertyBase>(Property))
+	{
+		UObject* Referenced = ObjProp->GetObjectPropertyValue(ValuePtr);
+		if (!Referenced)
+		{
+			return MakeShared<FJsonValueNull>();
+		}
+		return MakeShared<FJsonValueString>(Referenced->GetPathName());
+	}
+
+	if (Depth <= 0)
+	{
+		return ExportAsText(Property, ValuePtr, Owner);
+	}
+
+	if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+	{
+		TSharedPtr<FJsonObject> StructJson = MakeShared<FJsonObject>();
+		for (TFieldIterator<FProperty> It(StructProp->Struct); It; ++It)
+		{
+			StructJson->SetField(It->GetName(),
+				PropertyValueToJson(*It, It->ContainerPtrToValuePtr<void>(ValuePtr), Owner, Depth - 1, MaxElements));
+		}
+		return MakeShared<FJsonValueObject>(StructJson);
+	}
+
+	// Containers longer than MaxElements come back as {count, items}
+	auto WrapElements = [](TArray<TSharedPtr<FJsonValue>>&& Items, int32 Count) -> TSharedPtr<FJsonValue>
+	{
+		if (Items.Num() == Count)
+		{
+			return MakeShared<FJsonValueArray>(MoveTemp(Items));
+		}
+		TSharedPtr<FJsonObject> Wrapped = MakeShared<FJsonObject>();
+		Wrapped->SetNumberField(TEXT("count"), Count);
+		Wrapped->SetArrayField(TEXT("items"), MoveTemp(Items));
+		return MakeShared<FJsonValueObject>(Wrapped);
+	};
+
+	if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Property))
+	{
+		FScriptArrayHelper Helper(ArrayProp, ValuePtr);
+		TArray<TSharedPtr<FJsonValue>> Items;
+		for (int32 i = 0; i < Helper.Num() && Items.Num() < MaxElements; ++i)
+		{
+			Items.Add(PropertyValueToJson(ArrayProp->Inner, Helper.GetRawPtr(i), Owner, Depth - 1, MaxElements));
+		}
+		return WrapElements(MoveTemp(Items), Helper.Num());
+	}
+	if (const FSetProperty* SetProp = CastField<FSetProperty>(Property))
+	{
+		FScriptSetHelper Helper(SetProp, ValuePtr);
+		TArray<TSharedPtr<FJsonValue>> Items;
+		for (int32 i = 0; i < Helper.GetMaxIndex() && Items.Num() < MaxElements; ++i)
+		{
+			if (Helper.IsValidIndex(i))
+			{
+				Items.Add(PropertyValueToJson(SetProp->ElementProp, Helper.GetElementPtr(i), Owner, Depth - 1, MaxElements));
+			}
+		}
+		return WrapElements(MoveTemp(Items), Helper.Num());
+	}
+	if (const FMapProperty* MapProp = CastField<FMapProperty>(Property))
+	{
+		// Keys are exported as text so any key type can be a JSON field name
+		FScriptMapHelper Helper(MapProp, ValuePtr);
+		TSharedPtr<FJsonObject> MapJson = MakeShared<FJsonObject>();
+		int32 Listed = 0;
+		for (int32 i = 0; i < Helper.GetMaxIndex() && Listed < MaxElements; ++i)
+		{
+			if (!Helper.IsValidIndex(i))
+			{
+				continue;
+			}
+			FString Key;
+			MapProp->KeyProp->ExportTextItem_Direct(Key, Helper.GetKeyPtr(i), nullptr, Owner, PPF_None);
+			MapJson->SetField(Key, PropertyValueToJson(MapProp->ValueProp, Helper.GetValuePtr(i), Owner, Depth - 1, MaxElements));
+			Listed++;
+		}
+		if (Listed == Helper.Num())
+		{
+			return MakeShared<FJsonValueObject>(MapJson);
+		}
+		TSharedPtr<FJsonObject> Wrapped = MakeShared<FJsonObject>();
+		Wrapped->SetNumberField(TEXT("count"), Helper.Num());
+		Wrapped->SetObjectField(TEXT("items"), MapJson);
+		return MakeShared<FJsonValueObject>(Wrapped);
+	}
+
+	return ExportAsText(Property, ValuePtr, Owner);
+}
+
+TSharedPtr<FJsonValue> FMCPTool_GetProperties::ExportAsText(const FProperty* Property, const void* ValuePtr, UObject* Owner)
+{
+	FString Text;
+	Property->ExportTextItem_Direct(Text, ValuePtr, nullptr, Owner, PPF_None);
+	return MakeShared<FJsonValueString>(Text);
+}
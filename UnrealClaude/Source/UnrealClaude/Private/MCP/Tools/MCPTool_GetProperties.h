@@ -0,0 +1,66 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCP/MCPToolBase.h"
+
+/**
+ * MCP Tool: Read property values from many actors or assets in one call
+ *
+ * Paths are resolved through FMCPPropertyPathCache, so reading the same
+ * paths across thousands of actors of a few classes compiles each path
+ * once per class. Output is columnar: one array per path, aligned with
+ * the 'objects' array.
+ */
+class FMCPTool_GetProperties : public FMCPToolBase
+{
+public:
+	virtual FMCPToolInfo GetInfo() const override
+	{
+		FMCPToolInfo Info;
+		Info.Name = TEXT("get_properties");
+		Info.Description = TEXT(
+			"Read property values from many actors and/or assets in one call.\n\n"
+			"Select objects with any of:\n"
+			"- actors: actor names or labels\n"
+			"- class_filter / name_filter: every matching actor in the current level\n"
+			"- assets: asset paths (Blueprints are read from their class defaults)\n\n"
+			"Paths use the same syntax as set_property: 'Mobility', 'LightComponent.Intensity', "
+			"'RootComponent.RelativeLocation.Z', 'Tags.0'.\n\n"
+			"Structs and containers are expanded into JSON up to max_depth levels; deeper values are returned as text. "
+			"Containers longer than max_elements come back as {count, items}.\n\n"
+			"Example: class_filter='PointLight', properties=['LightComponent.Intensity', 'LightComponent.AttenuationRadius']\n\n"
+			"Returns: objects (names/paths), columns {path: [value per object]}, "
+			"errors {path: {count, first}} for paths that did not resolve (their cells are null), and notFound."
+		);
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("properties"), TEXT("array"), TEXT("Property paths to read (one column each)"), true),
+			FMCPToolParameter(TEXT("actors"), TEXT("array"), TEXT("Actor names or labels to read"), false),
+			FMCPToolParameter(TEXT("class_filter"), TEXT("string"), TEXT("Read every level actor whose class name contains this"), false),
+			FMCPToolParameter(TEXT("name_filter"), TEXT("string"), TEXT("Read every level actor whose name or label contains this"), false),
+			FMCPToolParameter(TEXT("assets"), TEXT("array"), TEXT("Asset paths to read (e.g., '/Game/Data/DA_Hero')"), false),
+			FMCPToolParameter(TEXT("max_depth"), TEXT("number"), TEXT("Struct/array nesting levels expanded into JSON (0-8, default: 2)"), false, TEXT("2")),
+			FMCPToolParameter(TEXT("max_elements"), TEXT("number"), TEXT("Elements listed per array, set or map (default: 32)"), false, TEXT("32")),
+			FMCPToolParameter(TEXT("limit"), TEXT("number"), TEXT("Maximum objects read (1-5000, default: 1000)"), false, TEXT("1000"))
+		};
+		Info.Annotations = FMCPToolAnnotations::ReadOnly();
+		return Info;
+	}
+
+	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+
+	/**
+	 * Convert a property value to JSON
+	 * @param Property - Property describing the value
+	 * @param ValuePtr - Address of the value
+	 * @param Owner - Object owning the value (for text export)
+	 * @param Depth - Struct/container levels still expanded; at 0 they are exported as text
+	 * @param MaxElements - Elements listed per container
+	 */
+	static TSharedPtr<FJsonValue> PropertyValueToJson(const FProperty* Property, const void* ValuePtr, UObject* Owner, int32 Depth, int32 MaxElements);
+
+private:
+	/** Export a value with the engine's text format */
+	static TSharedPtr<FJsonValue> ExportAsText(const FProperty* Property, const void* ValuePtr, UObject* Owner);
+};
@@ -0,0 +1,63 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTool_LevelDiff.h"
+#include "MCP/MCPLevelSnapshot.h"
+#include "UnrealClaudeConstants.h"
+#include "Engine/World.h"
+
+FMCPToolResult FMCPTool_LevelDiff::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	FString FromName;
+	TOptional<FMCPToolResult> ParamError;
+	if (!ExtractRequiredString(Params, TEXT("from"), FromName, ParamError))
+	{
+		return ParamError.GetValue();
+	}
+
+	FMCPLevelSnapshotStore& Store = FMCPLevelSnapshotStore::Get();
+	TSharedPtr<FMCPLevelSnapshot> From = Store.Find(FromName);
+	if (!From.IsValid())
+	{
+		return FMCPToolResult::Error(FString::Printf(TEXT("Snapshot not found: %s"), *FromName));
+	}
+
+	TSharedPtr<FMCPLevelSnapshot> To;
+	const FString ToName = ExtractOptionalString(Params, TEXT("to"));
+	if (ToName.IsEmpty())
+	{
+		UWorld* World = nullptr;
+		if (auto Error = ValidateEditorContext(World))
+		{
+			return Error.GetValue();
+		}
+		if (World->GetPathName() != From->WorldPath)
+		{
+			return FMCPToolResult::Error(FString::Printf(
+				TEXT("Snapshot '%s' was taken in %s, not the open level"), *FromName, *From->WorldPath));
+		}
+		To = FMCPLevelSnapshotStore::Capture(World, TEXT("live"), From->PropertyPaths);
+	}
+	else
+	{
+		To = Store.Find(ToName);
+		if (!To.IsValid())
+		{
+			return FMCPToolResult::Error(FString::Printf(TEXT("Snapshot not found: %s"), *ToName));
+		}
+	}
+
+	FMCPLevelDiff Diff;
+	FMCPLevelSnapshotStore::Diff(*From, *To, Diff);
+
+	TSharedPtr<FJsonObject> ResultData = FMCPLevelSnapshotStore::DiffToJson(Diff, *From, *To,
+		UnrealClaudeConstants::LevelSnapshot::MaxDiffEntries);
+	ResultData->SetStringField(TEXT("from"), From->Name);
+	ResultData->SetStringField(TEXT("to"), ToName.IsEmpty() ? TEXT("live") : To->Name);
+
+	const FString Message = Diff.IsEmpty()
+		? FString::Printf(TEXT("No differences (%d actors)"), Diff.UnchangedCount)
+		: FString::Printf(TEXT("%d added, %d removed, %d changed, %d unchanged"),
+			Diff.Added.Num(), Diff.Removed.Num(), Diff.Changed.Num(), Diff.UnchangedCount);
+
+	return FMCPToolResult::Success(Message, ResultData);
+}
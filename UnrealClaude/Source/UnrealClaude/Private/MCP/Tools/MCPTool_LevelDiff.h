@@ -0,0 +1,34 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCP/MCPToolBase.h"
+
+/**
+ * MCP Tool: Compare a level snapshot with another snapshot or the live level
+ */
+class FMCPTool_LevelDiff : public FMCPToolBase
+{
+public:
+	virtual FMCPToolInfo GetInfo() const override
+	{
+		FMCPToolInfo Info;
+		Info.Name = TEXT("level_diff");
+		Info.Description = TEXT(
+			"Compare a snapshot from level_snapshot with another snapshot or with the current level.\n\n"
+			"Omit 'to' to compare against the live level (captured with the same properties as 'from'). "
+			"Unchanged actors are matched by hash, so this stays fast on large maps.\n\n"
+			"Returns: added, removed, changed [{name, label, class, fields: class|transform|label|hidden|folder|properties, "
+			"properties}], counts per category and the number of unchanged actors."
+		);
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("from"), TEXT("string"), TEXT("Snapshot to compare from"), true),
+			FMCPToolParameter(TEXT("to"), TEXT("string"), TEXT("Snapshot to compare to (default: the live level)"), false)
+		};
+		Info.Annotations = FMCPToolAnnotations::ReadOnly();
+		return Info;
+	}
+
+	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+};
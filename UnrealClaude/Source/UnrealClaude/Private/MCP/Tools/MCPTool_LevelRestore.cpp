@@ -0,0 +1,86 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTool_LevelRestore.h"
+#include "MCP/MCPLevelSnapshot.h"
+#include "UnrealClaudeConstants.h"
+#include "Engine/World.h"
+
+FMCPToolResult FMCPTool_LevelRestore::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	UWorld* World = nullptr;
+	if (auto Error = ValidateEditorContext(World))
+	{
+		return Error.GetValue();
+	}
+
+	FString SnapshotName;
+	TOptional<FMCPToolResult> ParamError;
+	if (!ExtractRequiredString(Params, TEXT("snapshot"), SnapshotName, ParamError))
+	{
+		return ParamError.GetValue();
+	}
+
+	TSharedPtr<FMCPLevelSnapshot> Target = FMCPLevelSnapshotStore::Get().Find(SnapshotName);
+	if (!Target.IsValid())
+	{
+		return FMCPToolResult::Error(FString::Printf(TEXT("Snapshot not found: %s"), *SnapshotName));
+	}
+	if (World->GetPathName() != Target->WorldPath)
+	{
+		return FMCPToolResult::Error(FString::Printf(
+			TEXT("Snapshot '%s' was taken in %s, not the open level"), *SnapshotName, *Target->WorldPath));
+	}
+
+	const TSharedRef<FMCPLevelSnapshot> Live = FMCPLevelSnapshotStore::Capture(World, TEXT("live"), Target->PropertyPaths);
+	FMCPLevelDiff Plan;
+	FMCPLevelSnapshotStore::Diff(*Target, *Live, Plan);
+
+	if (Plan.IsEmpty())
+	{
+		return FMCPToolResult::Success(FString::Printf(TEXT("Level already matches snapshot '%s'"), *SnapshotName));
+	}
+
+	if (ExtractOptionalBool(Params, TEXT("dry_run"), false))
+	{
+		// Diff is snapshot -> live; 'added' actors will be deleted and 'removed' ones recreated
+		TSharedPtr<FJsonObject> ResultData = FMCPLevelSnapshotStore::DiffToJson(Plan, *Target, *Live,
+			UnrealClaudeConstants::LevelSnapshot::MaxDiffEntries);
+		ResultData->SetBoolField(TEXT("dryRun"), true);
+		return FMCPToolResult::Success(FString::Printf(
+			TEXT("Restore would delete %d, recreate %d and update %d actors"),
+			Plan.Added.Num(), Plan.Removed.Num(), Plan.Changed.Num()), ResultData);
+	}
+
+	FMCPRestoreResult Result;
+	FMCPLevelSnapshotStore::Restore(World, *Target, Plan, Result);
+	MarkWorldDirty(World);
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetStringField(TEXT("snapshot"), SnapshotName);
+	ResultData->SetArrayField(TEXT("deleted"), StringArrayToJsonArray(Result.Destroyed));
+	ResultData->SetArrayField(TEXT("recreated"), StringArrayToJsonArray(Result.Respawned));
+	ResultData->SetArrayField(TEXT("updated"), StringArrayToJsonArray(Result.Updated));
+	if (Result.Renamed.Num() > 0)
+	{
+		// Labels are restored, but these actors could not get their old object names back
+		TSharedPtr<FJsonObject> RenamedObject = MakeShared<FJsonObject>();
+		for (const TPair<FString, FString>& Pair : Result.Renamed)
+		{
+			RenamedObject->SetStringField(Pair.Key, Pair.Value);
+		}
+		ResultData->SetObjectField(TEXT("renamed"), RenamedObject);
+	}
+	if (Result.Errors.Num() > 0)
+	{
+		ResultData->SetArrayField(TEXT("errors"), StringArrayToJsonArray(Result.Errors));
+	}
+
+	FString Message = FString::Printf(TEXT("Restored snapshot '%s': %d deleted, %d recreated, %d updated"),
+		*SnapshotName, Result.Destroyed.Num(), Result.Respawned.Num(), Result.Updated.Num());
+	if (Result.Errors.Num() > 0)
+	{
+		Message += FString::Printf(TEXT(" (%d errors)"), Result.Errors.Num());
+	}
+
+	return FMCPToolResult::Success(Message, ResultData);
+}
@@ -0,0 +1,40 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCP/MCPToolBase.h"
+
+/**
+ * MCP Tool: Return the level to a stored snapshot
+ *
+ * Applies only the difference between the snapshot and the live level,
+ * as a single undoable transaction.
+ */
+class FMCPTool_LevelRestore : public FMCPToolBase
+{
+public:
+	virtual FMCPToolInfo GetInfo() const override
+	{
+		FMCPToolInfo Info;
+		Info.Name = TEXT("level_restore");
+		Info.Description = TEXT(
+			"Return the level to a snapshot taken with level_snapshot.\n\n"
+			"Only the differences are applied: actors added since the snapshot are deleted, deleted actors are "
+			"recreated, and moved/relabeled/edited actors are reset. The whole restore is one undo step (Ctrl+Z).\n\n"
+			"Recreated actors get their class defaults plus the state the snapshot captured, so component "
+			"edits that were not captured with 'properties' are lost for them.\n\n"
+			"Use dry_run=true to see the plan without changing anything.\n\n"
+			"Returns: deleted, recreated and updated actor labels, plus any errors. Recreated actors keep their "
+			"original object names unless another live object holds one; 'renamed' maps those to their new names."
+		);
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("snapshot"), TEXT("string"), TEXT("Snapshot to restore"), true),
+			FMCPToolParameter(TEXT("dry_run"), TEXT("boolean"), TEXT("Report the changes without applying them"), false, TEXT("false"))
+		};
+		Info.Annotations = FMCPToolAnnotations::Destructive();
+		return Info;
+	}
+
+	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+};
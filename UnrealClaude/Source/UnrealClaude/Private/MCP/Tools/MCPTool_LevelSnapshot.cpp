@@ -0,0 +1,133 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTool_LevelSnapshot.h"
+#include "MCP/MCPLevelSnapshot.h"
+#include "MCP/MCPParamValidator.h"
+#include "UnrealClaudeConstants.h"
+#include "Engine/World.h"
+
+FMCPToolResult FMCPTool_LevelSnapshot::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	const FString Operation = ExtractOptionalString(Params, TEXT("operation"), TEXT("capture")).ToLower();
+
+	if (Operation == TEXT("capture"))
+	{
+		return ExecuteCapture(Params);
+	}
+	if (Operation == TEXT("list"))
+	{
+		return ExecuteList();
+	}
+	if (Operation == TEXT("delete"))
+	{
+		return ExecuteDelete(Params);
+	}
+
+	return FMCPToolResult::Error(FString::Printf(
+		TEXT("Unknown operation: '%s'. Valid: capture, list, delete"), *Operation));
+}
+
+FMCPToolResult FMCPTool_LevelSnapshot::ExecuteCapture(const TSharedRef<FJsonObject>& Params)
+{
+	using namespace UnrealClaudeConstants::LevelSnapshot;
+
+	UWorld* World = nullptr;
+	if (auto Error = ValidateEditorContext(World))
+	{
+		return Error.GetValue();
+	}
+
+	FMCPLevelSnapshotStore& Store = FMCPLevelSnapshotStore::Get();
+
+	FString Name = ExtractOptionalString(Params, TEXT("name"));
+	FString ValidationError;
+	if (Name.IsEmpty())
+	{
+		Name = Store.MakeUniqueName();
+	}
+	else if (!FMCPParamValidator::ValidateStringLength(Name, TEXT("name"),
+		UnrealClaudeConstants::MCPValidation::MaxFilterLength, ValidationError))
+	{
+		return FMCPToolResult::Error(ValidationError);
+	}
+
+	TArray<FString> PropertyPaths;
+	const TArray<TSharedPtr<FJsonValue>>* PropertiesArray;
+	if (Params->TryGetArrayField(TEXT("properties"), PropertiesArray))
+	{
+		for (const TSharedPtr<FJsonValue>& Value : *PropertiesArray)
+		{
+			FString Path;
+			if (!Value->TryGetString(Path) || Path.IsEmpty())
+			{
+				continue;
+			}
+			if (!FMCPParamValidator::ValidatePropertyPath(Path, ValidationError))
+			{
+				return FMCPToolResult::Error(ValidationError);
+			}
+			PropertyPaths.AddUnique(Path);
+		}
+	}
+	if (PropertyPaths.Num() > MaxPropertyPaths)
+	{
+		return FMCPToolResult::Error(FString::Printf(
+			TEXT("Too many property paths: %d (max %d)"), PropertyPaths.Num(), MaxPropertyPaths));
+	}
+
+	TSharedRef<FMCPLevelSnapshot> Snapshot = FMCPLevelSnapshotStore::Capture(World, Name, PropertyPaths);
+	Store.Add(Snapshot);
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetStringField(TEXT("name"), Snapshot->Name);
+	ResultData->SetStringField(TEXT("world"), World->GetMapName());
+	ResultData->SetNumberField(TEXT("actorCount"), Snapshot->Actors.Num());
+	if (PropertyPaths.Num() > 0)
+	{
+		ResultData->SetArrayField(TEXT("properties"), StringArrayToJsonArray(PropertyPaths));
+	}
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Captured snapshot '%s' (%d actors)"), *Snapshot->Name, Snapshot->Actors.Num()),
+		ResultData);
+}
+
+FMCPToolResult FMCPTool_LevelSnapshot::ExecuteList()
+{
+	const TArray<TSharedRef<FMCPLevelSnapshot>>& Snapshots = FMCPLevelSnapshotStore::Get().GetAll();
+
+	TArray<TSharedPtr<FJsonValue>> SnapshotsArray;
+	for (const TSharedRef<FMCPLevelSnapshot>& Snapshot : Snapshots)
+	{
+		TSharedPtr<FJsonObject> SnapshotJson = MakeShared<FJsonObject>();
+		SnapshotJson->SetStringField(TEXT("name"), Snapshot->Name);
+		SnapshotJson->SetStringField(TEXT("world"), Snapshot->WorldPath);
+		SnapshotJson->SetNumberField(TEXT("actorCount"), Snapshot->Actors.Num());
+		SnapshotJson->SetArrayField(TEXT("properties"), StringArrayToJsonArray(Snapshot->PropertyPaths));
+		SnapshotJson->SetStringField(TEXT("createdAt"), Snapshot->CreatedAt.ToIso8601());
+		SnapshotsArray.Add(MakeShared<FJsonValueObject>(SnapshotJson));
+	}
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetArrayField(TEXT("snapshots"), SnapshotsArray);
+	ResultData->SetNumberField(TEXT("count"), SnapshotsArray.Num());
+
+	return FMCPToolResult::Success(FString::Printf(TEXT("%d stored snapshots"), SnapshotsArray.Num()), ResultData);
+}
+
+FMCPToolResult FMCPTool_LevelSnapshot::ExecuteDelete(const TSharedRef<FJsonObject>& Params)
+{
+	FString Name;
+	TOptional<FMCPToolResult> ParamError;
+	if (!ExtractRequiredString(Params, TEXT("name"), Name, ParamError))
+	{
+		return ParamError.GetValue();
+	}
+
+	if (!FMCPLevelSnapshotStore::Get().Remove(Name))
+	{
+		return FMCPToolResult::Error(FString::Printf(TEXT("Snapshot not found: %s"), *Name));
+	}
+
+	return FMCPToolResult::Success(FString::Printf(TEXT("Deleted snapshot '%s'"), *Name));
+}
@@ -0,0 +1,47 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCP/MCPToolBase.h"
+
+/**
+ * MCP Tool: Capture, list and delete in-memory level snapshots
+ *
+ * Snapshots are compared with level_diff and applied with level_restore.
+ */
+class FMCPTool_LevelSnapshot : public FMCPToolBase
+{
+public:
+	virtual FMCPToolInfo GetInfo() const override
+	{
+		FMCPToolInfo Info;
+		Info.Name = TEXT("level_snapshot");
+		Info.Description = TEXT(
+			"Record the state of every actor in the level so it can be compared or restored later.\n\n"
+			"Operations:\n"
+			"- 'capture': record class, transform, label, folder, visibility and optional properties of every actor\n"
+			"- 'list': list stored snapshots\n"
+			"- 'delete': delete a stored snapshot\n\n"
+			"Use before trying layout variants, then level_diff to see what changed and level_restore "
+			"to go back. Snapshots live in memory (up to 8; the oldest is dropped) and are lost when the editor closes.\n\n"
+			"Pass 'properties' (e.g. ['StaticMeshComponent.StaticMesh']) to also capture and restore those values; "
+			"actors recreated by level_restore only get the captured state.\n\n"
+			"Returns: name, actorCount (capture) or snapshots [{name, world, actorCount, properties, createdAt}] (list)."
+		);
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("operation"), TEXT("string"), TEXT("Operation: 'capture', 'list', or 'delete' (default: capture)"), false, TEXT("capture")),
+			FMCPToolParameter(TEXT("name"), TEXT("string"), TEXT("Snapshot name (capture: generated if omitted, replaces an existing snapshot of that name)"), false),
+			FMCPToolParameter(TEXT("properties"), TEXT("array"), TEXT("Property paths to capture per actor, e.g. 'StaticMeshComponent.StaticMesh' (capture)"), false)
+		};
+		Info.Annotations = FMCPToolAnnotations::ReadOnly();
+		return Info;
+	}
+
+	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+
+private:
+	FMCPToolResult ExecuteCapture(const TSharedRef<FJsonObject>& Params);
+	FMCPToolResult ExecuteList();
+	FMCPToolResult ExecuteDelete(const TSharedRef<FJsonObject>& Params);
+};
@@ -2,6 +2,7 @@
 
 #include "MCPTool_Material.h"
 #include "MCP/MCPParamValidator.h"
+#include "MCP/MCPPackageSaver.h"
 #include "UnrealClaudeModule.h"
 #include "Editor.h"
 
@@ -22,7 +23,6 @@
 
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Factories/MaterialInstanceConstantFactoryNew.h"
-#include "UObject/SavePackage.h"
 #include "Misc/PackageName.h"
 #include "EditorAssetLibrary.h"
 #include "Dom/JsonValue.h"
@@ -46,6 +46,8 @@ FMCPToolInfo FMCPTool_Material::GetInfo() const
 		TEXT("Package path for new asset (default: /Game/Materials/)")));
 	Info.Parameters.Add(FMCPToolParameter(TEXT("parameters"), TEXT("object"),
 		TEXT("Material parameters to set: {scalars: {name: value}, vectors: {name: {r,g,b,a}}, textures: {name: path}}")));
+	Info.Parameters.Add(FMCPToolParameter(TEXT("save"), TEXT("boolean"),
+		TEXT("Save the new asset immediately; false leaves it dirty for one save_assets call later (default: true)"), false, TEXT("true")));
 
 	// set_material_parameters params
 	Info.Parameters.Add(FMCPToolParameter(TEXT("material_instance_path"), TEXT("string"),
@@ -201,15 +203,12 @@ FMCPToolResult FMCPTool_Material::ExecuteCreateMaterialInstance(const TSharedRef
 	FAssetRegistryModule::AssetCreated(MatInst);
 	Package->MarkPackageDirty();
 
-	// Save the asset
-	FString PackageFileName = FPackageName::LongPackageNameToFilename(FullPackagePath, FPackageName::GetAssetPackageExtension());
-	FSavePackageArgs SaveArgs;
-	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-	FSavePackageResultStruct SaveResult = UPackage::Save(Package, MatInst, *PackageFileName, SaveArgs);
-
-	if (!SaveResult.IsSuccessful())
+	// Save the asset unless the caller batches saves with save_assets
+	const bool bSave = ExtractOptionalBool(Params, TEXT("save"), true);
+	FString SaveError;
+	if (bSave && !FMCPPackageSaver::SaveAsset(MatInst, SaveError))
 	{
-		return FMCPToolResult::Error(FString::Printf(TEXT("Material instance created but failed to save: %s"), *FullPackagePath));
+		return FMCPToolResult::Error(FString::Printf(TEXT("Material instance created but failed to save: %s (%s)"), *FullPackagePath, *SaveError));
 	}
 
 	// Build result
@@ -217,7 +216,7 @@ FMCPToolResult FMCPTool_Material::ExecuteCreateMaterialInstance(const TSharedRef
 	ResultData->SetStringField(TEXT("asset_path"), FullPackagePath);
 	ResultData->SetStringField(TEXT("asset_name"), AssetName);
 	ResultData->SetStringField(TEXT("parent_material"), ParentMaterialPath);
-	ResultData->SetBoolField(TEXT("saved"), true);
+	ResultData->SetBoolField(TEXT("saved"), bSave);
 
 	return FMCPToolResult::Success(
 		FString::Printf(TEXT("Created material instance: %s"), *FullPackagePath),
@@ -395,7 +394,7 @@ FMCPToolResult FMCPTool_Material::ExecuteSetActorMaterial(const TSharedRef<FJson
 	}
 
 	// Find actor
-	AActor* Actor = FindActorByNameOrLabel(World, ActorName);
+	AActor* Actor = FindOrLoadActorByNameOrLabel(World, ActorName);
 	if (!Actor)
 	{
 		return ActorNotFoundError(ActorName);
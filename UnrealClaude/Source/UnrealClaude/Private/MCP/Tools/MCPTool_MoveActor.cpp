@@ -27,7 +27,7 @@ FMCPToolResult FMCPTool_MoveActor::Execute(const TSharedRef<FJsonObject>& Params
 	}
 
 	// Find the actor using base class helper
-	AActor* Actor = FindActorByNameOrLabel(World, ActorName);
+	AActor* Actor = FindOrLoadActorByNameOrLabel(World, ActorName);
 	if (!Actor)
 	{
 		return ActorNotFoundError(ActorName);
@@ -88,6 +88,9 @@ FMCPToolResult FMCPTool_MoveActor::Execute(const TSharedRef<FJsonObject>& Params
 	Actor->MarkPackageDirty();
 	MarkWorldDirty(World);
 
+	// Notify listeners the same way an editor gizmo move does (keeps spatial index current)
+	GEngine->BroadcastOnActorMoved(Actor);
+
 	// Build result with new transform using shared utilities
 	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
 	ResultData->SetStringField(TEXT("actor"), Actor->GetName());
@@ -0,0 +1,191 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTool_QueryActorsSpatial.h"
+#include "MCP/MCPParamValidator.h"
+#include "MCP/MCPSpatialIndex.h"
+#include "UnrealClaudeModule.h"
+#include "UnrealClaudeConstants.h"
+#include "UnrealClaudeUtils.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+FMCPToolResult FMCPTool_QueryActorsSpatial::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	using namespace UnrealClaudeConstants::SpatialQuery;
+
+	UWorld* World = nullptr;
+	if (auto Error = ValidateEditorContext(World))
+	{
+		return Error.GetValue();
+	}
+
+	FString QueryType;
+	TOptional<FMCPToolResult> ParamError;
+	if (!ExtractRequiredString(Params, TEXT("query_type"), QueryType, ParamError))
+	{
+		return ParamError.GetValue();
+	}
+	QueryType = QueryType.ToLower();
+
+	// Filters
+	const FString ClassFilter = ExtractOptionalString(Params, TEXT("class_filter"));
+	const FString TagFilter = ExtractOptionalString(Params, TEXT("tag"));
+	FString ValidationError;
+	if (!ClassFilter.IsEmpty() && !FMCPParamValidator::ValidateStringLength(ClassFilter, TEXT("class_filter"),
+		UnrealClaudeConstants::MCPValidation::MaxFilterLength, ValidationError))
+	{
+		return FMCPToolResult::Error(ValidationError);
+	}
+	if (!TagFilter.IsEmpty() && !FMCPParamValidator::ValidateStringLength(TagFilter, TEXT("tag"),
+		UnrealClaudeConstants::MCPValidation::MaxFilterLength, ValidationError))
+	{
+		return FMCPToolResult::Error(ValidationError);
+	}
+	FMCPFieldSet Fields = { TEXT("name"), TEXT("label"), TEXT("class"), TEXT("location") };
+	if (!FMCPFieldSet::Parse(Params, GetActorInfoFieldNames(), Fields, ValidationError))
+	{
+		return FMCPToolResult::Error(ValidationError);
+	}
+	const bool bIncludeHidden = ExtractOptionalBool(Params, TEXT("include_hidden"), false);
+	const FName TagName = TagFilter.IsEmpty() ? NAME_None : FName(*TagFilter);
+
+	const int32 Limit = FMath::Clamp(ExtractOptionalNumber<int32>(Params, TEXT("limit"), DefaultResultLimit), 1, MaxResultLimit);
+	const double Radius = ExtractOptionalNumber<double>(Params, TEXT("radius"), -1.0);
+
+	if (ExtractOptionalBool(Params, TEXT("rebuild_index"), false))
+	{
+		FMCPSpatialIndex::Get().InvalidateWorld(World);
+	}
+
+	AActor* CenterActor = nullptr;
+	auto Filter = [&](AActor* Actor) -> bool
+	{
+		if (Actor == CenterActor)
+		{
+			return false;
+		}
+		if (!bIncludeHidden && Actor->IsHidden())
+		{
+			return false;
+		}
+		if (!ClassFilter.IsEmpty() && !Actor->GetClass()->GetName().Contains(ClassFilter, ESearchCase::IgnoreCase))
+		{
+			return false;
+		}
+		if (!TagName.IsNone() && !Actor->ActorHasTag(TagName))
+		{
+			return false;
+		}
+		return true;
+	};
+
+	TArray<FMCPSpatialHit> Hits;
+	FMCPSpatialIndex& Index = FMCPSpatialIndex::Get();
+
+	if (QueryType == TEXT("sphere") || QueryType == TEXT("nearest"))
+	{
+		FVector Center;
+		if (!ResolveCenter(World, Params, Center, CenterActor, ParamError))
+		{
+			return ParamError.GetValue();
+		}
+
+		if (QueryType == TEXT("sphere"))
+		{
+			if (Radius < 0.0)
+			{
+				return FMCPToolResult::Error(TEXT("sphere query requires a non-negative 'radius'"));
+			}
+			Index.QuerySphere(World, Center, Radius, Filter, Hits);
+		}
+		else
+		{
+			const int32 K = FMath::Clamp(ExtractOptionalNumber<int32>(Params, TEXT("k"), DefaultNearestCount), 1, MaxResultLimit);
+			Index.QueryNearest(World, Center, K, Radius, Filter, Hits);
+		}
+	}
+	else if (QueryType == TEXT("box"))
+	{
+		if (!HasVectorParam(Params, TEXT("box_min")) || !HasVectorParam(Params, TEXT("box_max")))
+		{
+			return FMCPToolResult::Error(TEXT("box query requires 'box_min' and 'box_max'"));
+		}
+		const FVector A = ExtractVectorParam(Params, TEXT("box_min"));
+		const FVector B = ExtractVectorParam(Params, TEXT("box_max"));
+		Index.QueryBox(World, FBox(A.ComponentMin(B), A.ComponentMax(B)), Filter, Hits);
+	}
+	else if (QueryType == TEXT("ray"))
+	{
+		if (!HasVectorParam(Params, TEXT("start")) || !HasVectorParam(Params, TEXT("end")))
+		{
+			return FMCPToolResult::Error(TEXT("ray query requires 'start' and 'end'"));
+		}
+		const FVector Start = ExtractVectorParam(Params, TEXT("start"));
+		const FVector End = ExtractVectorParam(Params, TEXT("end"));
+		Index.QueryCorridor(World, Start, End, FMath::Max(0.0, Radius), Filter, Hits);
+	}
+	else
+	{
+		return FMCPToolResult::Error(FString::Printf(
+			TEXT("Unknown query_type: '%s'. Valid: sphere, box, ray, nearest"), *QueryType));
+	}
+
+	// Build result
+	TArray<TSharedPtr<FJsonValue>> ActorsArray;
+	const int32 Count = FMath::Min(Hits.Num(), Limit);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		TSharedPtr<FJsonObject> ActorJson = BuildActorInfoJson(Hits[i].Actor, Fields);
+		ActorJson->SetNumberField(TEXT("distance"), Hits[i].Distance);
+		ActorsArray.Add(MakeShared<FJsonValueObject>(ActorJson));
+	}
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetStringField(TEXT("queryType"), QueryType);
+	ResultData->SetArrayField(TEXT("actors"), ActorsArray);
+	ResultData->SetNumberField(TEXT("count"), Count);
+	ResultData->SetNumberField(TEXT("total"), Hits.Num());
+	ResultData->SetBoolField(TEXT("truncated"), Hits.Num() > Count);
+	if (CenterActor)
+	{
+		ResultData->SetStringField(TEXT("centerActor"), CenterActor->GetName());
+	}
+
+	FString Message = FString::Printf(TEXT("Found %d actors (%s query)"), Hits.Num(), *QueryType);
+	if (Hits.Num() > Count)
+	{
+		Message += FString::Printf(TEXT(", showing closest %d"), Count);
+	}
+
+	return FMCPToolResult::Success(Message, ResultData);
+}
+
+bool FMCPTool_QueryActorsSpatial::ResolveCenter(UWorld* World, const TSharedRef<FJsonObject>& Params,
+	FVector& OutCenter, AActor*& OutCenterActor, TOptional<FMCPToolResult>& OutError) const
+{
+	FString CenterActorName;
+	if (Params->TryGetStringField(TEXT("center_actor"), CenterActorName) && !CenterActorName.IsEmpty())
+	{
+		if (!ValidateActorNameParam(CenterActorName, OutError))
+		{
+			return false;
+		}
+		OutCenterActor = FindActorByNameOrLabel(World, CenterActorName);
+		if (!OutCenterActor)
+		{
+			OutError = ActorNotFoundError(CenterActorName);
+			return false;
+		}
+		OutCenter = OutCenterActor->GetActorLocation();
+		return true;
+	}
+
+	if (!HasVectorParam(Params, TEXT("center")))
+	{
+		OutError = FMCPToolResult::Error(TEXT("Provide 'center' {x, y, z} or 'center_actor'"));
+		return false;
+	}
+
+	OutCenter = ExtractVectorParam(Params, TEXT("center"));
+	return true;
+}
@@ -0,0 +1,62 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCP/MCPToolBase.h"
+
+/**
+ * MCP Tool: Query actors by spatial relationship
+ *
+ * Served from FMCPSpatialIndex, so queries only touch actors near the
+ * query region instead of walking the whole level.
+ */
+class FMCPTool_QueryActorsSpatial : public FMCPToolBase
+{
+public:
+	virtual FMCPToolInfo GetInfo() const override
+	{
+		FMCPToolInfo Info;
+		Info.Name = TEXT("query_actors_spatial");
+		Info.Description = TEXT(
+			"Find actors by location instead of listing the whole level.\n\n"
+			"Query types:\n"
+			"- 'sphere': actors whose bounds are within radius of center\n"
+			"- 'box': actors whose bounds intersect box_min/box_max\n"
+			"- 'ray': actors within radius of the segment start-end (corridor)\n"
+			"- 'nearest': the k actors closest to center (optionally within radius)\n\n"
+			"The center can be a location or another actor (center_actor), which is excluded from results.\n\n"
+			"Examples:\n"
+			"- Within 2000 units of PlayerStart: query_type='sphere', center_actor='PlayerStart', radius=2000\n"
+			"- 5 closest lights: query_type='nearest', center={x:0,y:0,z:0}, k=5, class_filter='Light'\n\n"
+			"Returns: Actors sorted by distance (name, label, class, location, distance). "
+			"Pass 'fields' to choose which actor properties are returned; distance is always included."
+		);
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("query_type"), TEXT("string"), TEXT("Query type: 'sphere', 'box', 'ray', or 'nearest'"), true),
+			FMCPToolParameter(TEXT("center"), TEXT("object"), TEXT("Query center {x, y, z} for sphere/nearest"), false),
+			FMCPToolParameter(TEXT("center_actor"), TEXT("string"), TEXT("Use this actor's location as the center (sphere/nearest)"), false),
+			FMCPToolParameter(TEXT("radius"), TEXT("number"), TEXT("Sphere radius, ray corridor half-width, or max distance for nearest"), false),
+			FMCPToolParameter(TEXT("box_min"), TEXT("object"), TEXT("Box minimum corner {x, y, z} (box)"), false),
+			FMCPToolParameter(TEXT("box_max"), TEXT("object"), TEXT("Box maximum corner {x, y, z} (box)"), false),
+			FMCPToolParameter(TEXT("start"), TEXT("object"), TEXT("Ray start {x, y, z} (ray)"), false),
+			FMCPToolParameter(TEXT("end"), TEXT("object"), TEXT("Ray end {x, y, z} (ray)"), false),
+			FMCPToolParameter(TEXT("k"), TEXT("number"), TEXT("Number of neighbours for nearest (default: 10)"), false, TEXT("10")),
+			FMCPToolParameter(TEXT("class_filter"), TEXT("string"), TEXT("Optional class name substring filter"), false),
+			FMCPToolParameter(TEXT("tag"), TEXT("string"), TEXT("Optional actor tag the results must have"), false),
+			FMCPToolParameter(TEXT("fields"), TEXT("array"), TEXT("Actor fields to return: name, label, class, folder, location, rotation, scale, hidden, tags"), false),
+			FMCPToolParameter(TEXT("include_hidden"), TEXT("boolean"), TEXT("Include hidden actors in results"), false, TEXT("false")),
+			FMCPToolParameter(TEXT("limit"), TEXT("number"), TEXT("Maximum number of actors to return (1-1000, default: 25)"), false, TEXT("25")),
+			FMCPToolParameter(TEXT("rebuild_index"), TEXT("boolean"), TEXT("Rebuild the spatial index first (use after moving actors from scripts)"), false, TEXT("false"))
+		};
+		Info.Annotations = FMCPToolAnnotations::ReadOnly();
+		return Info;
+	}
+
+	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+
+private:
+	/** Resolve the query center from center_actor or center */
+	bool ResolveCenter(UWorld* World, const TSharedRef<FJsonObject>& Params, FVector& OutCenter,
+		AActor*& OutCenterActor, TOptional<FMCPToolResult>& OutError) const;
+};
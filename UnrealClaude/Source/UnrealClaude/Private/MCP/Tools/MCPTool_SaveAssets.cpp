@@ -0,0 +1,151 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTool_SaveAssets.h"
+#include "MCP/MCPPackageSaver.h"
+#include "MCP/MCPParamValidator.h"
+#include "UnrealClaudeConstants.h"
+#include "FileHelpers.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+
+using namespace UnrealClaudeConstants::SaveAssets;
+
+namespace
+{
+	TSharedPtr<FJsonObject> MakeSkippedResult(const FString& Path, const FString& Reason)
+	{
+		TSharedPtr<FJsonObject> ResultJson = MakeShared<FJsonObject>();
+		ResultJson->SetStringField(TEXT("package"), Path);
+		ResultJson->SetStringField(TEXT("status"), TEXT("skipped"));
+		ResultJson->SetStringField(TEXT("reason"), Reason);
+		return ResultJson;
+	}
+}
+
+FMCPToolResult FMCPTool_SaveAssets::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	const bool bAllDirty = ExtractOptionalBool(Params, TEXT("all_dirty"), false);
+	const bool bIncludeMaps = ExtractOptionalBool(Params, TEXT("include_maps"), false);
+	const bool bDirtyOnly = ExtractOptionalBool(Params, TEXT("dirty_only"), true);
+	const bool bConcurrent = ExtractOptionalBool(Params, TEXT("concurrent"), true);
+	const FString PathFilter = ExtractOptionalString(Params, TEXT("path_filter"), TEXT("/Game/"));
+
+	const TArray<TSharedPtr<FJsonValue>>* PathsArray = nullptr;
+	const bool bHasPaths = Params->TryGetArrayField(TEXT("asset_paths"), PathsArray) && PathsArray->Num() > 0;
+	if (bHasPaths == bAllDirty)
+	{
+		return FMCPToolResult::Error(TEXT("Pass either asset_paths (non-empty array) or all_dirty=true"));
+	}
+
+	TArray<UPackage*> Packages;
+	TArray<TSharedPtr<FJsonValue>> SkippedArray;
+
+	if (bAllDirty)
+	{
+		TArray<UPackage*> DirtyPackages;
+		FEditorFileUtils::GetDirtyContentPackages(DirtyPackages);
+		if (bIncludeMaps)
+		{
+			FEditorFileUtils::GetDirtyWorldPackages(DirtyPackages);
+		}
+
+		for (UPackage* Package : DirtyPackages)
+		{
+			const FString PackageName = Package ? Package->GetName() : FString();
+			if (PackageName.IsEmpty() || PackageName.StartsWith(TEXT("/Engine/")) || PackageName.StartsWith(TEXT("/Script/")) ||
+				(!PathFilter.IsEmpty() && !PackageName.StartsWith(PathFilter)))
+			{
+				continue;
+			}
+			if (!bIncludeMaps && Package->ContainsMap())
+			{
+				continue;
+			}
+			Packages.Add(Package);
+		}
+	}
+	else
+	{
+		for (const TSharedPtr<FJsonValue>& PathValue : *PathsArray)
+		{
+			FString AssetPath;
+			if (!PathValue->TryGetString(AssetPath) || AssetPath.IsEmpty())
+			{
+				return FMCPToolResult::Error(TEXT("asset_paths must be an array of non-empty strings"));
+			}
+
+			FString ValidationError;
+			if (!FMCPParamValidator::ValidateBlueprintPath(AssetPath, ValidationError))
+			{
+				return FMCPToolResult::Error(FString::Printf(TEXT("%s: %s"), *AssetPath, *ValidationError));
+			}
+
+			// Accept both package paths and full object paths (e.g., /Game/BP.BP_C -> /Game/BP)
+			const FString PackageName = AssetPath.Contains(TEXT("."))
+				? FPackageName::ObjectPathToPackageName(AssetPath)
+				: AssetPath;
+
+			// Only loaded packages can have anything to save
+			UPackage* Package = FindPackage(nullptr, *PackageName);
+			if (!Package)
+			{
+				SkippedArray.Add(MakeShared<FJsonValueObject>(MakeSkippedResult(PackageName, TEXT("not loaded"))));
+				continue;
+			}
+			if (bDirtyOnly && !Package->IsDirty())
+			{
+				SkippedArray.Add(MakeShared<FJsonValueObject>(MakeSkippedResult(PackageName, TEXT("no unsaved changes"))));
+				continue;
+			}
+			Packages.Add(Package);
+		}
+	}
+
+	if (Packages.Num() > MaxPackages)
+	{
+		return FMCPToolResult::Error(FString::Printf(TEXT("Too many packages: %d (max %d per call); narrow path_filter or split the list"),
+			Packages.Num(), MaxPackages));
+	}
+
+	TArray<FMCPPackageSaveResult> SaveResults;
+	const int32 SavedCount = FMCPPackageSaver::SavePackages(Packages, bConcurrent, SaveResults);
+
+	TArray<TSharedPtr<FJsonValue>> ResultsArray;
+	ResultsArray.Reserve(SaveResults.Num() + SkippedArray.Num());
+	for (const FMCPPackageSaveResult& SaveResult : SaveResults)
+	{
+		TSharedPtr<FJsonObject> ResultJson = MakeShared<FJsonObject>();
+		ResultJson->SetStringField(TEXT("package"), SaveResult.PackageName);
+		ResultJson->SetStringField(TEXT("status"), SaveResult.bSuccess ? TEXT("saved") : TEXT("failed"));
+		if (SaveResult.bSuccess)
+		{
+			ResultJson->SetBoolField(TEXT("concurrent"), SaveResult.bConcurrent);
+		}
+		else
+		{
+			ResultJson->SetStringField(TEXT("error"), SaveResult.Error);
+		}
+		ResultsArray.Add(MakeShared<FJsonValueObject>(ResultJson));
+	}
+	ResultsArray.Append(SkippedArray);
+
+	const int32 FailedCount = SaveResults.Num() - SavedCount;
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetNumberField(TEXT("saved"), SavedCount);
+	ResultData->SetNumberField(TEXT("failed"), FailedCount);
+	ResultData->SetNumberField(TEXT("skipped"), SkippedArray.Num());
+	ResultData->SetArrayField(TEXT("results"), ResultsArray);
+
+	const FString Message = FString::Printf(TEXT("Saved %d package%s (%d failed, %d skipped)"),
+		SavedCount, SavedCount == 1 ? TEXT("") : TEXT("s"), FailedCount, SkippedArray.Num());
+
+	// Partial failures still report every result; only a batch where nothing saved is an error
+	if (SavedCount == 0 && FailedCount > 0)
+	{
+		FMCPToolResult Result = FMCPToolResult::Error(Message);
+		Result.Data = ResultData;
+		return Result;
+	}
+	return FMCPToolResult::Success(Message, ResultData);
+}
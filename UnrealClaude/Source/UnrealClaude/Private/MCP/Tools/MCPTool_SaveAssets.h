@@ -0,0 +1,54 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCP/MCPToolBase.h"
+
+/**
+ * MCP Tool: Save many asset packages in one batch
+ *
+ * Takes explicit asset paths or every dirty content package (optionally
+ * under a folder) and hands them to FMCPPackageSaver, which writes
+ * packages without maps through the engine's concurrent save path.
+ * Returns one result per package.
+ */
+class FMCPTool_SaveAssets : public FMCPToolBase
+{
+public:
+	virtual FMCPToolInfo GetInfo() const override
+	{
+		FMCPToolInfo Info;
+		Info.Name = TEXT("save_assets");
+		Info.Description = TEXT(
+			"Save many assets in one batch.\n\n"
+			"Much faster than saving assets one at a time: packages are written together using the "
+			"engine's concurrent save path (maps are saved one by one). Pair with save=false on "
+			"material, enhanced_input and character_data operations to create or edit hundreds "
+			"of assets and save them once at the end.\n\n"
+			"Either pass 'asset_paths', or set 'all_dirty' to save every unsaved content package "
+			"(optionally limited to 'path_filter').\n\n"
+			"Assets that are not loaded or have no unsaved changes are skipped unless "
+			"dirty_only=false.\n\n"
+			"Returns: saved, failed and skipped counts plus one result per package."
+		);
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("asset_paths"), TEXT("array"),
+				TEXT("Asset or package paths to save (e.g., ['/Game/Materials/MI_Red', '/Game/Input/IA_Jump'])"), false),
+			FMCPToolParameter(TEXT("all_dirty"), TEXT("boolean"),
+				TEXT("Save every dirty content package instead of a list (default: false)"), false, TEXT("false")),
+			FMCPToolParameter(TEXT("path_filter"), TEXT("string"),
+				TEXT("With all_dirty: only packages under this path (default: '/Game/')"), false, TEXT("/Game/")),
+			FMCPToolParameter(TEXT("include_maps"), TEXT("boolean"),
+				TEXT("With all_dirty: also save dirty maps (default: false)"), false, TEXT("false")),
+			FMCPToolParameter(TEXT("dirty_only"), TEXT("boolean"),
+				TEXT("Skip listed assets without unsaved changes (default: true)"), false, TEXT("true")),
+			FMCPToolParameter(TEXT("concurrent"), TEXT("boolean"),
+				TEXT("Use concurrent saving for non-map packages (default: true)"), false, TEXT("true"))
+		};
+		Info.Annotations = FMCPToolAnnotations::Modifying();
+		return Info;
+	}
+
+	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+};
@@ -2,6 +2,7 @@
 
 #include "MCPTool_SetProperty.h"
 #include "MCP/MCPParamValidator.h"
+#include "MCP/MCPPropertyPath.h"
 #include "UnrealClaudeModule.h"
 #include "Editor.h"
 #include "Engine/World.h"
@@ -45,7 +46,7 @@ FMCPToolResult FMCPTool_SetProperty::Execute(const TSharedRef<FJsonObject>& Para
 	TSharedPtr<FJsonValue> Value = Params->TryGetField(TEXT("value"));
 
 	// Find the actor using base class helper
-	AActor* Actor = FindActorByNameOrLabel(World, ActorName);
+	AActor* Actor = FindOrLoadActorByNameOrLabel(World, ActorName);
 	if (!Actor)
 	{
 		return ActorNotFoundError(ActorName);
@@ -73,114 +74,6 @@ FMCPToolResult FMCPTool_SetProperty::Execute(const TSharedRef<FJsonObject>& Para
 	);
 }
 
-bool FMCPTool_SetProperty::NavigateToProperty(
-	UObject* StartObject,
-	const TArray<FString>& PathParts,
-	UObject*& OutObject,
-	FProperty*& OutProperty,
-	FString& OutError)
-{
-	OutObject = StartObject;
-	OutProperty = nullptr;
-
-	for (int32 i = 0; i < PathParts.Num(); ++i)
-	{
-		const FString& PartName = PathParts[i];
-		const bool bIsLastPart = (i == PathParts.Num() - 1);
-
-		// Try to find the property
-		OutProperty = OutObject->GetClass()->FindPropertyByName(FName(*PartName));
-
-		if (!OutProperty)
-		{
-			// Try finding as component on actors
-			if (!TryNavigateToComponent(OutObject, PartName, bIsLastPart, OutError))
-			{
-				if (!OutError.IsEmpty())
-				{
-					return false;
-				}
-			}
-			else
-			{
-				OutProperty = nullptr;
-				continue;
-			}
-
-			if (bIsLastPart)
-			{
-				OutError = FString::Printf(TEXT("Property not found: %s on %s"), *PartName, *OutObject->GetClass()->GetName());
-				return false;
-			}
-			continue;
-		}
-
-		// If not the last part, navigate into nested object
-		if (!bIsLastPart)
-		{
-			if (!NavigateIntoNestedObject(OutObject, OutProperty, PartName, OutError))
-			{
-				return false;
-			}
-			OutProperty = nullptr;
-		}
-	}
-
-	return OutProperty != nullptr;
-}
-
-bool FMCPTool_SetProperty::TryNavigateToComponent(
-	UObject*& CurrentObject,
-	const FString& PartName,
-	bool bIsLastPart,
-	FString& OutError)
-{
-	AActor* Actor = Cast<AActor>(CurrentObject);
-	if (!Actor)
-	{
-		return false;
-	}
-
-	for (UActorComponent* Comp : Actor->GetComponents())
-	{
-		if (Comp && Comp->GetName().Contains(PartName))
-		{
-			if (bIsLastPart)
-			{
-				OutError = FString::Printf(TEXT("Cannot set component as value: %s"), *PartName);
-				return false;
-			}
-			CurrentObject = Comp;
-			return true;
-		}
-	}
-	return false;
-}
-
-bool FMCPTool_SetProperty::NavigateIntoNestedObject(
-	UObject*& CurrentObject,
-	FProperty* Property,
-	const FString& PartName,
-	FString& OutError)
-{
-	FObjectProperty* ObjProp = CastField<FObjectProperty>(Property);
-	if (!ObjProp)
-	{
-		OutError = FString::Printf(TEXT("Cannot navigate into non-object property: %s"), *PartName);
-		return false;
-	}
-
-	UObject* NestedObj = ObjProp->GetObjectPropertyValue(ObjProp->ContainerPtrToValuePtr<void>(CurrentObject));
-	if (!NestedObj)
-	{
-		OutError = FString::Printf(TEXT("Nested object is null: %s"), *PartName);
-		return false;
-	}
-
-	CurrentObject = NestedObj;
-	return true;
-}
-
 bool FMCPTool_SetProperty::SetNumericPropertyValue(FNumericProperty* NumProp, void* ValuePtr, const TSharedPtr<FJsonValue>& Value)
 {
 	if (NumProp->IsFloatingPoint())
@@ -372,11 +265,9 @@ bool FMCPTool_SetProperty::SetStructPropertyValue(FStructProperty* StructProp, v
  * - String and Name properties
  * - Struct properties (FVector, FRotator, FLinearColor, etc.)
  *
- * Property path navigation:
- * 1. Parse path into components (e.g., "Component.Location" -> ["Component", "Location"])
- * 2. For each component, find the property on the current object
- * 3. If property is an object reference, dereference and continue
- * 4. Set the final property value using appropriate type handler
+ * Property path navigation (components, nested objects, struct members, array
+ * indices) is done by FMCPPropertyPathCache; this function only converts and
+ * stores the value using the appropriate type handler.
  *
  * Security: Property paths are validated by ValidatePropertyPath() before calling this.
  *
@@ -384,9 +275,13 @@ bool FMCPTool_SetProperty::SetStructPropertyValue(FStructProperty* StructProp, v
  * @param PropertyPath - Dot-separated path to the property (e.g., "Transform.Location.X")
  * @param Value - JSON value to set (type must be compatible with property type)
  * @param OutError - Error message if operation fails
+ * @param OutTargetObject - Optional; receives the object that owns the final property
+ * @param OutProperty - Optional; receives the member of the target object that changed. When given,
+ *   PreEditChange is called on it before the write and the caller must send the matching PostEditChangeProperty
  * @return true if property was successfully set
  */
-bool FMCPTool_SetProperty::SetPropertyFromJson(UObject* Object, const FString& PropertyPath, const TSharedPtr<FJsonValue>& Value, FString& OutError)
+bool FMCPTool_SetProperty::SetPropertyFromJson(UObject* Object, const FString& PropertyPath, const TSharedPtr<FJsonValue>& Value, FString& OutError,
+	UObject** OutTargetObject, FProperty** OutProperty)
 {
 	if (!Object || !Value.IsValid())
 	{
@@ -394,15 +289,9 @@ bool FMCPTool_SetProperty::SetPropertyFromJson(UObject* Object, const FString& P
 		return false;
 	}
 
-	// Parse property path into components for traversal
-	// Example: "StaticMeshComponent.RelativeLocation.X" -> ["StaticMeshComponent", "RelativeLocation", "X"]
-	TArray<FString> PathParts;
-	PropertyPath.ParseIntoArray(PathParts, TEXT("."), true);
-
-	UObject* TargetObject = nullptr;
-	FProperty* Property = nullptr;
-
-	if (!NavigateToProperty(Object, PathParts, TargetObject, Property, OutError))
+	// Compiled once per (class, path) and shared with the other property tools
+	FMCPResolvedProperty Resolved;
+	if (!FMCPPropertyPathCache::Get().Resolve(Object, PropertyPath, Resolved, OutError))
 	{
 		if (OutError.IsEmpty())
 		{
@@ -411,8 +300,28 @@ bool FMCPTool_SetProperty::SetPropertyFromJson(UObject* Object, const FString& P
 		return false;
 	}
 
-	// Get property address and set value based on type
-	void* ValuePtr = Property->ContainerPtrToValuePtr<void>(TargetObject);
+	UObject* TargetObject = Resolved.Object;
+	FProperty* Property = Resolved.Property;
+	void* ValuePtr = Resolved.ValuePtr;
+
+	if (OutTargetObject)
+	{
+		*OutTargetObject = TargetObject;
+	}
+	if (OutProperty)
+	{
+		*OutProperty = Resolved.MemberProperty;
+	}
+
+	// Both record the old value when called inside a transaction
+	if (OutProperty)
+	{
+		TargetObject->PreEditChange(Resolved.MemberProperty);
+	}
+	else
+	{
+		TargetObject->Modify();
+	}
 
 	// Try numeric property
 	if (FNumericProperty* NumProp = CastField<FNumericProperty>(Property))
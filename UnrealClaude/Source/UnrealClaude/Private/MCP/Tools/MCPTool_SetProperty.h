@@ -40,35 +40,19 @@ public:
 
 	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
 
-private:
-	/** Navigate through a property path to find the target object and property */
-	bool NavigateToProperty(
-		UObject* StartObject,
-		const TArray<FString>& PathParts,
-		UObject*& OutObject,
-		FProperty*& OutProperty,
-		FString& OutError);
-
-	/** Try to navigate into a component on an actor */
-	bool TryNavigateToComponent(
-		UObject*& CurrentObject,
-		const FString& PartName,
-		bool bIsLastPart,
-		FString& OutError);
-
-	/** Navigate into a nested object property */
-	bool NavigateIntoNestedObject(
-		UObject*& CurrentObject,
-		FProperty* Property,
-		const FString& PartName,
-		FString& OutError);
+	/**
+	 * Helper to set a property value from JSON (also used by batch_edit_actors)
+	 * @param OutTargetObject - Optional; receives the object owning the property (e.g. a component)
+	 * @param OutProperty - Optional; receives the member of OutTargetObject that changed. PreEditChange is then
+	 *   called before the write, and the caller sends the matching PostEditChangeProperty
+	 */
+	bool SetPropertyFromJson(UObject* Object, const FString& PropertyPath, const TSharedPtr<FJsonValue>& Value, FString& OutError,
+		UObject** OutTargetObject = nullptr, FProperty** OutProperty = nullptr);
 
+private:
 	/** Set a numeric property value from JSON */
 	bool SetNumericPropertyValue(FNumericProperty* NumProp, void* ValuePtr, const TSharedPtr<FJsonValue>& Value);
 
 	/** Set a struct property value from JSON (FVector, FRotator, FLinearColor) */
 	bool SetStructPropertyValue(FStructProperty* StructProp, void* ValuePtr, const TSharedPtr<FJsonValue>& Value);
-
-	/** Helper to set a property value from JSON */
-	bool SetPropertyFromJson(UObject* Object, const FString& PropertyPath, const TSharedPtr<FJsonValue>& Value, FString& OutError);
 };
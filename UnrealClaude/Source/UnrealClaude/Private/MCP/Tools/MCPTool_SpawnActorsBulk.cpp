@@ -0,0 +1,436 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTool_SpawnActorsBulk.h"
+#include "MCP/MCPParamValidator.h"
+#include "UnrealClaudeModule.h"
+#include "UnrealClaudeConstants.h"
+#include "UnrealClaudeUtils.h"
+#include "Editor.h"
+#include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Components/SplineComponent.h"
+#include "GameFramework/Actor.h"
+#include "ScopedTransaction.h"
+
+FMCPToolResult FMCPTool_SpawnActorsBulk::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	using namespace UnrealClaudeConstants::BulkSpawn;
+
+	UWorld* World = nullptr;
+	if (auto Error = ValidateEditorContext(World))
+	{
+		return Error.GetValue();
+	}
+
+	FString ClassPath;
+	TOptional<FMCPToolResult> ParamError;
+	if (!ExtractRequiredString(Params, TEXT("class"), ClassPath, ParamError))
+	{
+		return ParamError.GetValue();
+	}
+
+	FString ValidationError;
+	if (!FMCPParamValidator::ValidateClassPath(ClassPath, ValidationError))
+	{
+		return FMCPToolResult::Error(ValidationError);
+	}
+
+	UClass* ActorClass = LoadActorClass(ClassPath, ParamError);
+	if (!ActorClass)
+	{
+		return ParamError.GetValue();
+	}
+
+	// Optional mesh for StaticMeshActor / instanced placement
+	UStaticMesh* Mesh = nullptr;
+	const FString MeshPath = ExtractOptionalString(Params, TEXT("mesh"));
+	if (!MeshPath.IsEmpty())
+	{
+		Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
+		if (!Mesh)
+		{
+			return FMCPToolResult::Error(FString::Printf(TEXT("Static mesh not found: %s"), *MeshPath));
+		}
+	}
+
+	const FString LabelPrefix = ExtractOptionalString(Params, TEXT("label_prefix"));
+	if (!LabelPrefix.IsEmpty() && !FMCPParamValidator::ValidateActorName(LabelPrefix, ValidationError))
+	{
+		return FMCPToolResult::Error(ValidationError);
+	}
+	const FString Folder = ExtractOptionalString(Params, TEXT("folder"));
+	if (!Folder.IsEmpty() && !FMCPParamValidator::ValidateStringLength(Folder, TEXT("folder"),
+		UnrealClaudeConstants::MCPValidation::MaxFilterLength, ValidationError))
+	{
+		return FMCPToolResult::Error(ValidationError);
+	}
+
+	const bool bInstanced = ExtractOptionalBool(Params, TEXT("instanced"), false);
+	if (bInstanced)
+	{
+		// Only a bare mesh can be collapsed into instances; anything else carries per-actor behaviour
+		if (ActorClass != AStaticMeshActor::StaticClass())
+		{
+			return FMCPToolResult::Error(FString::Printf(
+				TEXT("instanced=true requires class 'StaticMeshActor' (got '%s')"), *ActorClass->GetName()));
+		}
+		if (!Mesh)
+		{
+			return FMCPToolResult::Error(TEXT("instanced=true requires 'mesh'"));
+		}
+	}
+
+	TArray<FTransform> Transforms;
+	if (!BuildTransforms(World, Params, bInstanced ? MaxInstances : MaxActors, Transforms, ParamError))
+	{
+		return ParamError.GetValue();
+	}
+	if (Transforms.Num() == 0)
+	{
+		return FMCPToolResult::Error(TEXT("No placements: provide 'transforms' or a 'pattern' that yields at least one"));
+	}
+
+	if (bInstanced)
+	{
+		return SpawnInstanced(World, Mesh, Transforms, LabelPrefix, Folder);
+	}
+
+	const FScopedTransaction Transaction(NSLOCTEXT("UnrealClaude", "SpawnActorsBulk", "Spawn Actors"));
+
+	TArray<FString> SpawnedNames;
+	int32 FailedCount = 0;
+	for (int32 i = 0; i < Transforms.Num(); ++i)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		// Defer construction so the mesh is in place before construction scripts run
+		SpawnParams.bDeferConstruction = true;
+
+		AActor* Actor = World->SpawnActor<AActor>(ActorClass, Transforms[i], SpawnParams);
+		if (!Actor)
+		{
+			FailedCount++;
+			continue;
+		}
+
+		if (Mesh)
+		{
+			if (AStaticMeshActor* MeshActor = Cast<AStaticMeshActor>(Actor))
+			{
+				MeshActor->GetStaticMeshComponent()->SetStaticMesh(Mesh);
+			}
+		}
+		Actor->FinishSpawning(Transforms[i]);
+
+		if (!LabelPrefix.IsEmpty())
+		{
+			Actor->SetActorLabel(FString::Printf(TEXT("%s_%d"), *LabelPrefix, i + 1));
+		}
+		if (!Folder.IsEmpty())
+		{
+			Actor->SetFolderPath(FName(*Folder));
+		}
+		SpawnedNames.Add(Actor->GetName());
+	}
+
+	MarkWorldDirty(World);
+
+	TArray<FString> ListedNames(SpawnedNames.GetData(), FMath::Min(SpawnedNames.Num(), MaxListedActors));
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetStringField(TEXT("actorClass"), ActorClass->GetName());
+	ResultData->SetNumberField(TEXT("count"), SpawnedNames.Num());
+	ResultData->SetArrayField(TEXT("actors"), StringArrayToJsonArray(ListedNames));
+	ResultData->SetBoolField(TEXT("truncated"), SpawnedNames.Num() > ListedNames.Num());
+	if (FailedCount > 0)
+	{
+		ResultData->SetNumberField(TEXT("failed"), FailedCount);
+	}
+
+	FString Message = FString::Printf(TEXT("Spawned %d actors of class '%s'"), SpawnedNames.Num(), *ActorClass->GetName());
+	if (FailedCount > 0)
+	{
+		Message += FString::Printf(TEXT(" (%d failed)"), FailedCount);
+	}
+
+	return FMCPToolResult::Success(Message, ResultData);
+}
+
+bool FMCPTool_SpawnActorsBulk::BuildTransforms(UWorld* World, const TSharedRef<FJsonObject>& Params, int32 MaxCount,
+	TArray<FTransform>& OutTransforms, TOptional<FMCPToolResult>& OutError) const
+{
+	FRandomStream Random(ExtractOptionalNumber<int32>(Params, TEXT("seed"), 0));
+
+	const TArray<TSharedPtr<FJsonValue>>* TransformsArray;
+	const FString Pattern = ExtractOptionalString(Params, TEXT("pattern")).ToLower();
+
+	if (Params->TryGetArrayField(TEXT("transforms"), TransformsArray))
+	{
+		if (!Pattern.IsEmpty())
+		{
+			OutError = FMCPToolResult::Error(TEXT("Provide either 'transforms' or 'pattern', not both"));
+			return false;
+		}
+		if (TransformsArray->Num() > MaxCount)
+		{
+			OutError = FMCPToolResult::Error(FString::Printf(
+				TEXT("Too many transforms: %d (max %d)"), TransformsArray->Num(), MaxCount));
+			return false;
+		}
+
+		for (const TSharedPtr<FJsonValue>& Value : *TransformsArray)
+		{
+			const TSharedPtr<FJsonObject>* EntryObj;
+			if (!Value.IsValid() || !Value->TryGetObject(EntryObj) || !EntryObj->IsValid())
+			{
+				OutError = FMCPToolResult::Error(TEXT("Each transform must be an object {location, rotation, scale}"));
+				return false;
+			}
+			const TSharedRef<FJsonObject> Entry = EntryObj->ToSharedRef();
+			OutTransforms.Emplace(
+				ExtractRotatorParam(Entry, TEXT("rotation")),
+				ExtractVectorParam(Entry, TEXT("location")),
+				ExtractScaleParam(Entry, TEXT("scale")));
+		}
+	}
+	else if (Pattern == TEXT("grid"))
+	{
+		if (!BuildGrid(Params, MaxCount, OutTransforms, OutError))
+		{
+			return false;
+		}
+	}
+	else if (Pattern == TEXT("scatter"))
+	{
+		if (!BuildScatter(Params, MaxCount, Random, OutTransforms, OutError))
+		{
+			return false;
+		}
+	}
+	else if (Pattern == TEXT("spline"))
+	{
+		if (!BuildSpline(World, Params, MaxCount, OutTransforms, OutError))
+		{
+			return false;
+		}
+	}
+	else if (Pattern.IsEmpty())
+	{
+		OutError = FMCPToolResult::Error(TEXT("Provide 'transforms' or 'pattern' ('grid', 'scatter', 'spline')"));
+		return false;
+	}
+	else
+	{
+		OutError = FMCPToolResult::Error(FString::Printf(
+			TEXT("Unknown pattern: '%s'. Valid: grid, scatter, spline"), *Pattern));
+		return false;
+	}
+
+	// Base rotation/scale and jitter only apply to generated placements
+	if (Pattern.IsEmpty())
+	{
+		return true;
+	}
+
+	const FRotator BaseRotation = ExtractRotatorParam(Params, TEXT("rotation"));
+	const FVector BaseScale = ExtractScaleParam(Params, TEXT("scale"));
+	const bool bRandomYaw = ExtractOptionalBool(Params, TEXT("random_yaw"), false);
+	const double ScaleJitter = FMath::Clamp(ExtractOptionalNumber<double>(Params, TEXT("scale_jitter"), 0.0), 0.0, 1.0);
+
+	for (FTransform& Transform : OutTransforms)
+	{
+		FRotator Rotation = (Transform.GetRotation() * BaseRotation.Quaternion()).Rotator();
+		if (bRandomYaw)
+		{
+			Rotation.Yaw += Random.FRandRange(0.0, 360.0);
+		}
+		Transform.SetRotation(Rotation.Quaternion());
+
+		const double ScaleFactor = ScaleJitter > 0.0 ? Random.FRandRange(1.0 - ScaleJitter, 1.0 + ScaleJitter) : 1.0;
+		Transform.SetScale3D(BaseScale * ScaleFactor);
+	}
+
+	return true;
+}
+
+bool FMCPTool_SpawnActorsBulk::BuildGrid(const TSharedRef<FJsonObject>& Params, int32 MaxCount,
+	TArray<FTransform>& OutTransforms, TOptional<FMCPToolResult>& OutError) const
+{
+	if (!HasVectorParam(Params, TEXT("grid_count")) || !HasVectorParam(Params, TEXT("spacing")))
+	{
+		OutError = FMCPToolResult::Error(TEXT("grid pattern requires 'grid_count' and 'spacing'"));
+		return false;
+	}
+
+	const FVector Origin = ExtractVectorParam(Params, TEXT("origin"));
+	const FVector Spacing = ExtractVectorParam(Params, TEXT("spacing"));
+	const FVector CountParam = ExtractVectorParam(Params, TEXT("grid_count"), FVector::OneVector);
+	const FIntVector Count(
+		FMath::Max(1, FMath::RoundToInt(CountParam.X)),
+		FMath::Max(1, FMath::RoundToInt(CountParam.Y)),
+		FMath::Max(1, FMath::RoundToInt(CountParam.Z)));
+
+	const int64 Total = int64(Count.X) * Count.Y * Count.Z;
+	if (Total > MaxCount)
+	{
+		OutError = FMCPToolResult::Error(FString::Printf(TEXT("Grid has %lld cells (max %d)"), Total, MaxCount));
+		return false;
+	}
+
+	OutTransforms.Reserve(static_cast<int32>(Total));
+	for (int32 Z = 0; Z < Count.Z; ++Z)
+	{
+		for (int32 Y = 0; Y < Count.Y; ++Y)
+		{
+			for (int32 X = 0; X < Count.X; ++X)
+			{
+				OutTransforms.Emplace(Origin + FVector(X, Y, Z) * Spacing);
+			}
+		}
+	}
+	return true;
+}
+
+bool FMCPTool_SpawnActorsBulk::BuildScatter(const TSharedRef<FJsonObject>& Params, int32 MaxCount, FRandomStream& Random,
+	TArray<FTransform>& OutTransforms, TOptional<FMCPToolResult>& OutError) const
+{
+	if (!HasVectorParam(Params, TEXT("bounds_min")) || !HasVectorParam(Params, TEXT("bounds_max")))
+	{
+		OutError = FMCPToolResult::Error(TEXT("scatter pattern requires 'bounds_min' and 'bounds_max'"));
+		return false;
+	}
+
+	const int32 Count = ExtractOptionalNumber<int32>(Params, TEXT("count"), 0);
+	if (Count < 1 || Count > MaxCount)
+	{
+		OutError = FMCPToolResult::Error(FString::Printf(TEXT("scatter pattern requires 'count' between 1 and %d"), MaxCount));
+		return false;
+	}
+
+	const FVector A = ExtractVectorParam(Params, TEXT("bounds_min"));
+	const FVector B = ExtractVectorParam(Params, TEXT("bounds_max"));
+	const FVector Min = A.ComponentMin(B);
+	const FVector Max = A.ComponentMax(B);
+
+	OutTransforms.Reserve(Count);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		OutTransforms.Emplace(FVector(
+			Random.FRandRange(Min.X, Max.X),
+			Random.FRandRange(Min.Y, Max.Y),
+			Random.FRandRange(Min.Z, Max.Z)));
+	}
+	return true;
+}
+
+bool FMCPTool_SpawnActorsBulk::BuildSpline(UWorld* World, const TSharedRef<FJsonObject>& Params, int32 MaxCount,
+	TArray<FTransform>& OutTransforms, TOptional<FMCPToolResult>& OutError) const
+{
+	FString SplineActorName;
+	if (!ExtractRequiredString(Params, TEXT("spline_actor"), SplineActorName, OutError) ||
+		!ValidateActorNameParam(SplineActorName, OutError))
+	{
+		return false;
+	}
+
+	AActor* SplineActor = FindActorByNameOrLabel(World, SplineActorName);
+	if (!SplineActor)
+	{
+		OutError = ActorNotFoundError(SplineActorName);
+		return false;
+	}
+
+	const USplineComponent* Spline = SplineActor->FindComponentByClass<USplineComponent>();
+	if (!Spline)
+	{
+		OutError = FMCPToolResult::Error(FString::Printf(TEXT("Actor '%s' has no spline component"), *SplineActorName));
+		return false;
+	}
+
+	const int32 Count = ExtractOptionalNumber<int32>(Params, TEXT("count"), 0);
+	if (Count < 1 || Count > MaxCount)
+	{
+		OutError = FMCPToolResult::Error(FString::Printf(TEXT("spline pattern requires 'count' between 1 and %d"), MaxCount));
+		return false;
+	}
+
+	const bool bAlign = ExtractOptionalBool(Params, TEXT("align_to_spline"), true);
+	const float Length = Spline->GetSplineLength();
+	// Open splines place both end points; closed loops would double up the seam
+	const int32 Segments = Spline->IsClosedLoop() ? Count : FMath::Max(1, Count - 1);
+
+	OutTransforms.Reserve(Count);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const float Distance = Count == 1 ? 0.0f : Length * i / Segments;
+		const FVector Location = Spline->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+		const FRotator Rotation = bAlign
+			? Spline->GetRotationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World)
+			: FRotator::ZeroRotator;
+		OutTransforms.Emplace(Rotation, Location);
+	}
+	return true;
+}
+
+FMCPToolResult FMCPTool_SpawnActorsBulk::SpawnInstanced(UWorld* World, UStaticMesh* Mesh, const TArray<FTransform>& Transforms,
+	const FString& Label, const FString& Folder)
+{
+	const FScopedTransaction Transaction(NSLOCTEXT("UnrealClaude", "SpawnInstancedMesh", "Spawn Instanced Mesh"));
+
+	// Anchor the host at the placements' centroid so its pivot is near the instances
+	FVector Centroid = FVector::ZeroVector;
+	for (const FTransform& Transform : Transforms)
+	{
+		Centroid += Transform.GetLocation();
+	}
+	Centroid /= Transforms.Num();
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	AActor* Host = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Centroid), SpawnParams);
+	if (!Host)
+	{
+		return FMCPToolResult::Error(TEXT("Failed to spawn instanced mesh actor"));
+	}
+
+	USceneComponent* Root = NewObject<USceneComponent>(Host, TEXT("Root"), RF_Transactional);
+	Root->SetMobility(EComponentMobility::Static);
+	Host->SetRootComponent(Root);
+	Host->AddInstanceComponent(Root);
+	Root->RegisterComponent();
+	Root->SetWorldLocation(Centroid);
+
+	UHierarchicalInstancedStaticMeshComponent* Instances = NewObject<UHierarchicalInstancedStaticMeshComponent>(
+		Host, TEXT("Instances"), RF_Transactional);
+	Instances->SetMobility(EComponentMobility::Static);
+	Instances->SetStaticMesh(Mesh);
+	Instances->SetupAttachment(Root);
+	Host->AddInstanceComponent(Instances);
+	Instances->RegisterComponent();
+
+	// One bulk add builds the cluster tree once instead of per instance
+	Instances->AddInstances(Transforms, false, true);
+
+	Host->SetActorLabel(Label.IsEmpty() ? FString::Printf(TEXT("%s_Instances"), *Mesh->GetName()) : Label);
+	if (!Folder.IsEmpty())
+	{
+		Host->SetFolderPath(FName(*Folder));
+	}
+
+	MarkWorldDirty(World);
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetStringField(TEXT("actorName"), Host->GetName());
+	ResultData->SetStringField(TEXT("actorLabel"), Host->GetActorLabel());
+	ResultData->SetStringField(TEXT("mesh"), Mesh->GetPathName());
+	ResultData->SetNumberField(TEXT("instanceCount"), Instances->GetInstanceCount());
+	ResultData->SetObjectField(TEXT("location"), UnrealClaudeJsonUtils::VectorToJson(Centroid));
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Spawned '%s' with %d instances of '%s'"),
+			*Host->GetActorLabel(), Instances->GetInstanceCount(), *Mesh->GetName()),
+		ResultData);
+}
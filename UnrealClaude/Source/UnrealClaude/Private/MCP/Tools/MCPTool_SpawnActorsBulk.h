@@ -0,0 +1,85 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCP/MCPToolBase.h"
+
+class UStaticMesh;
+
+/**
+ * MCP Tool: Spawn many actors (or mesh instances) in one call
+ *
+ * All spawns share one undo transaction. With 'instanced', a plain static
+ * mesh is placed as instances of a single Hierarchical Instanced Static Mesh
+ * component instead of one actor per placement.
+ */
+class FMCPTool_SpawnActorsBulk : public FMCPToolBase
+{
+public:
+	virtual FMCPToolInfo GetInfo() const override
+	{
+		FMCPToolInfo Info;
+		Info.Name = TEXT("spawn_actors_bulk");
+		Info.Description = TEXT(
+			"Spawn many actors in one call (forests, crowds, props). One undo step for the whole batch.\n\n"
+			"Placements come from 'transforms' [{location, rotation, scale}] or a 'pattern':\n"
+			"- 'grid': origin, grid_count {x, y, z}, spacing {x, y, z}\n"
+			"- 'scatter': bounds_min, bounds_max, count, seed (random points inside the box)\n"
+			"- 'spline': spline_actor, count (evenly spaced along the actor's spline), align_to_spline\n\n"
+			"'rotation' and 'scale' set the base for pattern placements; random_yaw and scale_jitter add variation.\n\n"
+			"For plain static meshes (class 'StaticMeshActor' with 'mesh'), set instanced=true to create ONE actor "
+			"with a Hierarchical Instanced Static Mesh component instead of N actors - much cheaper for "
+			"thousands of copies.\n\n"
+			"Examples:\n"
+			"- 10x10 trees: class='StaticMeshActor', mesh='/Game/Env/SM_Tree', pattern='grid', "
+			"grid_count={x:10,y:10,z:1}, spacing={x:500,y:500,z:0}, random_yaw=true, instanced=true\n"
+			"- Lights along a path: class='PointLight', pattern='spline', spline_actor='Road', count=20\n\n"
+			"Returns: count, actor names (first 50), or the instanced actor and its instance count."
+		);
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("class"), TEXT("string"), TEXT("Class path to spawn (e.g., 'StaticMeshActor', 'PointLight', '/Game/BP_Tree')"), true),
+			FMCPToolParameter(TEXT("mesh"), TEXT("string"), TEXT("Static mesh asset path for StaticMeshActor or instanced placement"), false),
+			FMCPToolParameter(TEXT("transforms"), TEXT("array"), TEXT("Explicit placements [{location, rotation, scale}]"), false),
+			FMCPToolParameter(TEXT("pattern"), TEXT("string"), TEXT("Procedural placement: 'grid', 'scatter', or 'spline'"), false),
+			FMCPToolParameter(TEXT("origin"), TEXT("object"), TEXT("Grid origin {x, y, z} (grid)"), false),
+			FMCPToolParameter(TEXT("grid_count"), TEXT("object"), TEXT("Cells per axis {x, y, z} (grid)"), false),
+			FMCPToolParameter(TEXT("spacing"), TEXT("object"), TEXT("Distance between cells {x, y, z} (grid)"), false),
+			FMCPToolParameter(TEXT("bounds_min"), TEXT("object"), TEXT("Scatter box minimum corner {x, y, z} (scatter)"), false),
+			FMCPToolParameter(TEXT("bounds_max"), TEXT("object"), TEXT("Scatter box maximum corner {x, y, z} (scatter)"), false),
+			FMCPToolParameter(TEXT("spline_actor"), TEXT("string"), TEXT("Actor with a spline component (spline)"), false),
+			FMCPToolParameter(TEXT("count"), TEXT("number"), TEXT("Number of placements (scatter, spline)"), false),
+			FMCPToolParameter(TEXT("align_to_spline"), TEXT("boolean"), TEXT("Rotate placements to follow the spline (spline)"), false, TEXT("true")),
+			FMCPToolParameter(TEXT("rotation"), TEXT("object"), TEXT("Base rotation {pitch, yaw, roll} for pattern placements"), false),
+			FMCPToolParameter(TEXT("scale"), TEXT("object"), TEXT("Base scale {x, y, z} for pattern placements"), false),
+			FMCPToolParameter(TEXT("random_yaw"), TEXT("boolean"), TEXT("Randomize yaw of every placement"), false, TEXT("false")),
+			FMCPToolParameter(TEXT("scale_jitter"), TEXT("number"), TEXT("Random uniform scale variation, 0-1 (0.2 = +/-20%)"), false, TEXT("0")),
+			FMCPToolParameter(TEXT("seed"), TEXT("number"), TEXT("Random seed for scatter/random_yaw/scale_jitter"), false, TEXT("0")),
+			FMCPToolParameter(TEXT("instanced"), TEXT("boolean"), TEXT("Place a static mesh as instances on one actor instead of N actors"), false, TEXT("false")),
+			FMCPToolParameter(TEXT("label_prefix"), TEXT("string"), TEXT("Label prefix; actors are labeled <prefix>_1, <prefix>_2, ..."), false),
+			FMCPToolParameter(TEXT("folder"), TEXT("string"), TEXT("Outliner folder for the spawned actors"), false)
+		};
+		Info.Annotations = FMCPToolAnnotations::Modifying();
+		return Info;
+	}
+
+	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+
+private:
+	/** Build placements from 'transforms' or 'pattern' */
+	bool BuildTransforms(UWorld* World, const TSharedRef<FJsonObject>& Params, int32 MaxCount,
+		TArray<FTransform>& OutTransforms, TOptional<FMCPToolResult>& OutError) const;
+
+	bool BuildGrid(const TSharedRef<FJsonObject>& Params, int32 MaxCount, TArray<FTransform>& OutTransforms,
+		TOptional<FMCPToolResult>& OutError) const;
+
+	bool BuildScatter(const TSharedRef<FJsonObject>& Params, int32 MaxCount, FRandomStream& Random,
+		TArray<FTransform>& OutTransforms, TOptional<FMCPToolResult>& OutError) const;
+
+	bool BuildSpline(UWorld* World, const TSharedRef<FJsonObject>& Params, int32 MaxCount,
+		TArray<FTransform>& OutTransforms, TOptional<FMCPToolResult>& OutError) const;
+
+	/** Spawn one actor carrying a HISM component with an instance per transform */
+	FMCPToolResult SpawnInstanced(UWorld* World, UStaticMesh* Mesh, const TArray<FTransform>& Transforms,
+		const FString& Label, const FString& Folder);
+};
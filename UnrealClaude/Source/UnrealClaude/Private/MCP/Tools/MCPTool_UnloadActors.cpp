@@ -0,0 +1,95 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTool_UnloadActors.h"
+#include "MCP/MCPParamValidator.h"
+#include "MCP/MCPWorldPartitionActors.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "UObject/Package.h"
+
+FMCPToolResult FMCPTool_UnloadActors::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	UWorld* World = nullptr;
+	if (auto Error = ValidateEditorContext(World))
+	{
+		return Error.GetValue();
+	}
+
+	if (!FMCPWorldPartitionActors::IsPartitioned(World))
+	{
+		return FMCPToolResult::Error(TEXT("The current level does not use World Partition"));
+	}
+
+	const bool bDiscardChanges = ExtractOptionalBool(Params, TEXT("discard_changes"), false);
+
+	TArray<FGuid> PinnedGuids;
+	FMCPWorldPartitionActors::GetPinnedActors(World, PinnedGuids);
+
+	// Requested actors are matched against the pinned set by name or label
+	TArray<TSharedPtr<FJsonValue>> NotPinned;
+	TSet<FGuid> Requested;
+	const TArray<TSharedPtr<FJsonValue>>* ActorsArray = nullptr;
+	const bool bFiltered = Params->TryGetArrayField(TEXT("actors"), ActorsArray);
+	if (bFiltered)
+	{
+		for (const TSharedPtr<FJsonValue>& Value : *ActorsArray)
+		{
+			FString ActorName;
+			FString ValidationError;
+			if (!Value.IsValid() || !Value->TryGetString(ActorName) || !FMCPParamValidator::ValidateActorName(ActorName, ValidationError))
+			{
+				return FMCPToolResult::Error(ValidationError.IsEmpty() ? TEXT("'actors' must be an array of actor names") : ValidationError);
+			}
+
+			AActor* Actor = FindActorByNameOrLabel(World, ActorName);
+			const FGuid* Guid = Actor ? PinnedGuids.FindByKey(Actor->GetActorGuid()) : nullptr;
+			if (Guid)
+			{
+				Requested.Add(*Guid);
+			}
+			else
+			{
+				NotPinned.Add(MakeShared<FJsonValueString>(ActorName));
+			}
+		}
+	}
+
+	TArray<FGuid> ToUnpin;
+	TArray<TSharedPtr<FJsonValue>> Unloaded;
+	TArray<TSharedPtr<FJsonValue>> Unsaved;
+	for (const FGuid& Guid : PinnedGuids)
+	{
+		if (bFiltered && !Requested.Contains(Guid))
+		{
+			continue;
+		}
+
+		FMCPUnloadedActorInfo Info;
+		AActor* Actor = nullptr;
+		FMCPWorldPartitionActors::FindByGuid(World, Guid, Info, Actor);
+		const FString Name = Actor ? Actor->GetName() : Info.Name;
+
+		// Actors are saved in their own package, so a dirty package means edits unloading would drop
+		if (!bDiscardChanges && Actor && Actor->GetPackage()->IsDirty())
+		{
+			Unsaved.Add(MakeShared<FJsonValueString>(Name));
+			continue;
+		}
+
+		ToUnpin.Add(Guid);
+		Unloaded.Add(MakeShared<FJsonValueString>(Name));
+	}
+
+	const int32 UnpinnedCount = FMCPWorldPartitionActors::UnpinActors(World, ToUnpin);
+
+	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+	ResultData->SetArrayField(TEXT("unloaded"), Unloaded);
+	ResultData->SetArrayField(TEXT("unsaved"), Unsaved);
+	ResultData->SetArrayField(TEXT("notPinned"), NotPinned);
+	ResultData->SetNumberField(TEXT("count"), UnpinnedCount);
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Unloaded %d actors (%d kept for unsaved changes)"), UnpinnedCount, Unsaved.Num()),
+		ResultData
+	);
+}
@@ -0,0 +1,39 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCP/MCPToolBase.h"
+
+/**
+ * MCP Tool: Release World Partition actors that tools loaded for editing
+ *
+ * Tools that modify an unloaded actor pin it so it stays loaded. This
+ * unpins them again so their cells can unload. Actors with unsaved changes
+ * are kept loaded unless discard_changes is set.
+ */
+class FMCPTool_UnloadActors : public FMCPToolBase
+{
+public:
+	virtual FMCPToolInfo GetInfo() const override
+	{
+		FMCPToolInfo Info;
+		Info.Name = TEXT("unload_actors");
+		Info.Description = TEXT(
+			"On World Partition maps, unload actors that other tools loaded (pinned) to modify them.\n\n"
+			"Without 'actors', every actor pinned by tools in the current level is released. "
+			"Actors the user pinned in the outliner are never touched. "
+			"Actors with unsaved changes stay loaded and are listed under 'unsaved'; save them with save_assets first, "
+			"or pass discard_changes=true.\n\n"
+			"Returns: unloaded actor names, unsaved actor names, and actors not pinned by tools."
+		);
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("actors"), TEXT("array"), TEXT("Actor names or labels to unload (default: all actors pinned by tools)"), false),
+			FMCPToolParameter(TEXT("discard_changes"), TEXT("boolean"), TEXT("Also unload actors with unsaved changes"), false, TEXT("false"))
+		};
+		Info.Annotations = FMCPToolAnnotations::Modifying();
+		return Info;
+	}
+
+	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+};
@@ -7,6 +7,7 @@
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "EngineUtils.h"
+#include "MCP/MCPWorldPartitionActors.h"
 #include "Misc/Paths.h"
 #include "Misc/FileHelper.h"
 #include "HAL/FileManager.h"
@@ -54,6 +55,7 @@ void FProjectContextManager::RefreshContext()
 	CachedContext.SourceFiles.Empty();
 	CachedContext.UClasses.Empty();
 	CachedContext.LevelActors.Empty();
+	CachedContext.UnloadedActorCount = 0;
 
 	// Gather all context
 	ScanSourceFiles();
@@ -262,6 +264,9 @@ void FProjectContextManager::GatherLevelActors()
 
 		CachedContext.LevelActors.Add(ActorInfo);
 	}
+
+	// Counted from descriptors; listing them would mean loading their cells
+	CachedContext.UnloadedActorCount = FMCPWorldPartitionActors::CountUnloaded(World);
 }
 
 void FProjectContextManager::CountAssets()
@@ -310,7 +315,15 @@ FString FProjectContextManager::FormatContextForPrompt() const
 	Context += FString::Printf(TEXT("C++ Classes: %d\n"), CachedContext.CppClassCount);
 	Context += FString::Printf(TEXT("Blueprints: %d\n"), CachedContext.BlueprintCount);
 	Context += FString::Printf(TEXT("Total Assets: %d\n"), CachedContext.AssetCount);
-	Context += FString::Printf(TEXT("Level Actors: %d\n\n"), CachedContext.LevelActors.Num());
+	if (CachedContext.UnloadedActorCount > 0)
+	{
+		Context += FString::Printf(TEXT("Level Actors: %d loaded, %d in unloaded World Partition cells (get_level_actors include_unloaded=true)\n\n"),
+			CachedContext.LevelActors.Num(), CachedContext.UnloadedActorCount);
+	}
+	else
+	{
+		Context += FString::Printf(TEXT("Level Actors: %d\n\n"), CachedContext.LevelActors.Num());
+	}
 
 	// List UCLASS types (limit to avoid prompt bloat)
 	if (CachedContext.UClasses.Num() > 0)
@@ -70,6 +70,9 @@ struct FProjectContext
 	/** Actors in the current level */
 	TArray<FLevelActorInfo> LevelActors;
 
+	/** Actors in unloaded World Partition cells (not listed in LevelActors) */
+	int32 UnloadedActorCount;
+
 	/** Current level name */
 	FString CurrentLevelName;
 
@@ -86,7 +89,8 @@ struct FProjectContext
 	FDateTime GatheredAt;
 
 	FProjectContext()
-		: AssetCount(0)
+		: UnloadedActorCount(0)
+		, AssetCount(0)
 		, BlueprintCount(0)
 		, CppClassCount(0)
 	{}
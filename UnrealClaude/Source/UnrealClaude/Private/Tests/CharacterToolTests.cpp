@@ -9,6 +9,9 @@
 #include "Misc/AutomationTest.h"
 #include "MCP/MCPToolRegistry.h"
 #include "Dom/JsonObject.h"
+#include "CharacterDataTypes.h"
+#include "AssetRegistry/AssetData.h"
+#include "UObject/Package.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -396,6 +399,41 @@ bool FMCPTool_CharacterData_ToolAnnotations::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_CharacterData_RegistryTags,
+	"UnrealClaude.MCP.Tools.CharacterData.RegistryTags",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_CharacterData_RegistryTags::RunTest(const FString& Parameters)
+{
+	UCharacterConfigDataAsset* Config = NewObject<UCharacterConfigDataAsset>(GetTransientPackage());
+	Config->ConfigId = TEXT("Hero_01");
+	Config->DisplayName = TEXT("Hero");
+	Config->GameplayTags = { TEXT("Character.Player"), TEXT("Class.Warrior") };
+	Config->bIsPlayerCharacter = true;
+
+	// FAssetData built from a loaded object collects the same tags the registry stores on save
+	const FAssetData AssetData(Config);
+
+	FString Value;
+	TestTrue("ConfigId tag present", AssetData.GetTagValue(UCharacterConfigDataAsset::ConfigIdTag, Value));
+	TestEqual("ConfigId tag value", Value, FString(TEXT("Hero_01")));
+	TestTrue("DisplayName tag present", AssetData.GetTagValue(UCharacterConfigDataAsset::DisplayNameTag, Value));
+	TestEqual("DisplayName tag value", Value, FString(TEXT("Hero")));
+	TestTrue("GameplayTags tag present", AssetData.GetTagValue(UCharacterConfigDataAsset::GameplayTagsTag, Value));
+
+	TArray<FString> Tags;
+	Value.ParseIntoArray(Tags, UCharacterConfigDataAsset::GameplayTagsSeparator, true);
+	TestEqual("Both gameplay tags listed", Tags.Num(), 2);
+	TestTrue("Player tag listed", Tags.Contains(TEXT("Character.Player")));
+
+	TestTrue("IsPlayerCharacter tag present", AssetData.GetTagValue(UCharacterConfigDataAsset::IsPlayerCharacterTag, Value));
+	TestTrue("IsPlayerCharacter tag value", Value.ToBool());
+
+	return true;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
 	FMCPToolRegistry_CharacterToolsRegistered,
 	"UnrealClaude.MCP.Registry.CharacterToolsRegistered",
@@ -2,7 +2,7 @@
 
 /**
  * Integration tests for MCP Asset Management Tools
- * Tests asset search, dependency analysis, and referencer discovery
+ * Tests asset search, dependency analysis, referencer discovery and graph traversal
  */
 
 #include "CoreMinimal.h"
@@ -11,6 +11,8 @@
 #include "MCP/Tools/MCPTool_AssetSearch.h"
 #include "MCP/Tools/MCPTool_AssetDependencies.h"
 #include "MCP/Tools/MCPTool_AssetReferencers.h"
+#include "MCP/Tools/MCPTool_AssetGraph.h"
+#include "MCP/Tools/MCPTool_AnalyzeHardReferences.h"
 #include "Dom/JsonObject.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 
@@ -443,6 +445,152 @@ bool FMCPTool_AssetSearch_ResponseFormat::RunTest(const FString& Parameters)
 	return true;
 }
 
+// ===== Asset Graph Integration Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_AssetGraph_Validation,
+	"UnrealClaude.MCP.Tools.AssetGraph.Validation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_AssetGraph_Validation::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+	IMCPTool* Tool = Registry.FindTool(TEXT("asset_graph"));
+	TestNotNull("Tool should exist", Tool);
+	if (!Tool) return false;
+
+	// Missing asset_path
+	{
+		TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+		FMCPToolResult Result = Tool->Execute(Params);
+		TestFalse("Missing asset_path should fail", Result.bSuccess);
+	}
+
+	// Unknown direction
+	{
+		TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+		Params->SetStringField(TEXT("asset_path"), TEXT("/Engine/BasicShapes/Cube"));
+		Params->SetStringField(TEXT("direction"), TEXT("sideways"));
+		FMCPToolResult Result = Tool->Execute(Params);
+		TestFalse("Unknown direction should fail", Result.bSuccess);
+	}
+
+	// Non-existent root
+	{
+		TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+		Params->SetStringField(TEXT("asset_path"), TEXT("/Game/NonExistent/Asset12345"));
+		FMCPToolResult Result = Tool->Execute(Params);
+		TestFalse("Non-existent asset should fail", Result.bSuccess);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_AssetGraph_EngineDependencies,
+	"UnrealClaude.MCP.Tools.AssetGraph.EngineDependencies",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_AssetGraph_EngineDependencies::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+	IMCPTool* Tool = Registry.FindTool(TEXT("asset_graph"));
+	TestNotNull("Tool should exist", Tool);
+	if (!Tool) return false;
+
+	// The engine cube mesh depends on at least its default material
+	TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+	Params->SetStringField(TEXT("asset_path"), TEXT("/Engine/BasicShapes/Cube.Cube"));
+	Params->SetBoolField(TEXT("include_engine"), true);
+	Params->SetNumberField(TEXT("max_depth"), 2);
+
+	FMCPToolResult Result = Tool->Execute(Params);
+	TestTrue("Traversal should succeed", Result.bSuccess);
+	if (!Result.bSuccess || !Result.Data.IsValid()) return false;
+
+	TestEqual("Root should be the package", Result.Data->GetStringField(TEXT("root")), FString(TEXT("/Engine/BasicShapes/Cube")));
+
+	const TSharedPtr<FJsonObject>* Totals = nullptr;
+	TestTrue("Should have totals", Result.Data->TryGetObjectField(TEXT("totals"), Totals));
+	if (Totals)
+	{
+		TestTrue("Closure should include the root", (*Totals)->GetIntegerField(TEXT("nodes")) >= 1);
+		TestTrue("Hard size should not exceed total size",
+			(*Totals)->GetNumberField(TEXT("hardSize")) <= (*Totals)->GetNumberField(TEXT("totalSize")));
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* Nodes = nullptr;
+	TestTrue("Should have nodes", Result.Data->TryGetArrayField(TEXT("nodes"), Nodes));
+	if (Nodes)
+	{
+		for (const TSharedPtr<FJsonValue>& Node : *Nodes)
+		{
+			const TSharedPtr<FJsonObject>& NodeObject = Node->AsObject();
+			TestTrue("Each node should name its parent", NodeObject->HasField(TEXT("via")));
+			TestTrue("Depth should be within max_depth", NodeObject->GetIntegerField(TEXT("depth")) <= 2);
+		}
+	}
+
+	return true;
+}
+
+// ===== Hard Reference Analysis Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_AnalyzeHardReferences_RetainedSizes,
+	"UnrealClaude.MCP.Tools.AnalyzeHardReferences.RetainedSizes",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_AnalyzeHardReferences_RetainedSizes::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+	IMCPTool* Tool = Registry.FindTool(TEXT("analyze_hard_references"));
+	TestNotNull("Tool should exist", Tool);
+	if (!Tool) return false;
+
+	// Non-existent root
+	{
+		TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+		Params->SetStringField(TEXT("asset_path"), TEXT("/Game/NonExistent/Asset12345"));
+		FMCPToolResult Result = Tool->Execute(Params);
+		TestFalse("Non-existent asset should fail", Result.bSuccess);
+	}
+
+	TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+	Params->SetStringField(TEXT("asset_path"), TEXT("/Engine/BasicShapes/Cube"));
+	Params->SetBoolField(TEXT("include_engine"), true);
+
+	FMCPToolResult Result = Tool->Execute(Params);
+	TestTrue("Analysis should succeed", Result.bSuccess);
+	if (!Result.bSuccess || !Result.Data.IsValid()) return false;
+
+	const TSharedPtr<FJsonObject>* Totals = nullptr;
+	TestTrue("Should have totals", Result.Data->TryGetObjectField(TEXT("totals"), Totals));
+	const double HardSize = Totals ? (*Totals)->GetNumberField(TEXT("hardSize")) : 0.0;
+
+	const TArray<TSharedPtr<FJsonValue>>* Candidates = nullptr;
+	TestTrue("Should have candidates", Result.Data->TryGetArrayField(TEXT("candidates"), Candidates));
+	if (Candidates)
+	{
+		double PreviousRetained = TNumericLimits<double>::Max();
+		for (const TSharedPtr<FJsonValue>& Candidate : *Candidates)
+		{
+			const TSharedPtr<FJsonObject>& CandidateObject = Candidate->AsObject();
+			const double Retained = CandidateObject->GetNumberField(TEXT("retainedSize"));
+			TestTrue("Retained size should include the package itself", Retained >= CandidateObject->GetNumberField(TEXT("size")));
+			TestTrue("Retained size should not exceed the closure", Retained <= HardSize);
+			TestTrue("Candidates should be sorted by retained size", Retained <= PreviousRetained);
+			TestTrue("Every listed package has a hard referencer", CandidateObject->GetIntegerField(TEXT("referencerCount")) >= 1);
+			PreviousRetained = Retained;
+		}
+	}
+
+	return true;
+}
+
 // ===== Combined Tool Tests =====
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
@@ -456,7 +604,7 @@ bool FMCPTool_Assets_ToolAnnotationsCorrect::RunTest(const FString& Parameters)
 	FMCPToolRegistry Registry;
 
 	// All asset tools should be read-only
-	TArray<FString> AssetTools = { TEXT("asset_search"), TEXT("asset_dependencies"), TEXT("asset_referencers") };
+	TArray<FString> AssetTools = { TEXT("asset_search"), TEXT("asset_dependencies"), TEXT("asset_referencers"), TEXT("asset_graph"), TEXT("analyze_hard_references") };
 
 	for (const FString& ToolName : AssetTools)
 	{
@@ -9,12 +9,49 @@
 #include "Misc/AutomationTest.h"
 #include "MCP/MCPToolRegistry.h"
 #include "MCP/MCPParamValidator.h"
+#include "MCP/MCPActorIndex.h"
+#include "UnrealClaudeConstants.h"
+#include "MCP/MCPCursorStore.h"
+#include "MCP/MCPFieldSet.h"
+#include "MCP/MCPLevelJournal.h"
+#include "MCP/MCPLevelSnapshot.h"
+#include "MCP/MCPPropertyPath.h"
+#include "MCP/MCPAssetNameIndex.h"
+#include "MCP/MCPClassResolver.h"
+#include "MCP/MCPAssetPreloader.h"
+#include "MCP/MCPBlueprintEditSession.h"
+#include "MCP/MCPWorldPartitionActors.h"
 #include "MCP/Tools/MCPTool_SpawnActor.h"
+#include "MCP/Tools/MCPTool_SpawnActorsBulk.h"
+#include "MCP/Tools/MCPTool_BatchEditActors.h"
 #include "MCP/Tools/MCPTool_DeleteActors.h"
 #include "MCP/Tools/MCPTool_MoveActor.h"
 #include "MCP/Tools/MCPTool_SetProperty.h"
+#include "MCP/Tools/MCPTool_GetProperties.h"
+#include "MCP/Tools/MCPTool_ExportTable.h"
 #include "MCP/Tools/MCPTool_GetLevelActors.h"
+#include "MCP/Tools/MCPTool_QueryActorsSpatial.h"
+#include "MCP/Tools/MCPTool_GetLevelChanges.h"
+#include "MCP/Tools/MCPTool_LevelSnapshot.h"
+#include "MCP/Tools/MCPTool_LevelDiff.h"
+#include "MCP/Tools/MCPTool_LevelRestore.h"
 #include "Dom/JsonObject.h"
+#include "Editor.h"
+#include "EngineUtils.h"
+#include "Misc/Paths.h"
+#include "Engine/Blueprint.h"
+#include "Engine/StaticMeshActor.h"
+#include "BlueprintGraphEditor.h"
+#include "MCP/Tools/MCPTool_CompileBlueprints.h"
+#include "MCP/MCPBlueprintSerializationCache.h"
+#include "BlueprintGraphText.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet/GameplayStatics.h"
+#include "K2Node_CallFunction.h"
+#include "EdGraphSchema_K2.h"
+#include "UObject/Package.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Engine/BlueprintGeneratedClass.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -1975,4 +2012,1414 @@ bool FMCPToolRegistry_EnhancedInputRegistered::RunTest(const FString& Parameters
 	return true;
 }
 
+
+// ===== Actor Index Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPActorIndex_InvalidInputs,
+	"UnrealClaude.MCP.ActorIndex.InvalidInputs",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPActorIndex_InvalidInputs::RunTest(const FString& Parameters)
+{
+	TestNull("Null world should return nullptr", FMCPActorIndex::Get().FindActor(nullptr, TEXT("Anything")));
+
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (!World)
+	{
+		AddWarning(TEXT("No editor world available - skipping world lookups"));
+		return true;
+	}
+
+	TestNull("Empty name should return nullptr", FMCPActorIndex::Get().FindActor(World, FString()));
+	TestNull("Unknown name should return nullptr",
+		FMCPActorIndex::Get().FindActor(World, TEXT("MCP_ActorIndex_Test_NoSuchActor_12345")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPActorIndex_MatchesIteratorLookup,
+	"UnrealClaude.MCP.ActorIndex.MatchesIteratorLookup",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPActorIndex_MatchesIteratorLookup::RunTest(const FString& Parameters)
+{
+	UWorld* World = UWorld::CreateWorld(EWorldType::Editor, false, TEXT("MCPActorIndexTest"));
+	if (!TestNotNull("Test world created", World))
+	{
+		return false;
+	}
+
+	// Shared labels, a label equal to another actor's object name, and two classes to filter on
+	AStaticMeshActor* SharedMesh = World->SpawnActor<AStaticMeshActor>();
+	AActor* SharedPlain = World->SpawnActor<AActor>();
+	AActor* UniquePlain = World->SpawnActor<AActor>();
+	AStaticMeshActor* NameClash = World->SpawnActor<AStaticMeshActor>();
+	if (!TestTrue("Test actors spawned", SharedMesh && SharedPlain && UniquePlain && NameClash))
+	{
+		World->DestroyWorld(false);
+		return false;
+	}
+	SharedMesh->SetActorLabel(TEXT("MCPIndexShared"));
+	SharedPlain->SetActorLabel(TEXT("MCPIndexShared"));
+	UniquePlain->SetActorLabel(TEXT("MCPIndexUnique"));
+	NameClash->SetActorLabel(UniquePlain->GetName());
+
+	// Reference lookup: every acceptable answer, by a full walk (name matches win over labels)
+	auto ReferenceCandidates = [World](const FString& NameOrLabel, const UClass* RequiredClass)
+	{
+		TArray<AActor*> ByName;
+		TArray<AActor*> ByLabel;
+		for (TActorIterator<AActor> It(World); It; ++It)
+		{
+			AActor* Actor = *It;
+			if (RequiredClass && !Actor->IsA(RequiredClass))
+			{
+				continue;
+			}
+			if (Actor->GetName() == NameOrLabel)
+			{
+				ByName.Add(Actor);
+			}
+			else if (Actor->GetActorLabel() == NameOrLabel)
+			{
+				ByLabel.Add(Actor);
+			}
+		}
+		return ByName.Num() > 0 ? ByName : ByLabel;
+	};
+
+	auto CheckLookup = [this, World, &ReferenceCandidates](const FString& NameOrLabel, const UClass* RequiredClass)
+	{
+		const TArray<AActor*> Expected = ReferenceCandidates(NameOrLabel, RequiredClass);
+		AActor* Found = FMCPActorIndex::Get().FindActor(World, NameOrLabel, RequiredClass);
+		const FString What = FString::Printf(TEXT("'%s' (filter %s)"), *NameOrLabel,
+			RequiredClass ? *RequiredClass->GetName() : TEXT("none"));
+		if (Expected.Num() == 0)
+		{
+			TestNull(*(What + TEXT(" finds nothing")), Found);
+		}
+		else
+		{
+			TestTrue(*(What + TEXT(" matches the iterator lookup")), Expected.Contains(Found));
+		}
+	};
+
+	// Every actor in the world, by object name and by label, unfiltered and filtered
+	int32 ActorCount = 0;
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		AActor* Actor = *It;
+		++ActorCount;
+		for (const FString& Key : { Actor->GetName(), Actor->GetActorLabel() })
+		{
+			CheckLookup(Key, nullptr);
+			CheckLookup(Key, Actor->GetClass());
+			CheckLookup(Key, AStaticMeshActor::StaticClass());
+		}
+	}
+	TestTrue("World has the test actors and its defaults", ActorCount >= 4);
+
+	// Spot checks of the cases above that the reference must not hide
+	FMCPActorIndex& Index = FMCPActorIndex::Get();
+	TestEqual("Object name wins over an equal label",
+		Index.FindActor(World, UniquePlain->GetName()), UniquePlain);
+	TestEqual("Filter skips the name match and falls back to the label",
+		Index.FindActor(World, UniquePlain->GetName(), AStaticMeshActor::StaticClass()), static_cast<AActor*>(NameClash));
+	TestNull("Filter excludes the only label match",
+		Index.FindActor(World, TEXT("MCPIndexUnique"), AStaticMeshActor::StaticClass()));
+	TestEqual("Filter picks the matching actor among a shared label",
+		Index.FindActor(World, TEXT("MCPIndexShared"), AStaticMeshActor::StaticClass()), static_cast<AActor*>(SharedMesh));
+	TestEqual("Lookups are case-insensitive",
+		Index.FindActor(World, TEXT("mcpindexunique")), UniquePlain);
+
+	Index.InvalidateWorld(World);
+	World->DestroyWorld(false);
+	return true;
+}
+
+
+// ===== Spatial Query Tool Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_QueryActorsSpatial_GetInfo,
+	"UnrealClaude.MCP.Tools.QueryActorsSpatial.GetInfo",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_QueryActorsSpatial_GetInfo::RunTest(const FString& Parameters)
+{
+	FMCPTool_QueryActorsSpatial Tool;
+	FMCPToolInfo Info = Tool.GetInfo();
+
+	TestEqual("Tool name should be query_actors_spatial", Info.Name, TEXT("query_actors_spatial"));
+	TestTrue("Description should not be empty", !Info.Description.IsEmpty());
+	TestTrue("Should be read-only", Info.Annotations.bReadOnlyHint);
+
+	bool bHasQueryType = false;
+	for (const FMCPToolParameter& Param : Info.Parameters)
+	{
+		if (Param.Name == TEXT("query_type"))
+		{
+			bHasQueryType = true;
+			TestTrue("query_type should be required", Param.bRequired);
+		}
+	}
+	TestTrue("Should have 'query_type' parameter", bHasQueryType);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_QueryActorsSpatial_InvalidParams,
+	"UnrealClaude.MCP.Tools.QueryActorsSpatial.InvalidParams",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_QueryActorsSpatial_InvalidParams::RunTest(const FString& Parameters)
+{
+	FMCPTool_QueryActorsSpatial Tool;
+
+	TSharedRef<FJsonObject> NoType = MakeShared<FJsonObject>();
+	TestFalse("Missing query_type should fail", Tool.Execute(NoType).bSuccess);
+
+	TSharedRef<FJsonObject> BadType = MakeShared<FJsonObject>();
+	BadType->SetStringField(TEXT("query_type"), TEXT("cylinder"));
+	TestFalse("Unknown query_type should fail", Tool.Execute(BadType).bSuccess);
+
+	TSharedRef<FJsonObject> SphereNoCenter = MakeShared<FJsonObject>();
+	SphereNoCenter->SetStringField(TEXT("query_type"), TEXT("sphere"));
+	SphereNoCenter->SetNumberField(TEXT("radius"), 100.0);
+	TestFalse("Sphere without center should fail", Tool.Execute(SphereNoCenter).bSuccess);
+
+	TSharedRef<FJsonObject> BoxNoCorners = MakeShared<FJsonObject>();
+	BoxNoCorners->SetStringField(TEXT("query_type"), TEXT("box"));
+	TestFalse("Box without corners should fail", Tool.Execute(BoxNoCorners).bSuccess);
+
+	return true;
+}
+
+// ===== Cursor Store Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPCursorStore_PagesThroughSnapshot,
+	"UnrealClaude.MCP.CursorStore.PagesThroughSnapshot",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPCursorStore_PagesThroughSnapshot::RunTest(const FString& Parameters)
+{
+	FMCPCursorStore& Store = FMCPCursorStore::Get();
+
+	TArray<FString> Ids = { TEXT("A"), TEXT("B"), TEXT("C"), TEXT("D"), TEXT("E") };
+	TSharedPtr<FJsonObject> Options = MakeShared<FJsonObject>();
+	Options->SetBoolField(TEXT("brief"), false);
+	const FString Cursor = Store.CreateCursor(TEXT("test.listing"), MoveTemp(Ids), 2, Options);
+	TestFalse("Cursor should not be empty", Cursor.IsEmpty());
+
+	FMCPCursorPage Page;
+	FString Error;
+	TestTrue("First cursor page should read", Store.ReadPage(Cursor, TEXT("test.listing"), 2, Page, Error));
+	TestEqual("Page should start at the cursor offset", Page.Offset, 2);
+	TestEqual("Page total should be the snapshot size", Page.Total, 5);
+	TestEqual("Page should hold limit ids", Page.Ids.Num(), 2);
+	TestEqual("Page should start with C", Page.Ids.Num() > 0 ? Page.Ids[0] : FString(), FString(TEXT("C")));
+	TestTrue("Options should round-trip", Page.Options.IsValid() && !Page.Options->GetBoolField(TEXT("brief")));
+	TestFalse("Next cursor should be set", Page.NextCursor.IsEmpty());
+
+	const FString Next = Page.NextCursor;
+	TestTrue("Last page should read", Store.ReadPage(Next, TEXT("test.listing"), 2, Page, Error));
+	TestEqual("Last page should hold the remainder", Page.Ids.Num(), 1);
+	TestEqual("Last page should hold E", Page.Ids.Num() > 0 ? Page.Ids[0] : FString(), FString(TEXT("E")));
+	TestTrue("Last page should have no next cursor", Page.NextCursor.IsEmpty());
+
+	TestTrue("Re-reading a cursor should return the same page", Store.ReadPage(Cursor, TEXT("test.listing"), 2, Page, Error));
+	TestEqual("Re-read page should start at C", Page.Ids.Num() > 0 ? Page.Ids[0] : FString(), FString(TEXT("C")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPCursorStore_RejectsInvalidCursors,
+	"UnrealClaude.MCP.CursorStore.RejectsInvalidCursors",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPCursorStore_RejectsInvalidCursors::RunTest(const FString& Parameters)
+{
+	FMCPCursorStore& Store = FMCPCursorStore::Get();
+	FMCPCursorPage Page;
+	FString Error;
+
+	TestFalse("Garbage cursor should fail", Store.ReadPage(TEXT("not-a-cursor"), TEXT("test.listing"), 10, Page, Error));
+	TestFalse("Garbage cursor should report an error", Error.IsEmpty());
+
+	const FString Unknown = FGuid::NewGuid().ToString(EGuidFormats::Digits) + TEXT("-0");
+	TestFalse("Unknown snapshot should fail", Store.ReadPage(Unknown, TEXT("test.listing"), 10, Page, Error));
+
+	TArray<FString> Ids = { TEXT("A"), TEXT("B") };
+	const FString Cursor = Store.CreateCursor(TEXT("test.listing"), MoveTemp(Ids), 0);
+	TestFalse("Cursor from another listing should fail", Store.ReadPage(Cursor, TEXT("test.other"), 10, Page, Error));
+
+	FMCPTool_GetLevelActors Tool;
+	TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+	Params->SetStringField(TEXT("cursor"), Cursor);
+	TestFalse("get_level_actors should reject a foreign cursor", Tool.Execute(Params).bSuccess);
+
+	return true;
+}
+
+// ===== Field Selection Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPFieldSet_Parse,
+	"UnrealClaude.MCP.FieldSet.Parse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPFieldSet_Parse::RunTest(const FString& Parameters)
+{
+	const TArray<const TCHAR*> Valid = { TEXT("name"), TEXT("class"), TEXT("location") };
+	FString Error;
+
+	FMCPFieldSet Default;
+	TestTrue("Default set should select everything", Default.IsAll() && Default.Has(TEXT("anything")));
+
+	TSharedRef<FJsonObject> Absent = MakeShared<FJsonObject>();
+	FMCPFieldSet Brief = { TEXT("name") };
+	TestTrue("Absent parameter should parse", FMCPFieldSet::Parse(Absent, Valid, Brief, Error));
+	TestTrue("Absent parameter should keep the default", Brief.Has(TEXT("name")) && !Brief.Has(TEXT("class")));
+
+	TSharedRef<FJsonObject> AsArray = MakeShared<FJsonObject>();
+	AsArray->SetArrayField(TEXT("fields"), { MakeShared<FJsonValueString>(TEXT("Location")) });
+	FMCPFieldSet FromArray;
+	TestTrue("Array form should parse", FMCPFieldSet::Parse(AsArray, Valid, FromArray, Error));
+	TestFalse("Parsed set should not select everything", FromArray.IsAll());
+	TestTrue("Match should be case-insensitive", FromArray.Has(TEXT("location")));
+	TestFalse("Unrequested field should be excluded", FromArray.Has(TEXT("name")));
+
+	TSharedRef<FJsonObject> AsString = MakeShared<FJsonObject>();
+	AsString->SetStringField(TEXT("fields"), TEXT("name, class"));
+	FMCPFieldSet FromString;
+	TestTrue("Comma form should parse", FMCPFieldSet::Parse(AsString, Valid, FromString, Error));
+	TestTrue("Comma form should select both fields", FromString.Has(TEXT("name")) && FromString.Has(TEXT("class")));
+	TestEqual("Comma form should select exactly two fields", FromString.GetNames().Num(), 2);
+
+	TSharedRef<FJsonObject> Unknown = MakeShared<FJsonObject>();
+	Unknown->SetStringField(TEXT("fields"), TEXT("name,transform"));
+	FMCPFieldSet Rejected;
+	TestFalse("Unknown field should fail", FMCPFieldSet::Parse(Unknown, Valid, Rejected, Error));
+	TestTrue("Error should name the unknown field", Error.Contains(TEXT("transform")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPFieldSet_ListingToolsExposeFields,
+	"UnrealClaude.MCP.FieldSet.ListingToolsExposeFields",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPFieldSet_ListingToolsExposeFields::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+	for (const TCHAR* ToolName : { TEXT("get_level_actors"), TEXT("query_actors_spatial"), TEXT("asset_search"), TEXT("blueprint_query") })
+	{
+		IMCPTool* Tool = Registry.FindTool(ToolName);
+		if (!TestNotNull(FString::Printf(TEXT("%s should be registered"), ToolName), Tool))
+		{
+			continue;
+		}
+		const bool bHasFields = Tool->GetInfo().Parameters.ContainsByPredicate(
+			[](const FMCPToolParameter& Param) { return Param.Name == TEXT("fields"); });
+		TestTrue(FString::Printf(TEXT("%s should accept 'fields'"), ToolName), bHasFields);
+	}
+
+	return true;
+}
+
+// ===== Level Change Journal Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPLevelJournal_CollapsesChanges,
+	"UnrealClaude.MCP.LevelJournal.CollapsesChanges",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPLevelJournal_CollapsesChanges::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	TActorIterator<AActor> It(World);
+	if (!World || !It)
+	{
+		AddWarning(TEXT("No editor world actors available - skipping"));
+		return true;
+	}
+	AActor* Actor = *It;
+
+	FMCPLevelJournal& Journal = FMCPLevelJournal::Get();
+	TArray<FMCPActorChangeSummary> Changes;
+	TArray<FString> Resets;
+
+	const uint64 Start = Journal.GetCurrentVersion();
+	Journal.RecordChange(EMCPLevelChangeType::Transformed, Actor);
+	Journal.RecordChange(EMCPLevelChangeType::Transformed, Actor);
+	Journal.RecordChange(EMCPLevelChangeType::PropertyChanged, Actor, TEXT("Tags"));
+	TestTrue("Version should advance", Journal.GetCurrentVersion() > Start);
+
+	TestTrue("Recent history should be complete", Journal.GetChangesSince(Start, Changes, Resets));
+	TestEqual("Changes to one actor should collapse into one entry", Changes.Num(), 1);
+	if (Changes.Num() == 1)
+	{
+		TestTrue("Entry should be marked transformed", Changes[0].bTransformed);
+		TestFalse("Existing actor should not be reported as created", Changes[0].bCreated);
+		TestEqual("Edited property should be listed once", Changes[0].Properties.Num(), 1);
+		TestEqual("Entry should name the actor", Changes[0].ActorName, Actor->GetName());
+	}
+
+	const uint64 BeforeTransient = Journal.GetCurrentVersion();
+	Journal.RecordChange(EMCPLevelChangeType::Created, Actor);
+	Journal.RecordChange(EMCPLevelChangeType::Deleted, Actor);
+	Journal.GetChangesSince(BeforeTransient, Changes, Resets);
+	TestEqual("Created then deleted actors should net out", Changes.Num(), 0);
+
+	Journal.RecordReset(TEXT("test reset"));
+	Journal.GetChangesSince(BeforeTransient, Changes, Resets);
+	TestTrue("Resets should be reported", Resets.Contains(TEXT("test reset")));
+
+	Journal.GetChangesSince(Journal.GetCurrentVersion(), Changes, Resets);
+	TestEqual("Nothing should be newer than the current version", Changes.Num() + Resets.Num(), 0);
+
+	// Folded drags renumber the only retained entry; nothing was dropped after the clear
+	Journal.Clear();
+	const uint64 Cleared = Journal.GetCurrentVersion();
+	Journal.RecordChange(EMCPLevelChangeType::Transformed, Actor);
+	const uint64 FirstDrag = Journal.GetCurrentVersion();
+	Journal.RecordChange(EMCPLevelChangeType::Transformed, Actor);
+	Journal.RecordChange(EMCPLevelChangeType::Transformed, Actor);
+	TestTrue("History since the clear should be complete", Journal.GetChangesSince(Cleared, Changes, Resets));
+	TestEqual("Folded drags should be one change", Changes.Num(), 1);
+	TestTrue("History since the first drag should be complete", Journal.GetChangesSince(FirstDrag, Changes, Resets));
+	TestEqual("Later drags should still be reported", Changes.Num(), 1);
+	if (Cleared > 0)
+	{
+		TestFalse("History before the clear should be incomplete", Journal.GetChangesSince(Cleared - 1, Changes, Resets));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_GetLevelChanges_Params,
+	"UnrealClaude.MCP.Tools.GetLevelChanges.Params",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_GetLevelChanges_Params::RunTest(const FString& Parameters)
+{
+	FMCPTool_GetLevelChanges Tool;
+	FMCPToolInfo Info = Tool.GetInfo();
+	TestEqual("Tool name should be get_level_changes", Info.Name, TEXT("get_level_changes"));
+	TestTrue("Should be read-only", Info.Annotations.bReadOnlyHint);
+
+	TSharedRef<FJsonObject> Negative = MakeShared<FJsonObject>();
+	Negative->SetNumberField(TEXT("since"), -1);
+	TestFalse("Negative version should fail", Tool.Execute(Negative).bSuccess);
+
+	TSharedRef<FJsonObject> Future = MakeShared<FJsonObject>();
+	Future->SetNumberField(TEXT("since"), static_cast<double>(FMCPLevelJournal::Get().GetCurrentVersion() + 1000));
+	TestFalse("Version ahead of the journal should fail", Tool.Execute(Future).bSuccess);
+
+	TSharedRef<FJsonObject> Current = MakeShared<FJsonObject>();
+	Current->SetNumberField(TEXT("since"), static_cast<double>(FMCPLevelJournal::Get().GetCurrentVersion()));
+	FMCPToolResult Result = Tool.Execute(Current);
+	TestTrue("Current version should succeed", Result.bSuccess);
+	TestTrue("Result should carry the version", Result.Data.IsValid() && Result.Data->HasField(TEXT("version")));
+
+	return true;
+}
+
+// ===== Level Snapshot Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPLevelSnapshot_DiffDetectsChanges,
+	"UnrealClaude.MCP.LevelSnapshot.DiffDetectsChanges",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPLevelSnapshot_DiffDetectsChanges::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (!World)
+	{
+		AddWarning(TEXT("No editor world available - skipping"));
+		return true;
+	}
+
+	const TArray<FString> NoProperties;
+	TSharedRef<FMCPLevelSnapshot> Before = FMCPLevelSnapshotStore::Capture(World, TEXT("before"), NoProperties);
+	TSharedRef<FMCPLevelSnapshot> After = FMCPLevelSnapshotStore::Capture(World, TEXT("after"), NoProperties);
+
+	FMCPLevelDiff Diff;
+	FMCPLevelSnapshotStore::Diff(*Before, *After, Diff);
+	TestTrue("Capturing an unchanged level twice should produce an empty diff", Diff.IsEmpty());
+	TestEqual("Every actor should be unchanged", Diff.UnchangedCount, Before->Actors.Num());
+
+	if (Before->Actors.Num() == 0)
+	{
+		return true;
+	}
+
+	// Edit the recorded state directly so the level itself is left untouched
+	TMap<FString, FMCPActorRecord>::TIterator It = After->Actors.CreateIterator();
+	const FString MovedPath = It.Key();
+	It.Value().Transform.AddToTranslation(FVector(100.0, 0.0, 0.0));
+	It.Value().StateHash ^= 1;
+	It.Value().TransformHash ^= 1;
+
+	FMCPActorRecord AddedRecord = It.Value();
+	After->Actors.Add(TEXT("/Temp/Snapshot.Added"), AddedRecord);
+
+	FMCPLevelSnapshotStore::Diff(*Before, *After, Diff);
+	TestEqual("Added actor should be reported", Diff.Added.Num(), 1);
+	TestEqual("Nothing should be removed", Diff.Removed.Num(), 0);
+	TestEqual("Moved actor should be reported", Diff.Changed.Num(), 1);
+	if (Diff.Changed.Num() == 1)
+	{
+		TestEqual("Changed entry should be the moved actor", Diff.Changed[0].ActorPath, MovedPath);
+		TestTrue("Only the transform should differ", Diff.Changed[0].Fields == EMCPSnapshotField::Transform);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_LevelSnapshot_Params,
+	"UnrealClaude.MCP.Tools.LevelSnapshot.Params",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_LevelSnapshot_Params::RunTest(const FString& Parameters)
+{
+	FMCPTool_LevelSnapshot SnapshotTool;
+	FMCPTool_LevelDiff DiffTool;
+	FMCPTool_LevelRestore RestoreTool;
+	TestEqual("Tool name should be level_snapshot", SnapshotTool.GetInfo().Name, TEXT("level_snapshot"));
+	TestEqual("Tool name should be level_diff", DiffTool.GetInfo().Name, TEXT("level_diff"));
+	TestEqual("Tool name should be level_restore", RestoreTool.GetInfo().Name, TEXT("level_restore"));
+	TestTrue("level_diff should be read-only", DiffTool.GetInfo().Annotations.bReadOnlyHint);
+	TestTrue("level_restore should be destructive", RestoreTool.GetInfo().Annotations.bDestructiveHint);
+
+	TSharedRef<FJsonObject> BadOperation = MakeShared<FJsonObject>();
+	BadOperation->SetStringField(TEXT("operation"), TEXT("explode"));
+	TestFalse("Unknown operation should fail", SnapshotTool.Execute(BadOperation).bSuccess);
+
+	TSharedRef<FJsonObject> MissingSnapshot = MakeShared<FJsonObject>();
+	MissingSnapshot->SetStringField(TEXT("from"), TEXT("__no_such_snapshot__"));
+	TestFalse("Diff of an unknown snapshot should fail", DiffTool.Execute(MissingSnapshot).bSuccess);
+
+	TSharedRef<FJsonObject> NoParams = MakeShared<FJsonObject>();
+	TestFalse("Restore without a snapshot should fail", RestoreTool.Execute(NoParams).bSuccess);
+
+	return true;
+}
+
+// ===== Bulk Spawn Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_SpawnActorsBulk_Validation,
+	"UnrealClaude.MCP.Tools.SpawnActorsBulk.Validation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_SpawnActorsBulk_Validation::RunTest(const FString& Parameters)
+{
+	FMCPTool_SpawnActorsBulk Tool;
+	FMCPToolInfo Info = Tool.GetInfo();
+	TestEqual("Tool name should be spawn_actors_bulk", Info.Name, TEXT("spawn_actors_bulk"));
+	TestFalse("Should not be read-only", Info.Annotations.bReadOnlyHint);
+
+	bool bHasInstanced = false;
+	for (const FMCPToolParameter& Param : Info.Parameters)
+	{
+		bHasInstanced |= Param.Name == TEXT("instanced");
+	}
+	TestTrue("Should expose 'instanced'", bHasInstanced);
+
+	TSharedRef<FJsonObject> NoPlacements = MakeShared<FJsonObject>();
+	NoPlacements->SetStringField(TEXT("class"), TEXT("PointLight"));
+	TestFalse("Missing transforms and pattern should fail", Tool.Execute(NoPlacements).bSuccess);
+
+	TSharedRef<FJsonObject> BadPattern = MakeShared<FJsonObject>();
+	BadPattern->SetStringField(TEXT("class"), TEXT("PointLight"));
+	BadPattern->SetStringField(TEXT("pattern"), TEXT("spiral"));
+	TestFalse("Unknown pattern should fail", Tool.Execute(BadPattern).bSuccess);
+
+	TSharedRef<FJsonObject> InstancedWithoutMesh = MakeShared<FJsonObject>();
+	InstancedWithoutMesh->SetStringField(TEXT("class"), TEXT("StaticMeshActor"));
+	InstancedWithoutMesh->SetStringField(TEXT("pattern"), TEXT("scatter"));
+	InstancedWithoutMesh->SetBoolField(TEXT("instanced"), true);
+	TestFalse("instanced without a mesh should fail", Tool.Execute(InstancedWithoutMesh).bSuccess);
+
+	TSharedRef<FJsonObject> HugeGrid = MakeShared<FJsonObject>();
+	HugeGrid->SetStringField(TEXT("class"), TEXT("PointLight"));
+	HugeGrid->SetStringField(TEXT("pattern"), TEXT("grid"));
+	TSharedPtr<FJsonObject> GridCount = MakeShared<FJsonObject>();
+	GridCount->SetNumberField(TEXT("x"), 1000);
+	GridCount->SetNumberField(TEXT("y"), 1000);
+	GridCount->SetNumberField(TEXT("z"), 1);
+	HugeGrid->SetObjectField(TEXT("grid_count"), GridCount);
+	HugeGrid->SetObjectField(TEXT("spacing"), GridCount);
+	TestFalse("Grid beyond the actor limit should fail", Tool.Execute(HugeGrid).bSuccess);
+
+	return true;
+}
+
+// ===== Batch Edit Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_BatchEditActors_Validation,
+	"UnrealClaude.MCP.Tools.BatchEditActors.Validation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_BatchEditActors_Validation::RunTest(const FString& Parameters)
+{
+	FMCPTool_BatchEditActors Tool;
+	FMCPToolInfo Info = Tool.GetInfo();
+	TestEqual("Tool name should be batch_edit_actors", Info.Name, TEXT("batch_edit_actors"));
+	TestFalse("Should not be read-only", Info.Annotations.bReadOnlyHint);
+
+	TSharedRef<FJsonObject> NoEdits = MakeShared<FJsonObject>();
+	TestFalse("Missing edits should fail", Tool.Execute(NoEdits).bSuccess);
+
+	TSharedRef<FJsonObject> UnknownActor = MakeShared<FJsonObject>();
+	TSharedPtr<FJsonObject> Edit = MakeShared<FJsonObject>();
+	Edit->SetStringField(TEXT("actor"), TEXT("__NoSuchActor_BatchEdit__"));
+	TSharedPtr<FJsonObject> Location = MakeShared<FJsonObject>();
+	Location->SetNumberField(TEXT("z"), 10);
+	Edit->SetObjectField(TEXT("location"), Location);
+	UnknownActor->SetArrayField(TEXT("edits"), { MakeShared<FJsonValueObject>(Edit) });
+
+	FMCPToolResult Result = Tool.Execute(UnknownActor);
+	TestFalse("Batch where every edit fails should fail", Result.bSuccess);
+	if (Result.Data.IsValid())
+	{
+		TestEqual("Failure should be counted", static_cast<int32>(Result.Data->GetNumberField(TEXT("failed"))), 1);
+	}
+
+	return true;
+}
+
+// ===== World Partition Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPWorldPartitionActors_Ids,
+	"UnrealClaude.MCP.WorldPartitionActors.Ids",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPWorldPartitionActors_Ids::RunTest(const FString& Parameters)
+{
+	const FGuid Guid = FGuid::NewGuid();
+	FGuid Parsed;
+	TestTrue("Descriptor id should round-trip", FMCPWorldPartitionActors::ParseId(FMCPWorldPartitionActors::MakeId(Guid), Parsed));
+	TestEqual("Parsed guid should match", Parsed, Guid);
+	TestFalse("Actor paths should not parse as descriptor ids",
+		FMCPWorldPartitionActors::ParseId(TEXT("/Game/Maps/Main.Main:PersistentLevel.Cube_1"), Parsed));
+
+	FMCPUnloadedActorInfo Info;
+	Info.Name = TEXT("Tree_12");
+	Info.Label = TEXT("Tree");
+	Info.ClassName = TEXT("StaticMeshActor");
+	Info.Bounds = FBox(FVector(-10.0), FVector(10.0));
+	Info.DataLayers = { TEXT("Foliage") };
+	const FMCPFieldSet Fields = { TEXT("name"), TEXT("location") };
+	TSharedPtr<FJsonObject> Json = FMCPWorldPartitionActors::ToJson(Info, Fields);
+	TestEqual("Requested fields should be present", Json->GetStringField(TEXT("name")), FString(TEXT("Tree_12")));
+	TestFalse("Unrequested fields should be omitted", Json->HasField(TEXT("class")));
+	TestFalse("Descriptor entries should be marked unloaded", Json->GetBoolField(TEXT("loaded")));
+	TestTrue("Bounds should be included", Json->HasField(TEXT("bounds")));
+	TestTrue("Data layers should be included", Json->HasField(TEXT("dataLayers")));
+
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	if (World && !FMCPWorldPartitionActors::IsPartitioned(World))
+	{
+		TestEqual("Non-partitioned worlds have no unloaded actors", FMCPWorldPartitionActors::CountUnloaded(World), 0);
+
+		TArray<FGuid> Pinned;
+		FMCPWorldPartitionActors::GetPinnedActors(World, Pinned);
+		TestEqual("Non-partitioned worlds have no pinned actors", Pinned.Num(), 0);
+		TestEqual("Nothing to unpin", FMCPWorldPartitionActors::UnpinActors(World, { FGuid::NewGuid() }), 0);
+
+		FMCPToolRegistry Registry;
+		if (IMCPTool* UnloadTool = Registry.FindTool(TEXT("unload_actors")))
+		{
+			TestFalse("unload_actors needs a World Partition map", UnloadTool->Execute(MakeShared<FJsonObject>()).bSuccess);
+		}
+		else
+		{
+			AddError(TEXT("unload_actors should be registered"));
+		}
+	}
+
+	return true;
+}
+
+// ===== Property Path Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPPropertyPath_Resolve,
+	"UnrealClaude.MCP.PropertyPath.Resolve",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPPropertyPath_Resolve::RunTest(const FString& Parameters)
+{
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	AActor* Actor = nullptr;
+	if (World)
+	{
+		for (TActorIterator<AActor> It(World); It; ++It)
+		{
+			if (It->GetRootComponent())
+			{
+				Actor = *It;
+				break;
+			}
+		}
+	}
+	if (!Actor)
+	{
+		AddWarning(TEXT("No actor with a root component available - skipping"));
+		return true;
+	}
+
+	FMCPPropertyPathCache& Cache = FMCPPropertyPathCache::Get();
+	FMCPResolvedProperty Resolved;
+	FString Error;
+
+	TestTrue("Struct member through the root component should resolve",
+		Cache.Resolve(Actor, TEXT("RootComponent.RelativeLocation.X"), Resolved, Error));
+	TestTrue("Leaf should live on the root component", Resolved.Object == Actor->GetRootComponent());
+	TestNotNull("Leaf should have a value address", Resolved.ValuePtr);
+	if (Resolved.ValuePtr && Resolved.Property && Resolved.Property->IsA<FDoubleProperty>())
+	{
+		TestEqual("Resolved address should point at the live value",
+			*static_cast<double*>(Resolved.ValuePtr), Actor->GetRootComponent()->GetRelativeLocation().X);
+	}
+	TestTrue("Member property should be the top-level struct", Resolved.MemberProperty && Resolved.MemberProperty->GetFName() == TEXT("RelativeLocation"));
+
+	const int32 CachedAfterFirst = Cache.GetCachedPathCount();
+	TestTrue("Resolved path should be cached", CachedAfterFirst > 0);
+	TestTrue("Second resolve should succeed",
+		Cache.Resolve(Actor, TEXT("RootComponent.RelativeLocation.X"), Resolved, Error));
+	TestEqual("Repeat resolve should reuse the cached chain", Cache.GetCachedPathCount(), CachedAfterFirst);
+
+	TestFalse("Unknown property should fail", Cache.Resolve(Actor, TEXT("__NoSuchProperty__"), Resolved, Error));
+	TestFalse("Failure should explain itself", Error.IsEmpty());
+
+	return true;
+}
+
+// ===== Get Properties Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_GetProperties_Validation,
+	"UnrealClaude.MCP.Tools.GetProperties.Validation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_GetProperties_Validation::RunTest(const FString& Parameters)
+{
+	FMCPTool_GetProperties Tool;
+	const FMCPToolInfo Info = Tool.GetInfo();
+	TestEqual("Tool name should be get_properties", Info.Name, TEXT("get_properties"));
+	TestTrue("get_properties should be read-only", Info.Annotations.bReadOnlyHint);
+
+	if (!GEditor || !GEditor->GetEditorWorldContext().World())
+	{
+		AddWarning(TEXT("No editor world available - skipping execution checks"));
+		return true;
+	}
+
+	TSharedRef<FJsonObject> NoPaths = MakeShared<FJsonObject>();
+	NoPaths->SetStringField(TEXT("class_filter"), TEXT("Actor"));
+	TestFalse("Missing properties should fail", Tool.Execute(NoPaths).bSuccess);
+
+	TSharedRef<FJsonObject> NoSelection = MakeShared<FJsonObject>();
+	NoSelection->SetArrayField(TEXT("properties"), { MakeShared<FJsonValueString>(TEXT("bHidden")) });
+	TestFalse("Missing object selection should fail", Tool.Execute(NoSelection).bSuccess);
+
+	TSharedRef<FJsonObject> Read = MakeShared<FJsonObject>();
+	Read->SetArrayField(TEXT("properties"), {
+		MakeShared<FJsonValueString>(TEXT("bHidden")),
+		MakeShared<FJsonValueString>(TEXT("__NoSuchProperty__"))
+	});
+	Read->SetStringField(TEXT("class_filter"), TEXT("Actor"));
+	Read->SetNumberField(TEXT("limit"), 10);
+	FMCPToolResult Result = Tool.Execute(Read);
+	TestTrue("Read should succeed", Result.bSuccess);
+	if (Result.bSuccess && Result.Data.IsValid())
+	{
+		const int32 Count = static_cast<int32>(Result.Data->GetNumberField(TEXT("count")));
+		const TSharedPtr<FJsonObject> Columns = Result.Data->GetObjectField(TEXT("columns"));
+		TestEqual("Each column should have one cell per object", Columns->GetArrayField(TEXT("bHidden")).Num(), Count);
+		if (Count > 0)
+		{
+			TestTrue("Unknown paths should be reported", Result.Data->HasField(TEXT("errors")));
+			TestEqual("Bool properties should read as JSON booleans",
+				Columns->GetArrayField(TEXT("bHidden"))[0]->Type, EJson::Boolean);
+		}
+	}
+
+	return true;
+}
+
+// ===== Export Table Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_ExportTable_Validation,
+	"UnrealClaude.MCP.Tools.ExportTable.Validation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_ExportTable_Validation::RunTest(const FString& Parameters)
+{
+	FMCPTool_ExportTable Tool;
+	TestEqual("Tool name should be export_table", Tool.GetInfo().Name, TEXT("export_table"));
+
+	TestEqual("Plain CSV fields are unchanged", FMCPTool_ExportTable::EscapeCsvField(TEXT("Rock_01")), TEXT("Rock_01"));
+	TestEqual("Fields with commas are quoted",
+		FMCPTool_ExportTable::EscapeCsvField(TEXT("(X=1,Y=2)")), TEXT("\"(X=1,Y=2)\""));
+	TestEqual("Embedded quotes are doubled",
+		FMCPTool_ExportTable::EscapeCsvField(TEXT("say \"hi\"")), TEXT("\"say \"\"hi\"\"\""));
+	TestTrue("Exports go under Saved/UnrealClaude",
+		FMCPTool_ExportTable::GetExportDirectory().StartsWith(FPaths::ProjectSavedDir()));
+
+	if (!GEditor || !GEditor->GetEditorWorldContext().World())
+	{
+		AddWarning(TEXT("No editor world available - skipping execution checks"));
+		return true;
+	}
+
+	TSharedRef<FJsonObject> BadSource = MakeShared<FJsonObject>();
+	BadSource->SetStringField(TEXT("source"), TEXT("everything"));
+	TestFalse("Unknown source should fail", Tool.Execute(BadSource).bSuccess);
+
+	TSharedRef<FJsonObject> NoPaths = MakeShared<FJsonObject>();
+	NoPaths->SetStringField(TEXT("source"), TEXT("actors"));
+	TestFalse("Actor export without properties should fail", Tool.Execute(NoPaths).bSuccess);
+
+	TSharedRef<FJsonObject> BadFormat = MakeShared<FJsonObject>();
+	BadFormat->SetStringField(TEXT("source"), TEXT("actors"));
+	BadFormat->SetStringField(TEXT("format"), TEXT("xlsx"));
+	BadFormat->SetArrayField(TEXT("properties"), { MakeShared<FJsonValueString>(TEXT("bHidden")) });
+	TestFalse("Unknown format should fail", Tool.Execute(BadFormat).bSuccess);
+
+	return true;
+}
+
+// ===== Asset Name Index Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPAssetNameIndex_Ranking,
+	"UnrealClaude.MCP.AssetNameIndex.Ranking",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPAssetNameIndex_Ranking::RunTest(const FString& Parameters)
+{
+	FMCPAssetNameIndex& Index = FMCPAssetNameIndex::Get();
+	const TSet<FTopLevelAssetPath> AnyClass;
+	TArray<FMCPAssetMatch> Matches;
+
+	Index.Search(TEXT("Cube"), AnyClass, TEXT("/Engine/BasicShapes"), true, Matches);
+	if (Matches.Num() == 0)
+	{
+		AddWarning(TEXT("/Engine/BasicShapes/Cube not in the asset registry - skipping"));
+		return true;
+	}
+	TestTrue("Index should be built by the first search", Index.Num() > 0);
+	TestTrue("Exact name should rank first", Matches[0].Tier == EMCPAssetMatchTier::Exact);
+	TestEqual("Exact match should be the Cube mesh", Matches[0].ObjectPath.GetAssetName(), FString(TEXT("Cube")));
+	for (int32 i = 1; i < Matches.Num(); ++i)
+	{
+		TestTrue("Results should be sorted by tier", Matches[i - 1].Tier <= Matches[i].Tier);
+	}
+
+	Index.Search(TEXT("CUB"), AnyClass, TEXT("/Engine/BasicShapes"), false, Matches);
+	TestTrue("Prefix query should find Cube", Matches.ContainsByPredicate([](const FMCPAssetMatch& Match)
+	{
+		return Match.ObjectPath.GetAssetName() == TEXT("Cube") && Match.Tier == EMCPAssetMatchTier::Prefix;
+	}));
+
+	Index.Search(TEXT("Cubee"), AnyClass, TEXT("/Engine/BasicShapes"), false, Matches);
+	TestEqual("Misspelling should not match without fuzzy", Matches.Num(), 0);
+
+	Index.Search(TEXT("Cubee"), AnyClass, TEXT("/Engine/BasicShapes"), true, Matches);
+	TestTrue("Misspelling should match fuzzily", Matches.ContainsByPredicate([](const FMCPAssetMatch& Match)
+	{
+		return Match.ObjectPath.GetAssetName() == TEXT("Cube") && Match.Tier == EMCPAssetMatchTier::Fuzzy;
+	}));
+
+	Index.Search(TEXT("Cube"), AnyClass, TEXT("/Game/__NoSuchFolder__"), true, Matches);
+	TestEqual("Path prefix should filter results", Matches.Num(), 0);
+
+	return true;
+}
+
+// ===== Class Resolver Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPClassResolver_FindClass,
+	"UnrealClaude.MCP.ClassResolver.FindClass",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPClassResolver_FindClass::RunTest(const FString& Parameters)
+{
+	FMCPClassResolver& Resolver = FMCPClassResolver::Get();
+
+	TestTrue("Short name should resolve", Resolver.FindClass(TEXT("StaticMeshActor")) == AStaticMeshActor::StaticClass());
+	TestTrue("Short names are case-insensitive", Resolver.FindClass(TEXT("staticmeshactor")) == AStaticMeshActor::StaticClass());
+	TestTrue("C++ prefix should be accepted", Resolver.FindClass(TEXT("AStaticMeshActor")) == AStaticMeshActor::StaticClass());
+	TestTrue("Script path should resolve", Resolver.FindClass(TEXT("/Script/Engine.StaticMeshActor")) == AStaticMeshActor::StaticClass());
+	TestTrue("CoreUObject classes should resolve", Resolver.FindClass(TEXT("Object")) == UObject::StaticClass());
+
+	TestNotNull("Matching base class should pass", Resolver.FindClass(TEXT("StaticMeshActor"), AActor::StaticClass()));
+	TestNull("Non-matching base class should fail", Resolver.FindClass(TEXT("StaticMesh"), AActor::StaticClass()));
+
+	TestNull("Unknown class should not resolve", Resolver.FindClass(TEXT("__NoSuchClass__")));
+	const int32 CachedBefore = Resolver.GetCachedLookupCount();
+	TestNull("Repeated miss should come from the cache", Resolver.FindClass(TEXT("__NoSuchClass__")));
+	TestEqual("Repeated lookups should not grow the cache", Resolver.GetCachedLookupCount(), CachedBefore);
+
+	return true;
+}
+
+// ===== Asset Preload Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPAssetPreloader_RequiredAssets,
+	"UnrealClaude.MCP.AssetPreloader.RequiredAssets",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPAssetPreloader_RequiredAssets::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+	IMCPTool* AssetTool = Registry.FindTool(TEXT("asset"));
+	IMCPTool* AnimTool = Registry.FindTool(TEXT("anim_blueprint_modify"));
+	if (!TestNotNull("asset tool should be registered", AssetTool) ||
+		!TestNotNull("anim_blueprint_modify tool should be registered", AnimTool))
+	{
+		return false;
+	}
+
+	// Package paths are expanded to object paths
+	TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+	Params->SetStringField(TEXT("operation"), TEXT("get_asset_info"));
+	Params->SetStringField(TEXT("asset_path"), TEXT("/Game/Materials/M_Test"));
+	TArray<FSoftObjectPath> Assets;
+	AssetTool->GetRequiredAssets(Params, Assets);
+	TestEqual("One asset declared", Assets.Num(), 1);
+	if (Assets.Num() == 1)
+	{
+		TestEqual("Package path expanded", Assets[0].ToString(), FString(TEXT("/Game/Materials/M_Test.M_Test")));
+	}
+
+	// Object paths are kept, invalid paths are left for Execute to report
+	TSharedRef<FJsonObject> AnimParams = MakeShared<FJsonObject>();
+	AnimParams->SetStringField(TEXT("blueprint_path"), TEXT("/Game/Anim/ABP_Hero.ABP_Hero"));
+	AnimParams->SetStringField(TEXT("animation_path"), TEXT("not a path"));
+	Assets.Reset();
+	AnimTool->GetRequiredAssets(AnimParams, Assets);
+	TestEqual("Only the valid path declared", Assets.Num(), 1);
+
+	// Tools without declarations stay empty
+	Assets.Reset();
+	if (IMCPTool* SpawnTool = Registry.FindTool(TEXT("spawn_actor")))
+	{
+		SpawnTool->GetRequiredAssets(Params, Assets);
+		TestEqual("spawn_actor declares nothing", Assets.Num(), 0);
+		TestFalse("spawn_actor skips the preload", SpawnTool->HasRequiredAssets());
+	}
+	TestTrue("asset tool is preloaded", AssetTool->HasRequiredAssets());
+
+	// Preloading from the game thread is a no-op rather than a deadlock
+	FThreadSafeBool bCancelled = false;
+	FMCPAssetPreloadResult Result = FMCPAssetPreloader::Preload(AssetTool, Params, 1000, bCancelled);
+	TestEqual("Nothing requested on the game thread", Result.Requested, 0);
+	TestFalse("No handle held", Result.Handle.IsValid());
+	TestFalse("No JSON summary", Result.ToJson().IsValid());
+
+	return true;
+}
+
+// ===== Blueprint Edit Session Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPBlueprintEditSessions_DeferAndCommit,
+	"UnrealClaude.MCP.BlueprintEditSessions.DeferAndCommit",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPBlueprintEditSessions_DeferAndCommit::RunTest(const FString& Parameters)
+{
+	FMCPBlueprintEditSessions& Sessions = FMCPBlueprintEditSessions::Get();
+	UBlueprint* Blueprint = NewObject<UBlueprint>(GetTransientPackage());
+
+	TestFalse("No session: changes are not deferred", Sessions.RecordChange(Blueprint, TEXT("Variable added")));
+
+	TestTrue("First begin opens a session", Sessions.Begin(Blueprint));
+	TestFalse("Second begin keeps the open session", Sessions.Begin(Blueprint));
+	TestTrue("Changes are deferred", Sessions.RecordChange(Blueprint, TEXT("Variable added")));
+	TestTrue("Changes are deferred", Sessions.RecordChange(Blueprint, TEXT("Function added")));
+
+	const FMCPBlueprintEditSession* Open = Sessions.Find(Blueprint);
+	if (TestNotNull("Session is open", Open))
+	{
+		TestEqual("Two pending operations", Open->PendingOperations.Num(), 2);
+	}
+
+	FMCPBlueprintEditSession Closed;
+	TestTrue("End closes the session", Sessions.End(Blueprint, Closed));
+	TestEqual("Closed session keeps its operations", Closed.PendingOperations.Num(), 2);
+	TestNull("Session is gone", Sessions.Find(Blueprint));
+	TestFalse("Ending twice fails", Sessions.End(Blueprint, Closed));
+
+	// Idle sessions are committed; this one has no pending changes, so nothing compiles
+	Sessions.Begin(Blueprint);
+	TestEqual("Recent session is not idle", Sessions.CommitIdle(3600.0), 0);
+	TestNotNull("Recent session stays open", Sessions.Find(Blueprint));
+	TestEqual("Idle session is committed", Sessions.CommitIdle(0.0), 1);
+	TestNull("Idle session is closed", Sessions.Find(Blueprint));
+
+	Sessions.Begin(Blueprint);
+	TestEqual("CommitAll closes open sessions", Sessions.CommitAll(TEXT("test")), 1);
+	TestEqual("No sessions left", Sessions.Num(), 0);
+
+	// Tool-level validation
+	FMCPToolRegistry Registry;
+	if (IMCPTool* Tool = Registry.FindTool(TEXT("blueprint_modify")))
+	{
+		TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+		Params->SetStringField(TEXT("operation"), TEXT("commit_edit"));
+		FMCPToolResult Result = Tool->Execute(Params);
+		TestFalse("commit_edit without blueprint_path should fail", Result.bSuccess);
+
+		Params->SetStringField(TEXT("operation"), TEXT("abort_edit"));
+		Result = Tool->Execute(Params);
+		TestFalse("abort_edit without blueprint_path should fail", Result.bSuccess);
+	}
+
+	return true;
+}
+
+// ===== Blueprint Node ID Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBlueprintGraphEditor_NodeIds,
+	"UnrealClaude.MCP.BlueprintGraphEditor.NodeIds",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FBlueprintGraphEditor_NodeIds::RunTest(const FString& Parameters)
+{
+	UBlueprint* Blueprint = FKismetEditorUtilities::CreateBlueprint(
+		AActor::StaticClass(), GetTransientPackage(), MakeUniqueObjectName(GetTransientPackage(), UBlueprint::StaticClass(), TEXT("BP_NodeIdTest")),
+		BPTYPE_Normal, UBlueprint::StaticClass(), UBlueprintGeneratedClass::StaticClass());
+	if (!TestNotNull("Blueprint created", Blueprint))
+	{
+		return false;
+	}
+
+	FString Error;
+	UEdGraph* Graph = FBlueprintGraphEditor::FindGraph(Blueprint, FString(), false, Error);
+	if (!TestNotNull("Event graph found", Graph))
+	{
+		return false;
+	}
+
+	FString FirstId;
+	FString SecondId;
+	UEdGraphNode* First = FBlueprintGraphEditor::CreateNode(Graph, TEXT("Branch"), nullptr, 0, 0, FirstId, Error);
+	UEdGraphNode* Second = FBlueprintGraphEditor::CreateNode(Graph, TEXT("Branch"), nullptr, 300, 0, SecondId, Error);
+	if (!TestNotNull("First node created", First) || !TestNotNull("Second node created", Second))
+	{
+		return false;
+	}
+
+	TestNotEqual("IDs are unique", FirstId, SecondId);
+	TestTrue("Comment is left alone", First->NodeComment.IsEmpty());
+	TestEqual("ID is stable", FBlueprintGraphEditor::GetNodeId(First), FirstId);
+	TestTrue("Lookup by ID", FBlueprintGraphEditor::FindNodeById(Graph, FirstId) == First);
+	TestNull("Unknown ID", FBlueprintGraphEditor::FindNodeById(Graph, TEXT("IfThenElse_00000000000000000000000000000000")));
+
+	// Only the Guid identifies the node, so the readable part may differ
+	const FString GuidPart = SecondId.RightChop(SecondId.Find(TEXT("_"), ESearchCase::CaseSensitive, ESearchDir::FromEnd) + 1);
+	TestTrue("Lookup ignores the readable prefix", FBlueprintGraphEditor::FindNodeById(Graph, TEXT("Renamed_") + GuidPart) == Second);
+
+	// Nodes tagged by older versions keep their comment IDs
+	First->NodeComment = TEXT("MCP_ID:Branch_7");
+	FBlueprintGraphEditor::InvalidateNodeIndex(Graph);
+	TestEqual("Legacy ID reported", FBlueprintGraphEditor::GetNodeId(First), FString(TEXT("Branch_7")));
+	TestTrue("Legacy ID resolves", FBlueprintGraphEditor::FindNodeById(Graph, TEXT("Branch_7")) == First);
+
+	TestTrue("Delete by ID", FBlueprintGraphEditor::DeleteNode(Graph, SecondId, Error));
+	TestNull("Deleted node no longer found", FBlueprintGraphEditor::FindNodeById(Graph, SecondId));
+
+	return true;
+}
+
+// ===== Bulk Blueprint Compilation Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_CompileBlueprints_DependencyOrder,
+	"UnrealClaude.MCP.Tools.CompileBlueprints.DependencyOrder",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_CompileBlueprints_DependencyOrder::RunTest(const FString& Parameters)
+{
+	// BP_Child -> BP_Base -> BP_Lib, BP_Other stands alone, BP_A <-> BP_B form a cycle
+	const TArray<FName> Packages = {
+		TEXT("/Game/BP_A"), TEXT("/Game/BP_B"), TEXT("/Game/BP_Base"),
+		TEXT("/Game/BP_Child"), TEXT("/Game/BP_Lib"), TEXT("/Game/BP_Other")
+	};
+	const TArray<TArray<FName>> Dependencies = {
+		{ TEXT("/Game/BP_B") },
+		{ TEXT("/Game/BP_A"), TEXT("/Script/Engine") },
+		{ TEXT("/Game/BP_Lib"), TEXT("/Game/Textures/T_Outside") },
+		{ TEXT("/Game/BP_Base"), TEXT("/Game/BP_Lib"), TEXT("/Game/BP_Base") },
+		{},
+		{}
+	};
+
+	int32 CycleCount = 0;
+	const TArray<int32> Order = FMCPTool_CompileBlueprints::SortByDependencies(Packages, Dependencies, CycleCount);
+
+	TestEqual("Every package is ordered", Order.Num(), Packages.Num());
+	TestEqual("Cycle members are reported", CycleCount, 2);
+	TestTrue("Lib before Base", Order.IndexOfByKey(4) < Order.IndexOfByKey(2));
+	TestTrue("Base before Child", Order.IndexOfByKey(2) < Order.IndexOfByKey(3));
+	TestTrue("Cycle goes last", Order.IndexOfByKey(0) >= 4 && Order.IndexOfByKey(1) >= 4);
+
+	FMCPToolRegistry Registry;
+	IMCPTool* Tool = Registry.FindTool(TEXT("compile_blueprints"));
+	if (!TestNotNull("compile_blueprints is registered", Tool))
+	{
+		return false;
+	}
+
+	{
+		TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+		TestFalse("Requires path or asset_paths", Tool->Execute(Params).bSuccess);
+	}
+	{
+		TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+		Params->SetStringField(TEXT("path"), TEXT("/Engine/"));
+		TestFalse("Engine content is rejected", Tool->Execute(Params).bSuccess);
+	}
+	{
+		TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+		Params->SetStringField(TEXT("path"), TEXT("/Game/NonExistent_CompileTest12345"));
+		TestFalse("Empty folder is an error", Tool->Execute(Params).bSuccess);
+	}
+
+	return true;
+}
+
+// ===== Blueprint Serialization Cache Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPBlueprintSerializationCache_Diff,
+	"UnrealClaude.MCP.BlueprintSerializationCache.Diff",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPBlueprintSerializationCache_Diff::RunTest(const FString& Parameters)
+{
+	auto MakeVariable = [](const TCHAR* Name, const TCHAR* Type) -> TSharedPtr<FJsonValue>
+	{
+		TSharedPtr<FJsonObject> Variable = MakeShared<FJsonObject>();
+		Variable->SetStringField(TEXT("name"), Name);
+		Variable->SetStringField(TEXT("type"), Type);
+		return MakeShared<FJsonValueObject>(Variable);
+	};
+
+	TSharedPtr<FJsonObject> Old = MakeShared<FJsonObject>();
+	Old->SetStringField(TEXT("name"), TEXT("BP_Test"));
+	Old->SetStringField(TEXT("parent_class"), TEXT("Actor"));
+	Old->SetStringField(TEXT("generated_class"), TEXT("BP_Test_C"));
+	Old->SetArrayField(TEXT("variables"), { MakeVariable(TEXT("Health"), TEXT("float")), MakeVariable(TEXT("Speed"), TEXT("float")) });
+
+	TSharedPtr<FJsonObject> New = MakeShared<FJsonObject>();
+	New->SetStringField(TEXT("name"), TEXT("BP_Test"));
+	New->SetStringField(TEXT("parent_class"), TEXT("Pawn"));
+	New->SetArrayField(TEXT("variables"), { MakeVariable(TEXT("Health"), TEXT("int")), MakeVariable(TEXT("Ammo"), TEXT("int")) });
+
+	TSharedPtr<FJsonObject> Diff = FMCPBlueprintSerializationCache::Diff(Old, New);
+	const TSharedPtr<FJsonObject> Fields = Diff->GetObjectField(TEXT("fields"));
+	TestFalse("Unchanged field omitted", Fields->HasField(TEXT("name")));
+	TestEqual("Changed field reported", Fields->GetStringField(TEXT("parent_class")), FString(TEXT("Pawn")));
+	TestEqual("Removed field listed", Diff->GetArrayField(TEXT("removed_fields")).Num(), 1);
+
+	const TSharedPtr<FJsonObject> Variables = Diff->GetObjectField(TEXT("items"))->GetObjectField(TEXT("variables"));
+	TestEqual("One variable added", Variables->GetArrayField(TEXT("added")).Num(), 1);
+	TestEqual("One variable removed", Variables->GetArrayField(TEXT("removed")).Num(), 1);
+	TestEqual("One variable changed", Variables->GetArrayField(TEXT("changed")).Num(), 1);
+
+	// Cached results are reused until the Blueprint is modified
+	UBlueprint* Blueprint = FKismetEditorUtilities::CreateBlueprint(
+		AActor::StaticClass(), GetTransientPackage(), MakeUniqueObjectName(GetTransientPackage(), UBlueprint::StaticClass(), TEXT("BP_CacheTest")),
+		BPTYPE_Normal, UBlueprint::StaticClass(), UBlueprintGeneratedClass::StaticClass());
+	if (!TestNotNull("Blueprint created", Blueprint))
+	{
+		return false;
+	}
+
+	FMCPBlueprintSerializationCache& Cache = FMCPBlueprintSerializationCache::Get();
+	int32 BuildCount = 0;
+	auto Build = [&BuildCount]() -> TSharedPtr<FJsonObject>
+	{
+		++BuildCount;
+		return MakeShared<FJsonObject>();
+	};
+
+	uint64 FirstVersion = 0;
+	uint64 SecondVersion = 0;
+	Cache.FindOrBuild(Blueprint, TEXT("test"), Build, FirstVersion);
+	Cache.FindOrBuild(Blueprint, TEXT("test"), Build, SecondVersion);
+	if (FirstVersion == 0)
+	{
+		AddInfo(TEXT("Serialization cache is not initialized; skipping cache checks"));
+		return true;
+	}
+	TestEqual("Second query is served from the cache", BuildCount, 1);
+	TestTrue("Version is stable", SecondVersion == FirstVersion);
+	TestTrue("Versions start from the process epoch, not 0",
+		FirstVersion > (1ull << UnrealClaudeConstants::BlueprintSerializationCache::VersionEpochBits));
+	TestTrue("Version survives a JSON number", static_cast<uint64>(static_cast<double>(FirstVersion)) == FirstVersion);
+
+	Blueprint->Modify();
+	uint64 ThirdVersion = 0;
+	Cache.FindOrBuild(Blueprint, TEXT("test"), Build, ThirdVersion);
+	TestEqual("Modify invalidates", BuildCount, 2);
+	TestTrue("Version changes", ThirdVersion != FirstVersion);
+	TestTrue("Previous result is kept for diffs", Cache.FindPrevious(Blueprint, TEXT("test"), FirstVersion).IsValid());
+
+	Cache.Invalidate(Blueprint);
+	return true;
+}
+
+// ===== Compact Graph Text Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBlueprintGraphText_RoundTrip,
+	"UnrealClaude.MCP.BlueprintGraphText.RoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FBlueprintGraphText_RoundTrip::RunTest(const FString& Parameters)
+{
+	// Parsing
+	{
+		const FString Text = TEXT(
+			"# graph EventGraph: 3 nodes\n"
+			"n0 Event event=ReceiveBeginPlay @0,0 then->n1.execute  # Event_ReceiveBeginPlay_0\n"
+			"\n"
+			"n1 CallFunction function=PrintString @300,-20 .InString=\"Hello # there\" then->n2.execute\n"
+			"n2 Sequence num_outputs=3 then_0->Existing_Node_Id.execute\n");
+
+		TArray<TSharedPtr<FJsonValue>> Nodes;
+		TArray<TSharedPtr<FJsonValue>> Connections;
+		FString Error;
+		if (!TestTrue("Text parses", FBlueprintGraphText::Parse(Text, Nodes, Connections, Error)))
+		{
+			AddError(Error);
+			return false;
+		}
+
+		TestEqual("Three nodes", Nodes.Num(), 3);
+		TestEqual("Three links", Connections.Num(), 3);
+
+		const TSharedPtr<FJsonObject> Print = Nodes[1]->AsObject();
+		TestEqual("Type", Print->GetStringField(TEXT("type")), FString(TEXT("CallFunction")));
+		TestEqual("Param", Print->GetObjectField(TEXT("params"))->GetStringField(TEXT("function")), FString(TEXT("PrintString")));
+		TestEqual("Position", static_cast<int32>(Print->GetNumberField(TEXT("pos_y"))), -20);
+		TestEqual("Quoted pin value keeps '#'", Print->GetObjectField(TEXT("pin_values"))->GetStringField(TEXT("InString")), FString(TEXT("Hello # there")));
+		TestEqual("Numeric param", static_cast<int32>(Nodes[2]->AsObject()->GetObjectField(TEXT("params"))->GetNumberField(TEXT("num_outputs"))), 3);
+
+		const TSharedPtr<FJsonObject> First = Connections[0]->AsObject();
+		TestEqual("Label becomes index", static_cast<int32>(First->GetNumberField(TEXT("to_node"))), 1);
+		TestEqual("From pin", First->GetStringField(TEXT("from_pin")), FString(TEXT("then")));
+		TestEqual("Unknown ref is a node ID", Connections[2]->AsObject()->GetStringField(TEXT("to_node")), FString(TEXT("Existing_Node_Id")));
+	}
+
+	// Errors carry the line number
+	{
+		TArray<TSharedPtr<FJsonValue>> Nodes;
+		TArray<TSharedPtr<FJsonValue>> Connections;
+		FString Error;
+		TestFalse("Duplicate label", FBlueprintGraphText::Parse(TEXT("n0 Branch\nn0 Branch"), Nodes, Connections, Error));
+		TestTrue("Error names the line", Error.StartsWith(TEXT("Line 2")));
+		TestFalse("Unterminated quote", FBlueprintGraphText::Parse(TEXT("n0 Branch .Condition=\"true"), Nodes, Connections, Error));
+		TestFalse("Bad link", FBlueprintGraphText::Parse(TEXT("n0 Branch then->n1"), Nodes, Connections, Error));
+		TestFalse("Several graphs", FBlueprintGraphText::Parse(
+			TEXT("# graph A: 1 nodes\nn0 Branch\n# graph B: 1 nodes\nn1 Branch"), Nodes, Connections, Error));
+		TestTrue("Error asks for one graph", Error.Contains(TEXT("graph_name")));
+	}
+
+	// Serialized graphs parse back to the same nodes and links
+	UBlueprint* Blueprint = FKismetEditorUtilities::CreateBlueprint(
+		AActor::StaticClass(), GetTransientPackage(), MakeUniqueObjectName(GetTransientPackage(), UBlueprint::StaticClass(), TEXT("BP_GraphTextTest")),
+		BPTYPE_Normal, UBlueprint::StaticClass(), UBlueprintGeneratedClass::StaticClass());
+	if (!TestNotNull("Blueprint created", Blueprint))
+	{
+		return false;
+	}
+
+	FString Error;
+	UEdGraph* Graph = FBlueprintGraphEditor::FindGraph(Blueprint, FString(), false, Error);
+	if (!TestNotNull("Event graph found", Graph))
+	{
+		return false;
+	}
+
+	FString BranchId;
+	FString PrintId;
+	FBlueprintGraphEditor::CreateNode(Graph, TEXT("Branch"), nullptr, 0, 0, BranchId, Error);
+	FBlueprintGraphEditor::CreateNode(Graph, TEXT("PrintString"), nullptr, 300, 0, PrintId, Error);
+	TestTrue("Nodes connected", FBlueprintGraphEditor::ConnectPins(Graph, BranchId, TEXT("then"), PrintId, TEXT("execute"), Error));
+
+	int32 NextLabel = 0;
+	const FString Text = FBlueprintGraphText::SerializeGraph(Graph, NextLabel);
+	TestTrue("Node IDs are written as comments", Text.Contains(BranchId));
+	TestTrue("Branch is listed", Text.Contains(TEXT(" Branch @0,0")));
+
+	TArray<TSharedPtr<FJsonValue>> Nodes;
+	TArray<TSharedPtr<FJsonValue>> Connections;
+	if (!TestTrue("Serialized graph parses", FBlueprintGraphText::Parse(Text, Nodes, Connections, Error)))
+	{
+		AddError(Error);
+		return false;
+	}
+	TArray<FString> Lines;
+	Text.ParseIntoArrayLines(Lines);
+	const int32 ListedNodes = Lines.FilterByPredicate([](const FString& Line) { return !Line.StartsWith(TEXT("#")); }).Num();
+	TestEqual("Every node that is not commented out is parsed", Nodes.Num(), ListedNodes);
+	TestTrue("The link is parsed", Connections.ContainsByPredicate([](const TSharedPtr<FJsonValue>& Value)
+	{
+		return Value->AsObject()->GetStringField(TEXT("from_pin")) == TEXT("then") && Value->AsObject()->GetStringField(TEXT("to_pin")) == TEXT("execute");
+	}));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FBlueprintGraphText_AddNodesRoundTrip,
+	"UnrealClaude.MCP.BlueprintGraphText.AddNodesRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FBlueprintGraphText_AddNodesRoundTrip::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+	IMCPTool* ModifyTool = Registry.FindTool(TEXT("blueprint_modify"));
+	if (!TestNotNull("blueprint_modify is registered", ModifyTool))
+	{
+		return false;
+	}
+
+	// In-memory /Game package: blueprint_modify refuses transient and engine paths. Never saved.
+	const FString AssetName = MakeUniqueObjectName(nullptr, UPackage::StaticClass(), TEXT("BP_GraphTextAddNodes")).ToString();
+	UPackage* Package = CreatePackage(*FString::Printf(TEXT("/Game/UnrealClaudeTests/%s"), *AssetName));
+	UBlueprint* Blueprint = FKismetEditorUtilities::CreateBlueprint(
+		AActor::StaticClass(), Package, FName(*AssetName),
+		BPTYPE_Normal, UBlueprint::StaticClass(), UBlueprintGeneratedClass::StaticClass());
+	if (!TestNotNull("Blueprint created", Blueprint))
+	{
+		return false;
+	}
+
+	// Leave nothing for the editor to offer to save on exit
+	auto DiscardTestAsset = [Package, Blueprint]()
+	{
+		Package->SetDirtyFlag(false);
+		Blueprint->ClearFlags(RF_Public | RF_Standalone);
+		Blueprint->MarkAsGarbage();
+		Package->ClearFlags(RF_Public | RF_Standalone);
+		Package->MarkAsGarbage();
+	};
+
+	auto AddFunction = [Blueprint](const TCHAR* Name) -> UEdGraph*
+	{
+		UEdGraph* Graph = FBlueprintEditorUtils::CreateNewGraph(Blueprint, FName(Name), UEdGraph::StaticClass(), UEdGraphSchema_K2::StaticClass());
+		FBlueprintEditorUtils::AddFunctionGraph<UClass>(Blueprint, Graph, /*bIsUserCreated=*/ true, nullptr);
+		return Graph;
+	};
+	UEdGraph* SourceGraph = AddFunction(TEXT("SourceFunction"));
+	UEdGraph* TargetGraph = AddFunction(TEXT("TargetFunction"));
+
+	// Function entry (not creatable) -> PrintString <- GetPlatformName (a non-Kismet-library call)
+	FString Error;
+	FString PrintId;
+	FBlueprintGraphEditor::CreateNode(SourceGraph, TEXT("PrintString"), nullptr, 300, 0, PrintId, Error);
+
+	FGraphNodeCreator<UK2Node_CallFunction> NodeCreator(*SourceGraph);
+	UK2Node_CallFunction* PlatformNode = NodeCreator.CreateNode();
+	PlatformNode->SetFromFunction(UGameplayStatics::StaticClass()->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(UGameplayStatics, GetPlatformName)));
+	PlatformNode->NodePosX = 0;
+	PlatformNode->NodePosY = 200;
+	NodeCreator.Finalize();
+	const FString PlatformId = FBlueprintGraphEditor::GetNodeId(PlatformNode);
+	TestTrue("Call connected", FBlueprintGraphEditor::ConnectPins(SourceGraph, PlatformId, TEXT("ReturnValue"), PrintId, TEXT("InString"), Error));
+
+	int32 NextLabel = 0;
+	const FString Text = FBlueprintGraphText::SerializeGraph(SourceGraph, NextLabel);
+	TArray<FString> Lines;
+	Text.ParseIntoArrayLines(Lines);
+	const FString* EntryLine = Lines.FindByPredicate([](const FString& Line) { return Line.Contains(TEXT(" FunctionEntry")); });
+	TestTrue("Function entry is listed as a comment", EntryLine && EntryLine->StartsWith(TEXT("# n")));
+	TestTrue("target_class is a full path", Text.Contains(UGameplayStatics::StaticClass()->GetPathName()));
+
+	TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+	Params->SetStringField(TEXT("operation"), TEXT("add_nodes"));
+	Params->SetStringField(TEXT("blueprint_path"), Blueprint->GetPathName());
+	Params->SetStringField(TEXT("graph_name"), TargetGraph->GetName());
+	Params->SetBoolField(TEXT("is_function_graph"), true);
+	Params->SetStringField(TEXT("text"), Text);
+
+	const FMCPToolResult Result = ModifyTool->Execute(Params);
+	if (!TestTrue("add_nodes accepts get_graph output", Result.bSuccess))
+	{
+		AddError(Result.Message);
+		DiscardTestAsset();
+		return false;
+	}
+
+	UK2Node_CallFunction* RecreatedPlatform = nullptr;
+	for (UEdGraphNode* Node : TargetGraph->Nodes)
+	{
+		UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node);
+		if (CallNode && CallNode->GetTargetFunction() && CallNode->GetTargetFunction()->GetOwnerClass() == UGameplayStatics::StaticClass())
+		{
+			RecreatedPlatform = CallNode;
+		}
+	}
+	if (TestNotNull("GameplayStatics call recreated", RecreatedPlatform))
+	{
+		const UEdGraphPin* ReturnPin = RecreatedPlatform->FindPin(TEXT("ReturnValue"));
+		TestTrue("Link between recreated nodes restored", ReturnPin && ReturnPin->LinkedTo.Num() == 1);
+	}
+
+	DiscardTestAsset();
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
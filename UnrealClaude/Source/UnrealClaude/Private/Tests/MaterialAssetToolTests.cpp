@@ -3,11 +3,12 @@
 #include "Misc/AutomationTest.h"
 #include "MCP/Tools/MCPTool_Material.h"
 #include "MCP/Tools/MCPTool_Asset.h"
+#include "MCP/Tools/MCPTool_SaveAssets.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 
 /**
- * Tests for MCPTool_Material and MCPTool_Asset
+ * Tests for MCPTool_Material, MCPTool_Asset and MCPTool_SaveAssets
  */
 
 // ============================================================================
@@ -447,3 +448,56 @@ bool FMCPToolAssetNonExistentAsset::RunTest(const FString& Parameters)
 
 	return true;
 }
+
+// ============================================================================
+// Save Assets Tool Tests
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPToolSaveAssetsValidation,
+	"UnrealClaude.MCP.Tools.SaveAssets.Validation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPToolSaveAssetsValidation::RunTest(const FString& Parameters)
+{
+	FMCPTool_SaveAssets Tool;
+
+	FMCPToolInfo Info = Tool.GetInfo();
+	TestEqual("Tool name should be save_assets", Info.Name, TEXT("save_assets"));
+	TestFalse("Should not be read-only", Info.Annotations.bReadOnlyHint);
+
+	// Neither asset_paths nor all_dirty
+	{
+		TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+		FMCPToolResult Result = Tool.Execute(Params);
+		TestFalse("Should require asset_paths or all_dirty", Result.bSuccess);
+	}
+
+	// Engine content is rejected
+	{
+		TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+		TArray<TSharedPtr<FJsonValue>> Paths;
+		Paths.Add(MakeShared<FJsonValueString>(TEXT("/Engine/BasicShapes/Cube")));
+		Params->SetArrayField(TEXT("asset_paths"), Paths);
+		FMCPToolResult Result = Tool.Execute(Params);
+		TestFalse("Should reject engine packages", Result.bSuccess);
+	}
+
+	// Unloaded packages are skipped, not failed
+	{
+		TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+		TArray<TSharedPtr<FJsonValue>> Paths;
+		Paths.Add(MakeShared<FJsonValueString>(TEXT("/Game/NonExistent/TestAsset12345")));
+		Params->SetArrayField(TEXT("asset_paths"), Paths);
+		FMCPToolResult Result = Tool.Execute(Params);
+		TestTrue("Unloaded package should not fail the batch", Result.bSuccess);
+		if (Result.Data.IsValid())
+		{
+			TestEqual("Nothing saved", static_cast<int32>(Result.Data->GetNumberField(TEXT("saved"))), 0);
+			TestEqual("One skipped", static_cast<int32>(Result.Data->GetNumberField(TEXT("skipped"))), 1);
+		}
+	}
+
+	return true;
+}
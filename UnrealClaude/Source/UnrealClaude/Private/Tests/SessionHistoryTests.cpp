@@ -0,0 +1,141 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+/**
+ * Unit tests for session history compaction and token-budgeted prompt history
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "ClaudeSessionManager.h"
+#include "UnrealClaudeConstants.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ============================================================================
+// Compaction Tests
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FSessionHistory_CompactText_ShortTextUnchanged,
+	"UnrealClaude.Session.CompactText.ShortTextUnchanged",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FSessionHistory_CompactText_ShortTextUnchanged::RunTest(const FString& Parameters)
+{
+	const FString Text = TEXT("Spawned a point light at the origin.\nLet me know if you need more.");
+	TestEqual("Short plain text should be returned unchanged", FClaudeSessionManager::CompactText(Text), Text);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FSessionHistory_CompactText_ElidesLargeCodeBlock,
+	"UnrealClaude.Session.CompactText.ElidesLargeCodeBlock",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FSessionHistory_CompactText_ElidesLargeCodeBlock::RunTest(const FString& Parameters)
+{
+	const int32 BodyLines = UnrealClaudeConstants::Session::ElideCodeBlockMinLines + 10;
+
+	FString Text = TEXT("Here is the class:\n```cpp\n");
+	for (int32 i = 0; i < BodyLines; ++i)
+	{
+		Text += FString::Printf(TEXT("int32 Value%d = %d;\n"), i, i);
+	}
+	Text += TEXT("```\nDone.");
+
+	const FString Compacted = FClaudeSessionManager::CompactText(Text);
+
+	TestTrue("Surrounding prose should be kept", Compacted.Contains(TEXT("Here is the class:")));
+	TestTrue("Trailing prose should be kept", Compacted.Contains(TEXT("Done.")));
+	TestFalse("Code body should be elided", Compacted.Contains(TEXT("Value3")));
+	TestTrue("Stub should describe the elided block",
+		Compacted.Contains(FString::Printf(TEXT("[%d-line cpp block elided]"), BodyLines)));
+	TestTrue("Compacted text should be shorter", Compacted.Len() < Text.Len());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FSessionHistory_CompactText_KeepsSmallCodeBlock,
+	"UnrealClaude.Session.CompactText.KeepsSmallCodeBlock",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FSessionHistory_CompactText_KeepsSmallCodeBlock::RunTest(const FString& Parameters)
+{
+	const FString Text = TEXT("Try this:\n```cpp\nActor->SetActorHiddenInGame(true);\n```");
+	const FString Compacted = FClaudeSessionManager::CompactText(Text);
+
+	TestTrue("Small code block should be kept", Compacted.Contains(TEXT("SetActorHiddenInGame")));
+	TestFalse("Small code block should not be stubbed", Compacted.Contains(TEXT("elided")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FSessionHistory_CompactText_TruncatesOverlongLine,
+	"UnrealClaude.Session.CompactText.TruncatesOverlongLine",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FSessionHistory_CompactText_TruncatesOverlongLine::RunTest(const FString& Parameters)
+{
+	const FString Dump = FString::ChrN(UnrealClaudeConstants::Session::ElideLineMinChars + 500, TEXT('x'));
+	const FString Compacted = FClaudeSessionManager::CompactText(TEXT("Result:\n") + Dump);
+
+	TestTrue("Overlong line should be truncated", Compacted.Len() < Dump.Len());
+	TestTrue("Stub should mention elided characters", Compacted.Contains(TEXT("chars elided")));
+
+	return true;
+}
+
+// ============================================================================
+// Cache and Estimation Tests
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FSessionHistory_EstimateTokens_RoundsUp,
+	"UnrealClaude.Session.EstimateTokens.RoundsUp",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FSessionHistory_EstimateTokens_RoundsUp::RunTest(const FString& Parameters)
+{
+	const int32 CharsPerToken = UnrealClaudeConstants::Session::ApproxCharsPerToken;
+
+	TestEqual("Empty text should be zero tokens", FClaudeSessionManager::EstimateTokens(FString()), 0);
+	TestEqual("One char should be one token", FClaudeSessionManager::EstimateTokens(TEXT("a")), 1);
+	TestEqual("Exact multiple should not round up",
+		FClaudeSessionManager::EstimateTokens(FString::ChrN(CharsPerToken * 3, TEXT('a'))), 3);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FSessionHistory_CompactedCache_TracksHistoryTrim,
+	"UnrealClaude.Session.CompactedCache.TracksHistoryTrim",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FSessionHistory_CompactedCache_TracksHistoryTrim::RunTest(const FString& Parameters)
+{
+	FClaudeSessionManager Manager;
+	Manager.SetMaxHistorySize(2);
+
+	Manager.AddExchange(TEXT("first"), TEXT("one"));
+	Manager.AddExchange(TEXT("second"), TEXT("two"));
+	const FClaudeCompactedExchange& Before = Manager.GetCompactedExchange(0);
+	TestTrue("Index 0 should be the first exchange", Before.Text.Contains(TEXT("first")));
+
+	// Adding a third exchange trims the first; cache must shift with it
+	Manager.AddExchange(TEXT("third"), TEXT("three"));
+	const FClaudeCompactedExchange& After = Manager.GetCompactedExchange(0);
+	TestTrue("Index 0 should now be the second exchange", After.Text.Contains(TEXT("second")));
+	TestTrue("Estimated tokens should be populated", After.EstimatedTokens > 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -7,6 +7,15 @@
 #include "ClaudeSubsystem.h"
 #include "ScriptExecutionManager.h"
 #include "MCP/UnrealClaudeMCPServer.h"
+#include "MCP/MCPActorIndex.h"
+#include "MCP/MCPSpatialIndex.h"
+#include "MCP/MCPLevelJournal.h"
+#include "MCP/MCPPropertyPath.h"
+#include "MCP/MCPAssetNameIndex.h"
+#include "MCP/MCPClassResolver.h"
+#include "MCP/MCPBlueprintSerializationCache.h"
+#include "MCP/MCPBlueprintEditSession.h"
+#include "MCP/MCPWorldPartitionActors.h"
 #include "ProjectContext.h"
 
 #include "Framework/Docking/TabManager.h"
@@ -156,6 +165,17 @@ void FUnrealClaudeModule::StartupModule()
 		UE_LOG(LogUnrealClaude, Warning, TEXT("Claude CLI not found. Please install with: npm install -g @anthropic-ai/claude-code"));
 	}
 
+	// Keep the shared actor indexes in sync with editor actor events
+	FMCPActorIndex::Get().Initialize();
+	FMCPSpatialIndex::Get().Initialize();
+	FMCPLevelJournal::Get().Initialize();
+	FMCPPropertyPathCache::Get().Initialize();
+	FMCPAssetNameIndex::Get().Initialize();
+	FMCPClassResolver::Get().Initialize();
+	FMCPBlueprintSerializationCache::Get().Initialize();
+	FMCPWorldPartitionActors::Initialize();
+	FMCPBlueprintEditSessions::Get().Initialize();
+
 	// Start MCP Server
 	StartMCPServer();
 
@@ -173,6 +193,16 @@ void FUnrealClaudeModule::ShutdownModule()
 	// Stop MCP Server
 	StopMCPServer();
 
+	FMCPBlueprintEditSessions::Get().Shutdown();
+	FMCPWorldPartitionActors::Shutdown();
+	FMCPClassResolver::Get().Shutdown();
+	FMCPBlueprintSerializationCache::Get().Shutdown();
+	FMCPAssetNameIndex::Get().Shutdown();
+	FMCPPropertyPathCache::Get().Shutdown();
+	FMCPLevelJournal::Get().Shutdown();
+	FMCPSpatialIndex::Get().Shutdown();
+	FMCPActorIndex::Get().Shutdown();
+
 	UToolMenus::UnRegisterStartupCallback(this);
 	UToolMenus::UnregisterOwner(this);
 
@@ -78,6 +78,9 @@ struct UNREALCLAUDE_API FCharacterStatsRow : public FTableRowBase
 /**
  * Data Asset for character configuration
  * Contains base stats, mesh/animation references, and gameplay settings
+ *
+ * ConfigId, DisplayName, GameplayTags and bIsPlayerCharacter are also written
+ * as asset registry tags, so configs can be searched without loading them.
  */
 UCLASS(BlueprintType)
 class UNREALCLAUDE_API UCharacterConfigDataAsset : public UDataAsset
@@ -85,6 +88,15 @@ class UNREALCLAUDE_API UCharacterConfigDataAsset : public UDataAsset
 	GENERATED_BODY()
 
 public:
+	/** Asset registry tag names for the searchable fields */
+	static const FName ConfigIdTag;
+	static const FName DisplayNameTag;
+	static const FName GameplayTagsTag;
+	static const FName IsPlayerCharacterTag;
+
+	/** Separator between entries of the GameplayTags registry tag */
+	static constexpr const TCHAR* GameplayTagsSeparator = TEXT(",");
+
 	/** Unique identifier for this character config */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Identity")
 	FName ConfigId;
@@ -163,6 +175,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Type")
 	bool bIsPlayerCharacter = false;
 
+	//~ Begin UObject Interface
+	virtual void GetAssetRegistryTags(FAssetRegistryTagsContext Context) const override;
+	//~ End UObject Interface
+
 	/** Get the stats row from the referenced table if available */
 	UFUNCTION(BlueprintCallable, Category = "Character Config")
 	FCharacterStatsRow GetStatsRow(FName RowName = NAME_None) const
@@ -4,6 +4,18 @@
 
 #include "CoreMinimal.h"
 
+/**
+ * Compacted form of a history exchange, cached for prompt building
+ */
+struct UNREALCLAUDE_API FClaudeCompactedExchange
+{
+	/** Formatted exchange text with large code blocks and dumps elided */
+	FString Text;
+
+	/** Estimated token count of the compacted text */
+	int32 EstimatedTokens = 0;
+};
+
 /**
  * Manages Claude conversation session persistence and history
  * Single responsibility: session storage and retrieval
@@ -40,7 +52,30 @@ public:
 	/** Set max history size */
 	void SetMaxHistorySize(int32 NewMax) { MaxHistorySize = FMath::Max(1, NewMax); }
 
+	/**
+	 * Get the compacted form of a history exchange
+	 * Computed on first request and cached until the exchange leaves history
+	 * @param Index - Index into GetHistory()
+	 */
+	const FClaudeCompactedExchange& GetCompactedExchange(int32 Index) const;
+
+	/** Format an exchange the way it appears in the prompt */
+	static FString FormatExchange(const FString& Prompt, const FString& Response);
+
+	/**
+	 * Elide large fenced code blocks and overlong lines from text
+	 * Elided regions are replaced with short stubs describing what was removed
+	 */
+	static FString CompactText(const FString& Text);
+
+	/** Estimate the token count of text using a characters-per-token ratio */
+	static int32 EstimateTokens(const FString& Text);
+
 private:
 	TArray<TPair<FString, FString>> ConversationHistory;
+
+	/** Lazily computed compacted exchanges, kept index-aligned with ConversationHistory */
+	mutable TArray<TOptional<FClaudeCompactedExchange>> CompactedCache;
+
 	int32 MaxHistorySize;
 };
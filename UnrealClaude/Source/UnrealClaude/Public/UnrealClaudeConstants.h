@@ -48,8 +48,26 @@ namespace UnrealClaudeConstants
 		/** Maximum number of exchanges to store in history */
 		constexpr int32 MaxHistorySize = 50;
 
-		/** Maximum number of history exchanges to include in prompt */
+		/** Maximum number of history exchanges to include in prompt (token budget applies on top) */
 		constexpr int32 MaxHistoryInPrompt = 10;
+
+		/** Estimated token budget for conversation history included in a prompt */
+		constexpr int32 HistoryTokenBudget = 16000;
+
+		/** Rough characters-per-token ratio used for token estimates */
+		constexpr int32 ApproxCharsPerToken = 4;
+
+		/** Number of most recent exchanges kept verbatim (older ones are compacted) */
+		constexpr int32 RecentExchangesVerbatim = 2;
+
+		/** Fenced code blocks with more lines than this are elided in older exchanges */
+		constexpr int32 ElideCodeBlockMinLines = 15;
+
+		/** Single lines longer than this (e.g. JSON tool dumps) are truncated in older exchanges */
+		constexpr int32 ElideLineMinChars = 2000;
+
+		/** Characters kept from the start of a truncated line */
+		constexpr int32 ElidedLineKeepChars = 200;
 	}
 
 	// Project Context
@@ -123,6 +141,246 @@ namespace UnrealClaudeConstants
 		constexpr int32 DefaultActorLimit = 100;
 	}
 
+	// Spatial Actor Queries
+	namespace SpatialQuery
+	{
+		/** Edge length of a spatial hash cell in world units */
+		constexpr double CellSize = 2000.0;
+
+		/** Actors whose bounds span more cells than this are kept in an always-checked list */
+		constexpr int32 MaxCellsPerActor = 64;
+
+		/** Default number of results returned */
+		constexpr int32 DefaultResultLimit = 25;
+
+		/** Maximum number of results returned */
+		constexpr int32 MaxResultLimit = 1000;
+
+		/** Default neighbour count for nearest queries */
+		constexpr int32 DefaultNearestCount = 10;
+	}
+
+	// Cursor Pagination
+	namespace Pagination
+	{
+		/** Seconds a listing cursor stays valid after its last use */
+		constexpr double CursorTTLSeconds = 600.0;
+
+		/** Maximum number of live cursor snapshots (least recently used is evicted) */
+		constexpr int32 MaxCursorSnapshots = 32;
+
+		/** Maximum accepted length of a cursor string */
+		constexpr int32 MaxCursorLength = 128;
+	}
+
+	// Level Change Journal
+	namespace LevelJournal
+	{
+		/** Maximum journal entries retained before the oldest are dropped */
+		constexpr int32 MaxEntries = 20000;
+
+		/** Default number of changed actors returned per query */
+		constexpr int32 DefaultChangeLimit = 200;
+
+		/** Maximum number of changed actors returned per query */
+		constexpr int32 MaxChangeLimit = 2000;
+	}
+
+	// Level Snapshots
+	namespace LevelSnapshot
+	{
+		/** Maximum snapshots kept in memory (oldest is dropped) */
+		constexpr int32 MaxSnapshots = 8;
+
+		/** Maximum actors listed per category in a diff reply */
+		constexpr int32 MaxDiffEntries = 200;
+
+		/** Maximum extra property paths captured per snapshot */
+		constexpr int32 MaxPropertyPaths = 32;
+
+		/** Location quantization step for hashing and comparison (world units) */
+		constexpr double LocationTolerance = 0.01;
+
+		/** Rotation quaternion component quantization step */
+		constexpr double RotationTolerance = 1e-4;
+
+		/** Scale quantization step */
+		constexpr double ScaleTolerance = 1e-4;
+	}
+
+	// Bulk Spawning
+	namespace BulkSpawn
+	{
+		/** Maximum actors spawned by one spawn_actors_bulk call */
+		constexpr int32 MaxActors = 5000;
+
+		/** Maximum instances added to one instanced mesh actor */
+		constexpr int32 MaxInstances = 100000;
+
+		/** Maximum spawned actor names listed in a reply */
+		constexpr int32 MaxListedActors = 50;
+	}
+
+	// Batched Actor Edits
+	namespace BatchEdit
+	{
+		/** Maximum edits applied by one batch_edit_actors call */
+		constexpr int32 MaxEdits = 5000;
+
+		/** Maximum per-edit errors listed in a reply */
+		constexpr int32 MaxReportedErrors = 50;
+	}
+
+	// Property Path Resolution
+	namespace PropertyPath
+	{
+		/** Compiled (class, path) chains kept before the cache is cleared */
+		constexpr int32 MaxCachedPaths = 4096;
+	}
+
+	// Bulk Property Reads
+	namespace GetProperties
+	{
+		/** Maximum objects (rows) read by one get_properties call */
+		constexpr int32 MaxObjects = 5000;
+
+		/** Maximum property paths (columns) per call */
+		constexpr int32 MaxPaths = 64;
+
+		/** Default levels of struct/array nesting expanded into JSON */
+		constexpr int32 DefaultMaxDepth = 2;
+
+		/** Upper bound for the max_depth parameter */
+		constexpr int32 MaxDepth = 8;
+
+		/** Default elements listed per array, set or map */
+		constexpr int32 DefaultMaxElements = 32;
+
+		/** Upper bound for the max_elements parameter */
+		constexpr int32 MaxElements = 1024;
+	}
+
+	// Table Export
+	namespace ExportTable
+	{
+		/** Maximum rows written by one export_table call */
+		constexpr int32 MaxRows = 1000000;
+
+		/** Maximum columns per export */
+		constexpr int32 MaxColumns = 256;
+
+		/** Rows formatted per parallel batch before being written */
+		constexpr int32 RowsPerChunk = 4096;
+	}
+
+	// Asset Name Index
+	namespace AssetNameIndex
+	{
+		/** Minimum fraction of a query's trigrams a name must share to count as a fuzzy match */
+		constexpr float FuzzyMinSimilarity = 0.5f;
+
+		/** Rebuild the index once this fraction of entries has been removed */
+		constexpr float RebuildRemovedFraction = 0.25f;
+	}
+
+	// Asset Graph Traversal
+	namespace AssetGraph
+	{
+		/** Default hops followed from the root */
+		constexpr int32 DefaultMaxDepth = 8;
+
+		/** Upper bound for the max_depth parameter */
+		constexpr int32 MaxDepth = 64;
+
+		/** Traversal stops adding packages past this many */
+		constexpr int32 MaxNodes = 250000;
+
+		/** Default and maximum nodes listed in the result */
+		constexpr int32 DefaultLimit = 100;
+		constexpr int32 MaxLimit = 5000;
+
+		/** Cycles listed in the result (all are counted) */
+		constexpr int32 MaxReportedCycles = 25;
+	}
+
+	// Hard Reference Analysis
+	namespace HardReferenceAnalysis
+	{
+		/** Traversal stops adding packages past this many */
+		constexpr int32 MaxNodes = 250000;
+
+		/** Default retained size (bytes) at which a hard reference is flagged for conversion */
+		constexpr int64 DefaultMinSize = 1024 * 1024;
+
+		/** Default and maximum packages listed in the result */
+		constexpr int32 DefaultLimit = 25;
+		constexpr int32 MaxLimit = 500;
+
+		/** Referencers listed per package (all are counted) */
+		constexpr int32 MaxListedReferencers = 10;
+	}
+
+	// Batched Saving
+	namespace SaveAssets
+	{
+		/** Maximum packages saved by one save_assets call */
+		constexpr int32 MaxPackages = 5000;
+	}
+
+	// Asset Preloading
+	namespace AssetPreload
+	{
+		/** Maximum assets streamed in ahead of one tool call (the rest load on demand) */
+		constexpr int32 MaxAssets = 2000;
+
+		/** How often a waiting worker checks for cancellation and timeout */
+		constexpr uint32 PollIntervalMs = 20;
+	}
+
+	// Blueprint Edit Sessions
+	namespace BlueprintEditSession
+	{
+		/** Sessions with no change for this long are committed (compiled) and closed */
+		constexpr double IdleTimeoutSeconds = 600.0;
+
+		/** How often idle sessions are checked */
+		constexpr float IdleCheckIntervalSeconds = 30.0f;
+	}
+
+	// Blueprint Query Cache
+	namespace BlueprintSerializationCache
+	{
+		/** Blueprints whose blueprint_query results are kept (least recently used are dropped) */
+		constexpr int32 MaxBlueprints = 64;
+
+		/** Low bits of a version left for increments; the process start time fills the rest */
+		constexpr uint32 VersionEpochBits = 20;
+	}
+
+	// Compact Graph Text
+	namespace GraphText
+	{
+		/** Maximum nodes one add_nodes 'text' may create */
+		constexpr int32 MaxNodes = 500;
+
+		/** Horizontal spacing for parsed nodes without an @x,y position */
+		constexpr int32 AutoLayoutSpacingX = 300;
+	}
+
+	// Bulk Blueprint Compilation
+	namespace CompileBlueprints
+	{
+		/** Maximum Blueprints compiled by one compile_blueprints call */
+		constexpr int32 MaxBlueprints = 2000;
+
+		/** Default and maximum entries in the per_asset_timing 'slowest' list */
+		constexpr int32 DefaultSlowest = 10;
+		constexpr int32 MaxSlowest = 100;
+
+		/** Compiler messages reported per Blueprint (all are counted) */
+		constexpr int32 MaxMessagesPerBlueprint = 20;
+	}
+
 	// Numeric Bounds
 	namespace NumericBounds
 	{
@@ -175,6 +433,16 @@ namespace UnrealClaudeConstants
 			TEXT("delete_actors"),
 			TEXT("move_actor"),
 			TEXT("set_property"),
+			TEXT("query_actors_spatial"),
+			TEXT("get_level_changes"),
+			TEXT("level_snapshot"),
+			TEXT("level_diff"),
+			TEXT("level_restore"),
+			TEXT("spawn_actors_bulk"),
+			TEXT("batch_edit_actors"),
+			TEXT("get_properties"),
+			TEXT("export_table"),
+			TEXT("unload_actors"),
 			// Utility tools
 			TEXT("run_console_command"),
 			TEXT("get_output_log"),
@@ -186,10 +454,14 @@ namespace UnrealClaudeConstants
 			TEXT("blueprint_query"),
 			TEXT("blueprint_modify"),
 			TEXT("anim_blueprint_modify"),
+			TEXT("compile_blueprints"),
 			// Asset tools
 			TEXT("asset_search"),
 			TEXT("asset_dependencies"),
 			TEXT("asset_referencers"),
+			TEXT("asset_graph"),
+			TEXT("analyze_hard_references"),
+			TEXT("save_assets"),
 			// Level management tools
 			TEXT("open_level"),
 			// Task queue tools
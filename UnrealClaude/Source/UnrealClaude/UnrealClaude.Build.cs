@@ -58,6 +58,7 @@ public class UnrealClaude : ModuleRules
 				"AnimGraphRuntime",
 				// Asset saving
 				"EditorScriptingUtilities",
+				"SourceControl",
 				// Enhanced Input
 				"EnhancedInput"
 			}